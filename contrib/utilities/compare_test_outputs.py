@@ -0,0 +1,68 @@
+"""
+Compare the output of a test with its reference output within an absolute and
+a relative tolerance.
+
+This is used to validate builds whose results are not expected to match the
+reference outputs to the precision of the test suite, for example a build with
+LETHE_DEM_MIXED_PRECISION=ON. The script is meant to be used as the diff
+command of the test suite, through the TEST_DIFF variable of deal.II, so ctest
+fails for every output that is not within the tolerances. The comparison is
+symmetric, so the order of the two files does not matter.
+
+Usage:
+  python3 compare_test_outputs.py [--atol 1e-6] [--rtol 1e-3] \
+      <reference output> <test output>
+
+Example:
+  cmake ../lethe -DLETHE_DEM_MIXED_PRECISION=ON \
+    -DTEST_DIFF="python3;../lethe/contrib/utilities/compare_test_outputs.py"
+"""
+
+import argparse
+import re
+import sys
+
+NUMBER = re.compile(r"^[-+]?(\d+\.?\d*|\.\d+)([eE][-+]?\d+)?$")
+SEPARATORS = re.compile(r"[\s=:,;()\[\]<>]+")
+
+
+def tokens(path):
+    with open(path) as f:
+        return [t for t in SEPARATORS.split(f.read()) if t]
+
+
+def compare(reference, output, atol, rtol):
+    """Return the first mismatch between two outputs, or None."""
+    ref_tokens = tokens(reference)
+    out_tokens = tokens(output)
+    if len(ref_tokens) != len(out_tokens):
+        return "different number of tokens (%d != %d)" % (
+            len(ref_tokens), len(out_tokens))
+    for ref, out in zip(ref_tokens, out_tokens):
+        if NUMBER.match(ref) and NUMBER.match(out):
+            a, b = float(ref), float(out)
+            if abs(a - b) > atol + rtol * max(abs(a), abs(b)):
+                return "%s != %s" % (ref, out)
+        elif ref != out:
+            return "%s != %s" % (ref, out)
+    return None
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("reference")
+    parser.add_argument("output")
+    parser.add_argument("--atol", type=float, default=1e-6)
+    parser.add_argument("--rtol", type=float, default=1e-3)
+    args = parser.parse_args()
+
+    mismatch = compare(args.reference, args.output, args.atol, args.rtol)
+    if mismatch:
+        print("%s and %s differ beyond atol=%g, rtol=%g: %s" %
+              (args.reference, args.output, args.atol, args.rtol, mismatch))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,190 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------*/
+
+#ifndef lethe_anderson_acceleration_h
+#define lethe_anderson_acceleration_h
+
+#include <deal.II/base/exceptions.h>
+
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/vector.h>
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief Anderson acceleration of a fixed-point iteration
+ * \f$x_{k+1} = g(x_k)\f$.
+ *
+ * The state of the iteration is made of several vectors, for example the
+ * solutions of several physics, which are treated as a single concatenated
+ * vector. The next iterate is the combination of the last evaluations
+ * \f$g(x_k)\f$ that minimizes the norm of the combination of the last
+ * residuals \f$f_k = g(x_k) - x_k\f$:
+ *
+ * \f$x_{k+1} = g(x_k) - \sum_j \gamma_j \Delta g_j\f$ with
+ * \f$\gamma = \arg\min \| f_k - \sum_j \gamma_j \Delta f_j \|\f$,
+ *
+ * where \f$\Delta g_j\f$ and \f$\Delta f_j\f$ are the differences between
+ * two consecutive evaluations and residuals. The least-squares problem is
+ * solved with its normal equations, which are small since the depth of the
+ * history is small.
+ *
+ * @tparam VectorType The vector type of the state of the iteration. The
+ * vectors must not have ghost elements.
+ */
+template <typename VectorType>
+class AndersonAcceleration
+{
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] depth Number of previous iterations used to compute the next
+   * iterate. With a depth of zero, the iteration is not accelerated.
+   */
+  AndersonAcceleration(const unsigned int depth)
+    : depth(depth)
+  {}
+
+  /**
+   * @brief Clear the history of the iterations. Must be called before a new
+   * fixed-point iteration is started.
+   */
+  void
+  clear()
+  {
+    residual_differences.clear();
+    evaluation_differences.clear();
+    previous_residual.clear();
+    previous_evaluation.clear();
+  }
+
+  /**
+   * @brief Compute the next iterate of the fixed-point iteration.
+   *
+   * @param[in] iterate Current iterate \f$x_k\f$.
+   *
+   * @param[in,out] evaluation Evaluation \f$g(x_k)\f$ of the current iterate
+   * in input and next iterate \f$x_{k+1}\f$ in output.
+   *
+   * @return The l2 norm of the residual \f$f_k = g(x_k) - x_k\f$.
+   */
+  double
+  update(const std::vector<VectorType> &iterate,
+         std::vector<VectorType>       &evaluation)
+  {
+    AssertDimension(iterate.size(), evaluation.size());
+
+    std::vector<VectorType> residual(evaluation);
+    for (unsigned int i = 0; i < residual.size(); ++i)
+      residual[i] -= iterate[i];
+
+    const double residual_norm = std::sqrt(dot(residual, residual));
+
+    if (depth == 0)
+      return residual_norm;
+
+    // Add the differences with the previous iteration to the history
+    if (!previous_residual.empty())
+      {
+        for (unsigned int i = 0; i < residual.size(); ++i)
+          {
+            previous_residual[i].sadd(-1., residual[i]);
+            previous_evaluation[i].sadd(-1., evaluation[i]);
+          }
+        residual_differences.emplace_back(std::move(previous_residual));
+        evaluation_differences.emplace_back(std::move(previous_evaluation));
+
+        if (residual_differences.size() > depth)
+          {
+            residual_differences.pop_front();
+            evaluation_differences.pop_front();
+          }
+      }
+
+    previous_residual   = residual;
+    previous_evaluation = evaluation;
+
+    const unsigned int n_differences = residual_differences.size();
+    if (n_differences == 0)
+      return residual_norm;
+
+    // Normal equations of the least-squares problem. They are regularized to
+    // remain solvable when the differences are close to linearly dependent.
+    FullMatrix<double> normal_matrix(n_differences, n_differences);
+    Vector<double>     normal_rhs(n_differences);
+    for (unsigned int j = 0; j < n_differences; ++j)
+      {
+        for (unsigned int l = 0; l <= j; ++l)
+          {
+            normal_matrix(j, l) =
+              dot(residual_differences[j], residual_differences[l]);
+            normal_matrix(l, j) = normal_matrix(j, l);
+          }
+        normal_rhs(j) = dot(residual_differences[j], residual);
+      }
+
+    double max_diagonal = 0;
+    for (unsigned int j = 0; j < n_differences; ++j)
+      max_diagonal = std::max(max_diagonal, normal_matrix(j, j));
+    if (max_diagonal == 0)
+      return residual_norm;
+    for (unsigned int j = 0; j < n_differences; ++j)
+      normal_matrix(j, j) += 1e-10 * max_diagonal;
+
+    normal_matrix.gauss_jordan();
+    Vector<double> gamma(n_differences);
+    normal_matrix.vmult(gamma, normal_rhs);
+
+    for (unsigned int j = 0; j < n_differences; ++j)
+      for (unsigned int i = 0; i < evaluation.size(); ++i)
+        evaluation[i].add(-gamma(j), evaluation_differences[j][i]);
+
+    return residual_norm;
+  }
+
+private:
+  /**
+   * @brief Scalar product of two states of the iteration.
+   */
+  static double
+  dot(const std::vector<VectorType> &a, const std::vector<VectorType> &b)
+  {
+    double result = 0;
+    for (unsigned int i = 0; i < a.size(); ++i)
+      result += a[i] * b[i];
+    return result;
+  }
+
+  /// Number of previous iterations used to compute the next iterate
+  const unsigned int depth;
+
+  /// Differences between consecutive residuals, from the oldest to the newest
+  std::deque<std::vector<VectorType>> residual_differences;
+
+  /// Differences between consecutive evaluations
+  std::deque<std::vector<VectorType>> evaluation_differences;
+
+  /// Residual and evaluation of the previous iteration
+  std::vector<VectorType> previous_residual;
+  std::vector<VectorType> previous_evaluation;
+};
+
+#endif
@@ -121,7 +121,7 @@ public:
    * remains constant.
    */
   void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
+  vector_value(const FieldVectors  &field_vectors,
                std::vector<double> &property_vector) override
   {
     (void)field_vectors;
@@ -172,8 +172,8 @@ public:
    *
    */
   void
-  vector_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                  const field                                 id,
+  vector_jacobian(const FieldVectors  &field_vectors,
+                  const field          id,
                   std::vector<double> &jacobian_vector) override
   {
     (void)field_vectors;
@@ -282,13 +282,13 @@ public:
    * @param[out] property_vector Vectors of computed density values.
    */
   void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
+  vector_value(const FieldVectors  &field_vectors,
                std::vector<double> &property_vector) override
   {
-    AssertThrow(field_vectors.find(field::pressure) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::pressure),
                 PhysicialPropertyModelFieldUndefined(
                   "DensityIsothermalIdealGas", "pressure"));
-    const std::vector<double> &pressure = field_vectors.at(field::pressure);
+    const ArrayView<const double> &pressure = field_vectors.at(field::pressure);
     for (unsigned int i = 0; i < property_vector.size(); ++i)
       property_vector[i] = density_ref + psi * pressure[i];
   }
@@ -330,8 +330,8 @@ public:
    * with respect to the field of the specified @p id.
    */
   void
-  vector_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                  const field                                 id,
+  vector_jacobian(const FieldVectors  &field_vectors,
+                  const field          id,
                   std::vector<double> &jacobian_vector) override
   {
     (void)field_vectors;
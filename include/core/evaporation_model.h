@@ -48,7 +48,9 @@ class EvaporationModel
 {
 public:
   EvaporationModel()
-  {}
+  {
+    model_depends_on.fill(false);
+  }
 
   /**
    * @brief Instantiates and returns a pointer to an EvaporationModel
@@ -83,14 +85,14 @@ public:
   /**
    * @brief mass_flux Calculates the values of the evaporation mass flux
    * for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the mass flux may depend. Each vector contains the field values at
    * the points of interest.
    * @param mass_flux_vector Vector of mass flux values.
    */
   virtual void
-  mass_flux(const std::map<field, std::vector<double>> &field_vectors,
-            std::vector<double>                        &mass_flux_vector) = 0;
+  mass_flux(const FieldVectors  &field_vectors,
+            std::vector<double> &mass_flux_vector) = 0;
 
   /**
    * @brief heat_flux Calculates the value of the evaporation heat flux.
@@ -104,14 +106,14 @@ public:
   /**
    * @brief heat_flux Calculates the values of the evaporation heat flux
    * for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the heat flux may depend. Each vector contains the field values at
    * the points of interest.
    * @param heat_flux_vector Vector of heat flux values.
    */
   virtual void
-  heat_flux(const std::map<field, std::vector<double>> &field_vectors,
-            std::vector<double>                        &heat_flux_vector) = 0;
+  heat_flux(const FieldVectors  &field_vectors,
+            std::vector<double> &heat_flux_vector) = 0;
 
   /**
    * @brief heat_flux_jacobian Calculates the jacobian (the partial derivative)
@@ -130,7 +132,7 @@ public:
   /**
    * @brief heat_flux_jacobian Calculates the derivative of the evaporation
    * heat flux with respect to a field for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the heat flux may depend. Each vector contains the field values at
    * the points of interest.
    * @param id Identifier of the field with respect to which a derivative should
@@ -139,8 +141,8 @@ public:
    * flux with respect to the field.
    */
   virtual void
-  heat_flux_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                     const field                                 id,
+  heat_flux_jacobian(const FieldVectors  &field_vectors,
+                     const field          id,
                      std::vector<double> &jacobian_vector) = 0;
 
   /**
@@ -155,13 +157,13 @@ public:
   /**
    * @brief momentum_flux Calculates the values of the evaporation momentum
    * flux for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the evaporation momentum flux may depend. Each vector contains the
    * field values at the points of interest.
    * @param momentum_flux_vector Vector of momentum flux values.
    */
   virtual void
-  momentum_flux(const std::map<field, std::vector<double>> &field_vectors,
+  momentum_flux(const FieldVectors  &field_vectors,
                 std::vector<double> &momentum_flux_vector) = 0;
 
   /**
@@ -181,7 +183,7 @@ public:
   /**
    * @brief momentum_flux_jacobian Calculates the derivative of the
    * evaporation momentum flux with respect to a field for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the momentum flux may depend. Each vector contains the field
    * values at the points of interest.
    * @param id Identifier of the field with respect to which a derivative should
@@ -190,14 +192,13 @@ public:
    * flux with respect to the field.
    */
   virtual void
-  momentum_flux_jacobian(
-    const std::map<field, std::vector<double>> &field_vectors,
-    const field                                 id,
-    std::vector<double>                        &jacobian_vector) = 0;
+  momentum_flux_jacobian(const FieldVectors  &field_vectors,
+                         const field          id,
+                         std::vector<double> &jacobian_vector) = 0;
 
 protected:
-  // Map that indicates on which fields the model depends on
-  std::map<field, bool> model_depends_on;
+  // Array that indicates on which fields the model depends on
+  std::array<bool, n_fields> model_depends_on;
 };
 
 /**
@@ -235,13 +236,13 @@ public:
   /**
    * @brief mass_flux Calculates the values of the evaporation mass flux
    * for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the mass flux may depend. Each vector contains the field values at
    * the points of interest.
    * @param mass_flux_vector Vector of mass flux values.
    */
   void
-  mass_flux(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  mass_flux(const FieldVectors & /*field_vectors*/,
             std::vector<double> &mass_flux_vector) override
   {
     std::fill(mass_flux_vector.begin(),
@@ -264,13 +265,13 @@ public:
   /**
    * @brief heat_flux Calculates the values of the evaporation heat flux
    * for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the heat flux may depend. Each vector contains the field values at
    * the points of interest.
    * @param heat_flux_vector Vectors of the heat flux values.
    */
   void
-  heat_flux(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  heat_flux(const FieldVectors & /*field_vectors*/,
             std::vector<double> &heat_flux_vector) override
   {
     std::fill(heat_flux_vector.begin(),
@@ -307,10 +308,9 @@ public:
    * flux with respect to the field.
    */
   void
-  heat_flux_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override
+  heat_flux_jacobian(const FieldVectors & /*field_vectors*/,
+                     const field /*id*/,
+                     std::vector<double> &jacobian_vector) override
   {
     std::fill(jacobian_vector.begin(), jacobian_vector.end(), 0);
   }
@@ -331,13 +331,13 @@ public:
   /**
    * @brief momentum_flux Calculates the values of the evaporation momentum
    * flux for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the momentum flux may depend. Each vector contains the field
    * values at the points of interest.
    * @param momentum_flux_vector Vector of momentum flux values.
    */
   void
-  momentum_flux(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  momentum_flux(const FieldVectors & /*field_vectors*/,
                 std::vector<double> &momentum_flux_vector) override
   {
     const double momentum_flux_value =
@@ -369,7 +369,7 @@ public:
   /**
    * @brief momentum_flux_jacobian Calculates the derivative of the
    * evaporation momentum flux with respect to a field
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the momentum flux may depend. Each vector contains the field
    * values at the points of interest.
    * @param id Identifier of the field with respect to which a derivative should
@@ -378,10 +378,9 @@ public:
    * flux with respect to the field.
    */
   void
-  momentum_flux_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override
+  momentum_flux_jacobian(const FieldVectors & /*field_vectors*/,
+                         const field /*id*/,
+                         std::vector<double> &jacobian_vector) override
   {
     std::fill(jacobian_vector.begin(), jacobian_vector.end(), 0);
   }
@@ -445,19 +444,19 @@ public:
   /**
    * @brief mass_flux Calculates the values of the saturation pressure
    * for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the saturated vapor pressure may depend. Each vector contains the
    * field values at the points of interest.
    * @param saturation_pressure_vector Vector of the saturation pressure values.
    */
   void
-  saturation_pressure(const std::map<field, std::vector<double>> &field_vectors,
+  saturation_pressure(const FieldVectors  &field_vectors,
                       std::vector<double> &saturation_pressure_vector)
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined(
                   "EvaporationModelTemperature", "temperature"));
-    const std::vector<double> &temperature =
+    const ArrayView<const double> &temperature =
       field_vectors.at(field::temperature);
 
     const double R_inv = 1.0 / universal_gas_constant;
@@ -504,19 +503,19 @@ public:
   /**
    * @brief mass_flux Calculates the values of the evaporation mass flux
    * for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the evaporation mass flux may depend. Each vector contains the
    * field values at the points of interest.
    * @param mass_flux_vector Vector of mass flux values.
    */
   void
-  mass_flux(const std::map<field, std::vector<double>> &field_vectors,
+  mass_flux(const FieldVectors  &field_vectors,
             std::vector<double> &mass_flux_vector) override
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined(
                   "EvaporationModelTemperature", "temperature"));
-    const std::vector<double> &temperature =
+    const ArrayView<const double> &temperature =
       field_vectors.at(field::temperature);
 
     const double R_inv               = 1.0 / universal_gas_constant;
@@ -554,13 +553,13 @@ public:
   /**
    * @brief heat_flux Calculates the values of the evaporation heat flux
    * for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the heat flux may depend. Each vector contains the field values at
    * the points of interest.
    * @param heat_flux_vector Vector of heat flux values.
    */
   void
-  heat_flux(const std::map<field, std::vector<double>> &field_vectors,
+  heat_flux(const FieldVectors  &field_vectors,
             std::vector<double> &heat_flux_vector) override
   {
     const unsigned int n_pts = heat_flux_vector.size();
@@ -613,7 +612,7 @@ public:
   /**
    * @brief heat_flux_jacobian Calculates the derivative of the evaporation
    * heat flux with respect to a field.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which heat flux evaluated at a point may depend. Each vector contains
    * the field values at the points of interest.
    * @param id Identifier of the field with respect to which a derivative should
@@ -622,8 +621,8 @@ public:
    * with respect to the field.
    */
   void
-  heat_flux_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                     const field                                 id,
+  heat_flux_jacobian(const FieldVectors  &field_vectors,
+                     const field          id,
                      std::vector<double> &jacobian_vector) override
   {
     const double R_inv = 1.0 / universal_gas_constant;
@@ -634,10 +633,10 @@ public:
     if (id == field::temperature)
       {
         AssertThrow(
-          field_vectors.find(field::temperature) != field_vectors.end(),
+          field_vectors.is_defined(field::temperature),
           PhysicialPropertyModelFieldUndefined("EvaporationModelTemperature",
                                                "temperature"));
-        const std::vector<double> &temperature =
+        const ArrayView<const double> &temperature =
           field_vectors.at(field::temperature);
 
         const unsigned int n_pts = jacobian_vector.size();
@@ -677,13 +676,13 @@ public:
   /**
    * @brief momentum_flux Calculates the values of the evaporation momentum
    * flux for multiple points.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * on which the momentum flux may depend. Each vector contains the field
    * values at the points of interest.
    * @param momentum_flux_vector Vectors of the momentum flux values.
    */
   void
-  momentum_flux(const std::map<field, std::vector<double>> &field_vectors,
+  momentum_flux(const FieldVectors  &field_vectors,
                 std::vector<double> &momentum_flux_vector) override
   {
     const unsigned int n_pts = momentum_flux_vector.size();
@@ -718,7 +717,7 @@ public:
   /**
    * @brief momentum_flux_jacobian Calculates the derivative of the
    * evaporation momentum flux with respect to a field.
-   * @param field_vectors Map storing the vectors of the values for each field
+   * @param field_vectors Views on the vectors of the values for each field
    * flux may depend. Each vector contains the field values at the points of
    * interest.
    * @param id Identifier of the field with respect to which a derivative should
@@ -727,10 +726,9 @@ public:
    * flux with respect to the field.
    */
   void
-  momentum_flux_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override
+  momentum_flux_jacobian(const FieldVectors & /*field_vectors*/,
+                         const field /*id*/,
+                         std::vector<double> &jacobian_vector) override
   {
     std::fill(jacobian_vector.begin(), jacobian_vector.end(), 0);
   }
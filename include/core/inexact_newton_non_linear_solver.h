@@ -27,6 +27,15 @@
  * monotonically decreasing. It allows to reuse the matrix and avoid its
  * reassembly for every Newton step.
  *
+ * The matrix is reassembled when a Newton step does not decrease the residual
+ * by at least the matrix tolerance. If reuse matrix is enabled, this state is
+ * kept from one non-linear problem to the next (e.g. across time steps), such
+ * that a matrix which still performs well is not reassembled at the beginning
+ * of every time step. The matrix is nevertheless reassembled if the physics
+ * solver flags it as outdated or if it has been shared by the maximal number
+ * of non-linear problems. If reuse preconditioner is enabled, the
+ * preconditioner is set up at most once per non-linear problem.
+ *
  */
 template <typename VectorType>
 class InexactNewtonNonLinearSolver : public NonLinearSolver<VectorType>
@@ -57,7 +66,17 @@ public:
   solve(const bool is_initial_step) override;
 
 private:
+  /**
+   * @brief Indicate if the matrix must be reassembled at the next Newton
+   * iteration. Kept from one non-linear problem to the next.
+   */
   bool matrix_requires_assembly;
+
+  /**
+   * @brief Number of non-linear problems solved since the last assembly of
+   * the matrix.
+   */
+  unsigned int matrix_age;
 };
 
 template <typename VectorType>
@@ -66,6 +85,7 @@ InexactNewtonNonLinearSolver<VectorType>::InexactNewtonNonLinearSolver(
   const Parameters::NonLinearSolver &params)
   : NonLinearSolver<VectorType>(physics_solver, params)
   , matrix_requires_assembly(true)
+  , matrix_age(0)
 {}
 
 template <typename VectorType>
@@ -94,18 +114,32 @@ InexactNewtonNonLinearSolver<VectorType>::solve(const bool is_initial_step)
   auto &evaluation_point = solver->get_evaluation_point();
   auto &present_solution = solver->get_present_solution();
 
-  if (!this->params.reuse_matrix)
+  // The matrix of the previous non-linear problem is only reused if it is
+  // still valid for the current problem and if it has not already been shared
+  // by the maximal number of non-linear problems.
+  if (!this->params.reuse_matrix || solver->system_matrix_is_outdated() ||
+      (this->params.reuse_matrix_max_steps > 0 &&
+       matrix_age >= this->params.reuse_matrix_max_steps))
     matrix_requires_assembly = true;
 
+  bool preconditioner_is_set_up = false;
+
   while ((global_res > this->params.tolerance) &&
          outer_iteration < this->params.max_iterations)
     {
       evaluation_point = present_solution;
 
-      if (matrix_requires_assembly)
+      const bool renewed_matrix = matrix_requires_assembly;
+      if (renewed_matrix)
         {
           solver->assemble_system_matrix();
-          solver->setup_preconditioner();
+          matrix_age = 0;
+
+          if (!this->params.reuse_preconditioner || !preconditioner_is_set_up)
+            {
+              solver->setup_preconditioner();
+              preconditioner_is_set_up = true;
+            }
         }
 
       if (this->params.force_rhs_calculation || outer_iteration == 0)
@@ -124,7 +158,7 @@ InexactNewtonNonLinearSolver<VectorType>::solve(const bool is_initial_step)
                         << "  - Residual:  " << current_res << std::endl;
         }
 
-      solver->solve_linear_system(first_step);
+      solver->solve_linear_system(first_step, renewed_matrix);
       double last_alpha_res = current_res;
 
       unsigned int alpha_iter = 0;
@@ -199,6 +233,8 @@ InexactNewtonNonLinearSolver<VectorType>::solve(const bool is_initial_step)
       ++outer_iteration;
     }
 
+  ++matrix_age;
+
   // If the non-linear solver has not converged abort simulation if
   // abort_at_convergence_failure=true
   if ((global_res > this->params.tolerance) &&
@@ -28,10 +28,11 @@ using namespace dealii;
  * value of an interface property or a vector of interface property value for
  * given field value. By default, the interface does not require that all (or
  * any) fields be specified. This is why a map is used to pass the dependent
- * variable. To allow for the calculation of the appropriate jacobian matrix
- * (when that is necessary) the interface also provides a jacobian function,
- * which must provide the derivative with respect to the field specified as an
- * argument.
+ * variable of a single point, while the values at multiple points are passed
+ * through the FieldVectors views. To allow for the calculation of the
+ * appropriate jacobian matrix (when that is necessary) the interface also
+ * provides a jacobian function, which must provide the derivative with respect
+ * to the field specified as an argument.
  */
 class InterfacePropertyModel
 {
@@ -41,11 +42,7 @@ public:
    */
   InterfacePropertyModel()
   {
-    model_depends_on[shear_rate]                = false;
-    model_depends_on[temperature]               = false;
-    model_depends_on[temperature_p1]            = false;
-    model_depends_on[pressure]                  = false;
-    model_depends_on[phase_order_cahn_hilliard] = false;
+    model_depends_on.fill(false);
   }
 
   /**
@@ -72,8 +69,8 @@ public:
    * @param field_vectors
    */
   virtual void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
-               std::vector<double>                        &property_vector) = 0;
+  vector_value(const FieldVectors  &field_vectors,
+               std::vector<double> &property_vector) = 0;
 
   /**
    * @brief jacobian Calculates the jacobian (the partial derivative) of the interface
@@ -95,8 +92,8 @@ public:
    */
 
   virtual void
-  vector_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                  const field                                 id,
+  vector_jacobian(const FieldVectors  &field_vectors,
+                  const field          id,
                   std::vector<double> &jacobian_vector) = 0;
 
 
@@ -130,42 +127,19 @@ public:
    * @return
    */
   inline void
-  vector_numerical_jacobian(
-    const std::map<field, std::vector<double>> &field_vectors,
-    const field                                 id,
-    std::vector<double>                        &jacobian_vector)
+  vector_numerical_jacobian(const FieldVectors  &field_vectors,
+                            const field          id,
+                            std::vector<double> &jacobian_vector)
   {
-    const unsigned int n_pts = jacobian_vector.size();
-
-    // Evaluate the properties using the values of the field vector
-    std::vector<double> f_x(n_pts);
-    vector_value(field_vectors, f_x);
-
-    // Make a copy of the field vector for the field we will perturbate
-    std::map<field, std::vector<double>> perturbed_field_vectors =
-      field_vectors;
-    std::vector<double> &x = perturbed_field_vectors.at(id);
-    std::vector<double>  dx(n_pts);
-
-    // Perturb the field by dx
-    for (unsigned int i = 0; i < n_pts; ++i)
-      {
-        dx[i] = std::max(1e-6 * x[i], 1e-8);
-        x[i] += dx[i];
-      }
-
-    // Evaluate the properties using the perturbed value of the field vector
-    std::vector<double> f_xdx(n_pts);
-    vector_value(perturbed_field_vectors, f_xdx);
-
-    // Fill jacobian
-    for (unsigned int i = 0; i < n_pts; ++i)
-      jacobian_vector[i] = (f_xdx[i] - f_x[i]) / dx[i];
+    forward_difference_vector_jacobian(*this,
+                                       field_vectors,
+                                       id,
+                                       jacobian_vector);
   }
 
 protected:
-  // Map to indicate on which variables the model depends on
-  std::map<field, bool> model_depends_on;
+  // Array to indicate on which variables the model depends on
+  std::array<bool, n_fields> model_depends_on;
 };
 
 #endif
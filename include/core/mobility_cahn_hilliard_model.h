@@ -106,7 +106,7 @@ public:
    * @param[out] property_vector Vectors of the mobility values
    */
   void
-  vector_value(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  vector_value(const FieldVectors & /*field_vectors*/,
                std::vector<double> &property_vector) override
   {
     std::fill(property_vector.begin(),
@@ -141,10 +141,9 @@ public:
    * mobility with respect to the field id.
    */
   void
-  vector_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override
+  vector_jacobian(const FieldVectors & /*field_vectors*/,
+                  const field /*id*/,
+                  std::vector<double> &jacobian_vector) override
   {
     std::fill(jacobian_vector.begin(), jacobian_vector.end(), 0);
   }
@@ -222,15 +221,14 @@ public:
    * @param[out] property_vector Vector of the mobility values.
    */
   void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
+  vector_value(const FieldVectors  &field_vectors,
                std::vector<double> &property_vector) override
   {
     AssertThrow(
-      field_vectors.find(field::phase_order_cahn_hilliard) !=
-        field_vectors.end(),
+      field_vectors.is_defined(field::phase_order_cahn_hilliard),
       PhysicialPropertyModelFieldUndefined("MobilityCahnHilliardModelQuartic",
                                            "phase_order_cahn_hilliard"));
-    const std::vector<double> &phase_order_cahn_hilliard =
+    const ArrayView<const double> &phase_order_cahn_hilliard =
       field_vectors.at(field::phase_order_cahn_hilliard);
     for (unsigned int i = 0; i < property_vector.size(); ++i)
       {
@@ -284,16 +282,15 @@ public:
    */
 
   void
-  vector_jacobian(const std::map<field, std::vector<double>> &field_vectors,
+  vector_jacobian(const FieldVectors &field_vectors,
                   const field /*id*/,
                   std::vector<double> &jacobian_vector) override
   {
     AssertThrow(
-      field_vectors.find(field::phase_order_cahn_hilliard) !=
-        field_vectors.end(),
+      field_vectors.is_defined(field::phase_order_cahn_hilliard),
       PhysicialPropertyModelFieldUndefined("MobilityCahnHilliardModelQuartic",
                                            "phase_order_cahn_hilliard"));
-    const std::vector<double> &phase_order_cahn_hilliard =
+    const ArrayView<const double> &phase_order_cahn_hilliard =
       field_vectors.at(field::phase_order_cahn_hilliard);
     for (unsigned int i = 0; i < jacobian_vector.size(); ++i)
       jacobian_vector[i] =
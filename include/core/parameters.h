@@ -117,6 +117,13 @@ namespace Parameters
     // Max time step
     double max_dt;
 
+    // Min time step (DEM adaptative time stepping)
+    double min_dt;
+
+    // Max growth of the normal overlap during a time step relative to the
+    // diameter of the particles (DEM adaptative time stepping)
+    double max_normal_overlap_growth_ratio;
+
     // Aimed tolerance at which simulation is stopped
     double stop_tolerance;
 
@@ -1071,6 +1078,25 @@ namespace Parameters
     unsigned int phase_cahn_hilliard_order;
     unsigned int potential_cahn_hilliard_order;
 
+    // Cache the shape functions of the affine cells for the assembly of the
+    // matrix-based Navier-Stokes solvers
+    bool enable_shape_data_cache;
+
+    // Evaluate the residual of the matrix-based Navier-Stokes solvers with the
+    // matrix-free operator, while the jacobian remains a sparse matrix
+    bool enable_matrix_free_residual;
+
+    // Fuse the BDF and core assemblers of the matrix-based Navier-Stokes
+    // solvers into a single loop over the quadrature points
+    bool enable_fused_assembly;
+
+    // Number of threads used by each process, in particular by the assembly
+    unsigned int number_of_assembly_threads;
+
+    // Assemble the matrix-based physics with a coloring of the cells, which
+    // allows the concurrent copy of the local contributions
+    bool enable_colored_assembly;
+
     static void
     declare_parameters(ParameterHandler &prm);
     void
@@ -1138,6 +1164,12 @@ namespace Parameters
     // Carry jacobian matrix over to the new non-linear problem
     bool reuse_matrix;
 
+    // Maximal number of consecutive non-linear problems that share the same
+    // jacobian matrix when it is carried over. Once this number is reached,
+    // the matrix is reassembled at the first iteration of the next non-linear
+    // problem. A value of 0 means that there is no limit.
+    unsigned int reuse_matrix_max_steps;
+
     // Reuse preconditioner for the next non-linear iterations
     bool reuse_preconditioner;
 
@@ -1194,7 +1226,9 @@ namespace Parameters
       ilu,
       amg,
       lsmg,
-      gcmg
+      gcmg,
+      jacobi,
+      schur
     };
     PreconditionerType preconditioner;
 
@@ -1234,9 +1268,19 @@ namespace Parameters
     /// AMG Smoother overalp
     unsigned int amg_smoother_overlap;
 
+    /// Keep the aggregation hierarchy of the AMG between its set ups
+    bool amg_reuse_hierarchy;
+
     /// Block linear solver to throw error.
     bool force_linear_solver_continuation;
 
+    /// Keep the preconditioners of the block solver between the linear solves
+    bool block_preconditioner_reuse;
+
+    /// Relative change of the linearization velocity or of the time step
+    /// above which the preconditioner of the velocity block is rebuilt
+    double block_velocity_preconditioner_tolerance;
+
     /// MG min level
     int mg_min_level;
 
@@ -1249,6 +1293,25 @@ namespace Parameters
     /// MG enable hessians in jacobian
     bool mg_enable_hessians_jacobian;
 
+    /// MG use single precision for the level operators, smoothers and
+    /// transfers
+    bool mg_use_single_precision;
+
+    /// MG level from which the operators recompute the linearization data at
+    /// the quadrature points on the fly instead of storing it
+    int mg_recompute_linearization_level;
+
+    /// MG reuse the eigenvalue estimates of the smoother
+    bool mg_reuse_eigenvalue_estimates;
+
+    /// MG reuse the coarse-grid solver
+    bool mg_reuse_coarse_grid_solver;
+
+    /// MG maximum ratio between the number of outer iterations and the number
+    /// of iterations after the last full set up before rebuilding the reused
+    /// components
+    double mg_reuse_max_iterations_ratio;
+
     /// Type of multigrid
     enum class MultigridCoarseningSequenceType
     {
@@ -1273,7 +1336,8 @@ namespace Parameters
     enum class MultigridSmootherPreconditionerType
     {
       InverseDiagonal,
-      AdditiveSchwarzMethod
+      AdditiveSchwarzMethod,
+      VertexPatch
     };
     MultigridSmootherPreconditionerType mg_smoother_preconditioner_type;
 
@@ -1463,6 +1527,10 @@ namespace Parameters
     // elements equal to the maximum number of elements.
     bool mesh_controller_is_enabled;
 
+    // Print the reuse of the matrix structure and the time spent in the setup
+    // of the degrees of freedom after every mesh adaptation
+    Verbosity verbosity;
+
     static void
     declare_parameters(ParameterHandler &prm);
     void
@@ -235,6 +235,34 @@ namespace Parameters
     parse_parameters(ParameterHandler &prm, const Dimensionality dimensions);
   };
 
+  /**
+   * @brief MultiphysicsCoupling - Defines the parameters of the fixed-point
+   * iterations that couple the fluid dynamics with the auxiliary physics that
+   * are solved after it within a time step.
+   */
+  struct MultiphysicsCoupling
+  {
+    // Maximal number of coupling iterations. A single iteration solves each
+    // physics once, without coupling iterations.
+    unsigned int max_iterations;
+
+    // Relative change of the coupled solutions below which the coupling
+    // iterations have converged
+    double tolerance;
+
+    // Number of previous iterations used by the Anderson acceleration. The
+    // coupling iterations are plain Picard iterations if it is zero.
+    unsigned int anderson_depth;
+
+    // Type of verbosity for the coupling iterations
+    Parameters::Verbosity verbosity;
+
+    void
+    declare_parameters(ParameterHandler &prm);
+    void
+    parse_parameters(ParameterHandler &prm);
+  };
+
   /**
    * @brief Multiphysics - the parameters for multiphysics simulations
    * and handles sub-physics parameters.
@@ -251,8 +279,9 @@ namespace Parameters
     bool viscous_dissipation;
     bool buoyancy_force;
 
-    Parameters::VOF          vof_parameters;
-    Parameters::CahnHilliard cahn_hilliard_parameters;
+    Parameters::VOF                  vof_parameters;
+    Parameters::CahnHilliard         cahn_hilliard_parameters;
+    Parameters::MultiphysicsCoupling coupling_parameters;
 
     void
     declare_parameters(ParameterHandler &prm);
@@ -20,6 +20,10 @@
 #include <core/parameters.h>
 #include <core/simulation_control.h>
 
+#include <deal.II/base/array_view.h>
+
+#include <array>
+
 using namespace dealii;
 
 DeclExceptionMsg(
@@ -59,17 +63,141 @@ enum field : int
   levelset
 };
 
+/**
+ * @brief Number of fields on which a physical property can depend. The
+ * levelset must remain the last field of the enum.
+ */
+constexpr unsigned int n_fields = field::levelset + 1;
+
+/**
+ * @brief Values of the fields at multiple points (generally the quadrature
+ * points of a cell) used to evaluate the physical properties. Each field is a
+ * view on a buffer owned by the caller, usually a scratch data, and is indexed
+ * by the field enum. Contrary to a std::map<field, std::vector<double>>,
+ * setting or accessing a field neither copies the values nor allocates memory,
+ * which matters since the properties are evaluated on every cell of the
+ * assembly. The buffers must outlive the views and must not be resized while
+ * the views are in use.
+ */
+class FieldVectors
+{
+public:
+  /**
+   * @brief Default constructor, for which no field is defined.
+   */
+  FieldVectors()
+  {
+    defined.fill(false);
+  }
+
+  /**
+   * @brief Construct views on the vectors of a map of fields. This allows the
+   * physical property models to be evaluated with a map, which is convenient
+   * outside of the assembly (e.g. in the unit tests).
+   *
+   * @param[in] field_map Values of the fields. The map must outlive this
+   * object.
+   */
+  FieldVectors(const std::map<field, std::vector<double>> &field_map)
+    : FieldVectors()
+  {
+    for (const auto &[id, values] : field_map)
+      set(id, values);
+  }
+
+  /**
+   * @brief Define a field by a view on its values.
+   *
+   * @param[in] id Identifier of the field.
+   * @param[in] values View on the values of the field.
+   */
+  inline void
+  set(const field id, const ArrayView<const double> &values)
+  {
+    views[id]   = values;
+    defined[id] = true;
+  }
+
+  /**
+   * @brief Returns true if the field has been defined, false if not.
+   *
+   * @param[in] id Identifier of the field.
+   */
+  inline bool
+  is_defined(const field id) const
+  {
+    return defined[id];
+  }
+
+  /**
+   * @brief Returns a view on the values of a field.
+   *
+   * @param[in] id Identifier of the field, which must be defined.
+   */
+  inline const ArrayView<const double> &
+  at(const field id) const
+  {
+    Assert(defined[id],
+           ExcMessage("The field " + std::to_string(id) +
+                      " is not defined."));
+    return views[id];
+  }
+
+private:
+  // Views on the values of each field
+  std::array<ArrayView<const double>, n_fields> views;
+
+  // Indicates if each field has been defined
+  std::array<bool, n_fields> defined;
+};
+
+/**
+ * @brief Calculate the derivative of a property with respect to a field at
+ * multiple points with a forward finite difference (Euler) approximation.
+ * Only the perturbed field is copied, in buffers reused by all the calls of a
+ * thread, so that no memory is allocated once the buffers are large enough.
+ *
+ * @tparam ModelType Type of the property model, which must provide a
+ * vector_value function.
+ * @param[in] model Property model.
+ * @param[in] field_vectors Values of the fields used to evaluate the property.
+ * @param[in] id Identifier of the field with respect to which the derivative
+ * is calculated.
+ * @param[out] jacobian_vector Derivative of the property at each point.
+ */
+template <typename ModelType>
 inline void
-set_field_vector(const field                          &id,
-                 const std::vector<double>            &data,
-                 std::map<field, std::vector<double>> &fields)
+forward_difference_vector_jacobian(ModelType           &model,
+                                   const FieldVectors  &field_vectors,
+                                   const field          id,
+                                   std::vector<double> &jacobian_vector)
 {
-  std::vector<double> &target = fields.at(id);
-  size_t               sz     = target.size();
-  for (size_t i = 0; i < sz; ++i)
-    {
-      target[i] = data[i];
-    }
+  const unsigned int n_pts = jacobian_vector.size();
+
+  thread_local std::vector<double> f_x;
+  thread_local std::vector<double> f_xdx;
+  thread_local std::vector<double> x_dx;
+  f_x.resize(n_pts);
+  f_xdx.resize(n_pts);
+  x_dx.resize(n_pts);
+
+  // Evaluate the properties using the values of the field vector
+  model.vector_value(field_vectors, f_x);
+
+  // Perturb the field by dx, the other fields are not copied
+  const ArrayView<const double> &x = field_vectors.at(id);
+  for (unsigned int i = 0; i < n_pts; ++i)
+    x_dx[i] = x[i] + std::max(1e-6 * x[i], 1e-8);
+
+  FieldVectors perturbed_field_vectors = field_vectors;
+  perturbed_field_vectors.set(id, x_dx);
+
+  // Evaluate the properties using the perturbed value of the field vector
+  model.vector_value(perturbed_field_vectors, f_xdx);
+
+  // Fill jacobian
+  for (unsigned int i = 0; i < n_pts; ++i)
+    jacobian_vector[i] = (f_xdx[i] - f_x[i]) / std::max(1e-6 * x[i], 1e-8);
 }
 
 /**
@@ -78,10 +206,11 @@ set_field_vector(const field                          &id,
  * value of a physical property or a vector of physical property value for
  * given field value. By default, the interface does not require that all (or
  * any) fields be specified. This is why a map is used to pass the dependent
- * variable. To allow for the calculation of the appropriate jacobian matrix
- * (when that is necessary) the interface also provides a jacobian function,
- * which must provide the derivative with respect to the field specified as an
- * argument.
+ * variable of a single point, while the values at multiple points are passed
+ * through the FieldVectors views. To allow for the calculation of the
+ * appropriate jacobian matrix (when that is necessary) the interface also
+ * provides a jacobian function, which must provide the derivative with respect
+ * to the field specified as an argument.
  */
 class PhysicalPropertyModel
 {
@@ -91,13 +220,7 @@ public:
    */
   PhysicalPropertyModel()
   {
-    model_depends_on[shear_rate]                = false;
-    model_depends_on[temperature]               = false;
-    model_depends_on[temperature_p1]            = false;
-    model_depends_on[temperature_p2]            = false;
-    model_depends_on[pressure]                  = false;
-    model_depends_on[phase_order_cahn_hilliard] = false;
-    model_depends_on[levelset]                  = false;
+    model_depends_on.fill(false);
   }
 
   /**
@@ -124,8 +247,8 @@ public:
    * @param field_vectors
    */
   virtual void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
-               std::vector<double>                        &property_vector) = 0;
+  vector_value(const FieldVectors  &field_vectors,
+               std::vector<double> &property_vector) = 0;
 
   /**
    * @brief jacobian Calcualtes the jacobian (the partial derivative) of the physical
@@ -147,8 +270,8 @@ public:
    */
 
   virtual void
-  vector_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                  const field                                 id,
+  vector_jacobian(const FieldVectors  &field_vectors,
+                  const field          id,
                   std::vector<double> &jacobian_vector) = 0;
 
   /**
@@ -196,37 +319,14 @@ public:
    * @return
    */
   inline void
-  vector_numerical_jacobian(
-    const std::map<field, std::vector<double>> &field_vectors,
-    const field                                 id,
-    std::vector<double>                        &jacobian_vector)
+  vector_numerical_jacobian(const FieldVectors  &field_vectors,
+                            const field          id,
+                            std::vector<double> &jacobian_vector)
   {
-    const unsigned int n_pts = jacobian_vector.size();
-
-    // Evaluate the properties using the values of the field vector
-    std::vector<double> f_x(n_pts);
-    vector_value(field_vectors, f_x);
-
-    // Make a copy of the field vector for the field we wil perturbate
-    std::map<field, std::vector<double>> perturbed_field_vectors =
-      field_vectors;
-    std::vector<double> &x = perturbed_field_vectors.at(id);
-    std::vector<double>  dx(n_pts);
-
-    // Perturb the field by dx
-    for (unsigned int i = 0; i < n_pts; ++i)
-      {
-        dx[i] = std::max(1e-6 * x[i], 1e-8);
-        x[i] += dx[i];
-      }
-
-    // Evaluate the properties using the perturbed value of the field vector
-    std::vector<double> f_xdx(n_pts);
-    vector_value(perturbed_field_vectors, f_xdx);
-
-    // Fill jacobian
-    for (unsigned int i = 0; i < n_pts; ++i)
-      jacobian_vector[i] = (f_xdx[i] - f_x[i]) / dx[i];
+    forward_difference_vector_jacobian(*this,
+                                       field_vectors,
+                                       id,
+                                       jacobian_vector);
   }
 
 protected:
@@ -237,8 +337,8 @@ protected:
     return simulation_control;
   }
 
-  // Map to indicate on which variables the model depends on
-  std::map<field, bool> model_depends_on;
+  // Array to indicate on which variables the model depends on
+  std::array<bool, n_fields> model_depends_on;
 
 private:
   // SimulationControl object. This can be used to set time-dependent
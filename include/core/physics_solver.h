@@ -62,6 +62,22 @@ public:
   virtual void
   setup_preconditioner() = 0;
 
+  /**
+   * @brief Indicate if the last assembled system matrix no longer corresponds
+   * to the current problem, for example because the degrees of freedom or the
+   * time step have changed since its assembly. Non-linear solvers that carry
+   * the matrix over to the next non-linear problem reassemble it when this
+   * function returns true. By default, the matrix is never considered
+   * outdated.
+   *
+   * @return Boolean that is true if the system matrix must be reassembled.
+   */
+  virtual bool
+  system_matrix_is_outdated()
+  {
+    return false;
+  }
+
   /**
    * @brief solve_linear_system Solves the linear system of equations
    *
@@ -119,10 +119,9 @@ public:
    * depend on.
    */
   virtual void
-  get_dynamic_viscosity_vector(
-    const double                               &p_density_ref,
-    const std::map<field, std::vector<double>> &field_vectors,
-    std::vector<double>                        &property_vector) = 0;
+  get_dynamic_viscosity_vector(const double        &p_density_ref,
+                               const FieldVectors  &field_vectors,
+                               std::vector<double> &property_vector) = 0;
 
   /**
    * @brief Calculates the kinematic viscosity used in PSPG and SUPG stabilization terms.
@@ -144,8 +143,8 @@ public:
    */
   virtual void
   get_kinematic_viscosity_for_stabilization_vector(
-    const std::map<field, std::vector<double>> &field_vectors,
-    std::vector<double>                        &property_vector)
+    const FieldVectors  &field_vectors,
+    std::vector<double> &property_vector)
   {
     vector_value(field_vectors, property_vector);
   }
@@ -173,9 +172,9 @@ public:
    */
   virtual void
   get_dynamic_viscosity_for_stabilization_vector(
-    const double                               &p_density_ref,
-    const std::map<field, std::vector<double>> &field_vectors,
-    std::vector<double>                        &property_vector)
+    const double        &p_density_ref,
+    const FieldVectors  &field_vectors,
+    std::vector<double> &property_vector)
   {
     get_dynamic_viscosity_vector(p_density_ref, field_vectors, property_vector);
   }
@@ -242,7 +241,7 @@ public:
    * may depend on. These are not used for the constant kinematic viscosity
    */
   void
-  vector_value(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  vector_value(const FieldVectors & /*field_vectors*/,
                std::vector<double> &property_vector) override
   {
     std::fill(property_vector.begin(),
@@ -281,10 +280,9 @@ public:
    */
 
   void
-  vector_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override
+  vector_jacobian(const FieldVectors & /*field_vectors*/,
+                  const field /*id*/,
+                  std::vector<double> &jacobian_vector) override
   {
     std::fill(jacobian_vector.begin(), jacobian_vector.end(), 0);
   }
@@ -344,10 +342,9 @@ public:
    * depend on. These are not used for the constant kinematic viscosity.
    */
   void
-  get_dynamic_viscosity_vector(
-    const double & /*p_density_ref*/,
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    std::vector<double> &property_vector) override
+  get_dynamic_viscosity_vector(const double & /*p_density_ref*/,
+                               const FieldVectors & /*field_vectors*/,
+                               std::vector<double> &property_vector) override
   {
     std::fill(property_vector.begin(),
               property_vector.end(),
@@ -397,7 +394,7 @@ public:
    * may depend on. The power-law kinematic viscosity depends on the shear rate.
    */
   void
-  vector_value(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  vector_value(const FieldVectors & /*field_vectors*/,
                std::vector<double> &property_vector) override;
 
   /**
@@ -427,10 +424,9 @@ public:
    */
 
   void
-  vector_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override;
+  vector_jacobian(const FieldVectors & /*field_vectors*/,
+                  const field /*id*/,
+                  std::vector<double> &jacobian_vector) override;
 
   double
   get_n() const override
@@ -489,14 +485,13 @@ public:
    * depend on.
    */
   void
-  get_dynamic_viscosity_vector(
-    const double                               &p_density_ref,
-    const std::map<field, std::vector<double>> &field_vectors,
-    std::vector<double>                        &property_vector) override
+  get_dynamic_viscosity_vector(const double        &p_density_ref,
+                               const FieldVectors  &field_vectors,
+                               std::vector<double> &property_vector) override
   {
-    AssertThrow(field_vectors.find(field::shear_rate) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::shear_rate),
                 PhysicialPropertyModelFieldUndefined("PowerLaw", "shear_rate"));
-    const std::vector<double> &shear_rate_magnitude =
+    const ArrayView<const double> &shear_rate_magnitude =
       field_vectors.at(field::shear_rate);
 
     for (unsigned int i = 0; i < property_vector.size(); ++i)
@@ -569,7 +564,7 @@ public:
    * on. The power-law viscosity depends on the shear rate.
    */
   void
-  vector_value(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  vector_value(const FieldVectors & /*field_vectors*/,
                std::vector<double> &property_vector) override;
 
   /**
@@ -598,10 +593,9 @@ public:
    */
 
   void
-  vector_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override;
+  vector_jacobian(const FieldVectors & /*field_vectors*/,
+                  const field /*id*/,
+                  std::vector<double> &jacobian_vector) override;
 
   double
   get_n() const override
@@ -653,14 +647,13 @@ public:
    * depend on.
    */
   void
-  get_dynamic_viscosity_vector(
-    const double                               &p_density_ref,
-    const std::map<field, std::vector<double>> &field_vectors,
-    std::vector<double>                        &property_vector) override
+  get_dynamic_viscosity_vector(const double        &p_density_ref,
+                               const FieldVectors  &field_vectors,
+                               std::vector<double> &property_vector) override
   {
-    AssertThrow(field_vectors.find(field::shear_rate) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::shear_rate),
                 PhysicialPropertyModelFieldUndefined("Carreau", "shear_rate"));
-    const std::vector<double> &shear_rate_magnitude =
+    const ArrayView<const double> &shear_rate_magnitude =
       field_vectors.at(field::shear_rate);
 
     for (unsigned int i = 0; i < property_vector.size(); ++i)
@@ -678,6 +671,23 @@ private:
                       (n - 1) / a);
   }
 
+  /**
+   * @brief Calculates the derivative of the kinematic viscosity with respect
+   * to the shear rate magnitude. The shear rate is bounded from below to
+   * avoid a singular derivative when a < 1.
+   *
+   * @param[in] shear_rate_magnitude Magnitude of the shear rate.
+   */
+  inline double
+  calculate_derivative(const double shear_rate_magnitude) const
+  {
+    const double lambda_shear_rate =
+      lambda * std::max(shear_rate_magnitude, 1e-8);
+    return (kinematic_viscosity_0 - kinematic_viscosity_inf) * (n - 1) *
+           lambda * std::pow(lambda_shear_rate, a - 1) *
+           std::pow(1.0 + std::pow(lambda_shear_rate, a), (n - 1 - a) / a);
+  }
+
   double kinematic_viscosity_0;
   double kinematic_viscosity_inf;
   double lambda;
@@ -741,7 +751,7 @@ public:
    * may depend on. These are not used for the constant kinematic viscosity.
    */
   void
-  vector_value(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  vector_value(const FieldVectors & /*field_vectors*/,
                std::vector<double> &property_vector) override;
 
   /**
@@ -771,10 +781,9 @@ public:
    */
 
   void
-  vector_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override;
+  vector_jacobian(const FieldVectors & /*field_vectors*/,
+                  const field /*id*/,
+                  std::vector<double> &jacobian_vector) override;
 
   /**
    * @brief Returns the kinematic viscosity scale.
@@ -804,15 +813,14 @@ public:
    * depend on.
    */
   void
-  get_dynamic_viscosity_vector(
-    const double                               &p_density_ref,
-    const std::map<field, std::vector<double>> &field_vectors,
-    std::vector<double>                        &property_vector) override
+  get_dynamic_viscosity_vector(const double        &p_density_ref,
+                               const FieldVectors  &field_vectors,
+                               std::vector<double> &property_vector) override
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined("PhaseChangeRheology",
                                                      "temperature"));
-    const std::vector<double> &temperature =
+    const ArrayView<const double> &temperature =
       field_vectors.at(field::temperature);
 
     for (unsigned int i = 0; i < property_vector.size(); ++i)
@@ -836,7 +844,7 @@ public:
    */
   void
   get_kinematic_viscosity_for_stabilization_vector(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
+    const FieldVectors & /*field_vectors*/,
     std::vector<double> &property_vector) override;
 
   /**
@@ -860,7 +868,7 @@ public:
   virtual void
   get_dynamic_viscosity_for_stabilization_vector(
     const double &p_density_ref,
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
+    const FieldVectors & /*field_vectors*/,
     std::vector<double> &property_vector) override;
 
 private:
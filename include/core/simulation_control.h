@@ -550,11 +550,70 @@ public:
  */
 class SimulationControlTransientDEM : public SimulationControlTransient
 {
+protected:
+  // Minimal time step. The adaptative time step can go below the time step
+  // given in the parameter file, down to this value, when the overlaps grow
+  // quickly.
+  double min_dt;
+
+  // Maximal growth of the normal overlap during a time step relative to the
+  // diameter of the particles
+  double max_normal_overlap_growth_ratio;
+
+  // Largest growth of the normal overlap during the last time step relative to
+  // the diameter of the particles in contact. It must be set by the solver.
+  double normal_overlap_growth_ratio;
+
+  // Rayleigh time step of the particles. It must be set by the solver, a
+  // value of zero disables the corresponding bound.
+  double rayleigh_time_step;
+
+  /**
+   * @brief Calculates the next value of the time step. If adaptation is
+   * enabled, the time step is increased by adaptative_time_step_scaling unless
+   * the particle CFL (displacement of the particles during a time step
+   * relative to their diameter) or the growth of the normal overlap during a
+   * time step relative to the diameter of the particles would surpass their
+   * maximal value. The time step is bound between the minimal and the maximal
+   * time step, and never exceeds max_rayleigh_time_step_fraction times the
+   * Rayleigh time step.
+   */
+  virtual double
+  calculate_time_step() override;
+
 public:
+  // Largest fraction of the Rayleigh time step allowed for the time step
+  static constexpr double max_rayleigh_time_step_fraction = 0.15;
+
   SimulationControlTransientDEM(const Parameters::SimulationControl &param);
 
   virtual void
   print_progression(const ConditionalOStream &pcout) override;
+
+  /**
+   * @brief Set the largest growth of the normal overlap during the last time
+   * step relative to the diameter of the particles in contact.
+   *
+   * @param p_normal_overlap_growth_ratio Value of the ratio calculated by the
+   * solver.
+   */
+  void
+  set_normal_overlap_growth_ratio(const double p_normal_overlap_growth_ratio)
+  {
+    normal_overlap_growth_ratio = p_normal_overlap_growth_ratio;
+  }
+
+  /**
+   * @brief Set the Rayleigh time step of the particles, which bounds the
+   * adaptative time step.
+   *
+   * @param p_rayleigh_time_step Rayleigh time step calculated by the solver.
+   */
+  void
+  set_rayleigh_time_step(const double p_rayleigh_time_step)
+  {
+    rayleigh_time_step = p_rayleigh_time_step;
+  }
 };
 
 class SimulationControlTransientDynamicOutput
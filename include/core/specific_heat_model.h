@@ -90,7 +90,7 @@ public:
    * heat remains constant.
    */
   void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
+  vector_value(const FieldVectors  &field_vectors,
                std::vector<double> &property_vector) override
   {
     (void)field_vectors;
@@ -142,8 +142,8 @@ public:
    *
    */
   void
-  vector_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                  const field                                 id,
+  vector_jacobian(const FieldVectors  &field_vectors,
+                  const field          id,
                   std::vector<double> &jacobian_vector) override
   {
     (void)field_vectors;
@@ -288,25 +288,23 @@ public:
    * @param[out] property_vector Vectors of computed specific heat values.
    */
   void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
+  vector_value(const FieldVectors  &field_vectors,
                std::vector<double> &property_vector) override
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined("PhaseChangeSpecificHeat",
                                                      "temperature"));
-    AssertThrow(field_vectors.find(field::temperature_p1) !=
-                  field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature_p1),
                 PhysicialPropertyModelFieldUndefined("PhaseChangeSpecificHeat",
                                                      "temperature_p1"));
-    AssertThrow(field_vectors.find(field::temperature_p2) !=
-                  field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature_p2),
                 PhysicialPropertyModelFieldUndefined("PhaseChangeSpecificHeat",
                                                      "temperature_p2"));
-    const std::vector<double> &temperature_vec =
+    const ArrayView<const double> &temperature_vec =
       field_vectors.at(field::temperature);
-    const std::vector<double> &p1_temperature_vec =
+    const ArrayView<const double> &p1_temperature_vec =
       field_vectors.at(field::temperature_p1);
-    const std::vector<double> &p2_temperature_vec =
+    const ArrayView<const double> &p2_temperature_vec =
       field_vectors.at(field::temperature_p2);
 
     const unsigned int n_values = temperature_vec.size();
@@ -425,11 +423,11 @@ public:
    * heat with respect to the field of the specified @p id.
    */
   void
-  vector_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                  const field                                 id,
+  vector_jacobian(const FieldVectors  &field_vectors,
+                  const field          id,
                   std::vector<double> &jacobian_vector) override
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined(
                   "EvaporationModelTemperature", "temperature"));
     vector_numerical_jacobian(field_vectors, id, jacobian_vector);
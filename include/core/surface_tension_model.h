@@ -89,7 +89,7 @@ public:
    * @param property_vector Vectors of the surface tension coefficient values
    */
   void
-  vector_value(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  vector_value(const FieldVectors & /*field_vectors*/,
                std::vector<double> &property_vector) override
   {
     std::fill(property_vector.begin(),
@@ -125,10 +125,9 @@ public:
    * tension coefficient with respect to the field id.
    */
   void
-  vector_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override
+  vector_jacobian(const FieldVectors & /*field_vectors*/,
+                  const field /*id*/,
+                  std::vector<double> &jacobian_vector) override
   {
     std::fill(jacobian_vector.begin(), jacobian_vector.end(), 0);
   }
@@ -185,13 +184,13 @@ public:
    * @param property_vector Vectors of the surface tension coefficient values
    */
   void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
+  vector_value(const FieldVectors  &field_vectors,
                std::vector<double> &property_vector) override
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined("SurfaceTensionLinear",
                                                      "temperature"));
-    const std::vector<double> &temperature =
+    const ArrayView<const double> &temperature =
       field_vectors.at(field::temperature);
     for (unsigned int i = 0; i < property_vector.size(); ++i)
       property_vector[i] = surface_tension_coefficient +
@@ -228,10 +227,9 @@ public:
    * tension coefficient with respect to the field id.
    */
   void
-  vector_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field          id,
-    std::vector<double> &jacobian_vector) override
+  vector_jacobian(const FieldVectors & /*field_vectors*/,
+                  const field          id,
+                  std::vector<double> &jacobian_vector) override
   {
     if (id == field::temperature)
       std::fill(jacobian_vector.begin(),
@@ -310,13 +308,13 @@ public:
    * @param property_vector Vectors of the surface tension coefficient values.
    */
   void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
+  vector_value(const FieldVectors  &field_vectors,
                std::vector<double> &property_vector) override
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined(
                   "SurfaceTensionPhaseChange", "temperature"));
-    const std::vector<double> &temperature =
+    const ArrayView<const double> &temperature =
       field_vectors.at(field::temperature);
     for (unsigned int i = 0; i < property_vector.size(); ++i)
       if (temperature[i] < T_solidus)
@@ -381,17 +379,17 @@ public:
    * tension coefficient with respect to the field id.
    */
   void
-  vector_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                  const field                                 id,
+  vector_jacobian(const FieldVectors  &field_vectors,
+                  const field          id,
                   std::vector<double> &jacobian_vector) override
   {
     if (id == field::temperature)
       {
         AssertThrow(
-          field_vectors.find(field::temperature) != field_vectors.end(),
+          field_vectors.is_defined(field::temperature),
           PhysicialPropertyModelFieldUndefined("SurfaceTensionPhaseChange",
                                                "temperature"));
-        const std::vector<double> &temperature =
+        const ArrayView<const double> &temperature =
           field_vectors.at(field::temperature);
         for (unsigned int i = 0; i < jacobian_vector.size(); ++i)
           if (temperature[i] < T_solidus)
@@ -70,7 +70,7 @@ public:
    * @param property_vector Values of the thermal conductivities
    */
   void
-  vector_value(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  vector_value(const FieldVectors & /*field_vectors*/,
                std::vector<double> &property_vector) override
   {
     property_vector.assign(property_vector.size(), thermal_conductivity);
@@ -99,10 +99,9 @@ public:
    */
 
   void
-  vector_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override
+  vector_jacobian(const FieldVectors & /*field_vectors*/,
+                  const field /*id*/,
+                  std::vector<double> &jacobian_vector) override
   {
     std::fill(jacobian_vector.begin(), jacobian_vector.end(), 0);
   };
@@ -148,13 +147,13 @@ public:
    * @param property_vector Values of the thermal conductivities
    */
   void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
+  vector_value(const FieldVectors  &field_vectors,
                std::vector<double> &property_vector) override
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined(
                   "ThermalConductivityLinear", "temperature"));
-    const std::vector<double> &T = field_vectors.at(field::temperature);
+    const ArrayView<const double> &T = field_vectors.at(field::temperature);
     for (unsigned int i = 0; i < property_vector.size(); ++i)
       property_vector[i] = A + B * T[i];
   }
@@ -182,10 +181,9 @@ public:
    */
 
   void
-  vector_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override
+  vector_jacobian(const FieldVectors & /*field_vectors*/,
+                  const field /*id*/,
+                  std::vector<double> &jacobian_vector) override
   {
     std::fill(jacobian_vector.begin(), jacobian_vector.end(), B);
   };
@@ -253,13 +251,13 @@ public:
    * @param property_vector Values of the thermal conductivities
    */
   void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
+  vector_value(const FieldVectors  &field_vectors,
                std::vector<double> &property_vector) override
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined(
                   "ThermalConductivityPhaseChange", "temperature"));
-    const std::vector<double> &T = field_vectors.at(field::temperature);
+    const ArrayView<const double> &T = field_vectors.at(field::temperature);
     for (unsigned int i = 0; i < property_vector.size(); ++i)
       {
         // Thermal conductivity of solid phase
@@ -309,14 +307,28 @@ public:
    */
 
   void
-  vector_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                  const field                                 id,
+  vector_jacobian(const FieldVectors  &field_vectors,
+                  const field          id,
                   std::vector<double> &jacobian_vector) override
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    if (id != field::temperature)
+      {
+        std::fill(jacobian_vector.begin(), jacobian_vector.end(), 0);
+        return;
+      }
+
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined(
                   "ThermalConductivityPhaseChange", "temperature"));
-    vector_numerical_jacobian(field_vectors, id, jacobian_vector);
+    const ArrayView<const double> &T = field_vectors.at(field::temperature);
+
+    // The thermal conductivity varies linearly with the liquid fraction,
+    // which varies linearly between the solidus and the liquidus
+    const double slope = (thermal_conductivity_l - thermal_conductivity_s) /
+                         (T_liquidus - T_solidus);
+    for (unsigned int i = 0; i < jacobian_vector.size(); ++i)
+      jacobian_vector[i] =
+        (T[i] < T_solidus || T[i] > T_liquidus) ? 0. : slope;
   };
 
 private:
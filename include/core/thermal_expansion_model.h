@@ -68,7 +68,7 @@ public:
    * @param property_vector Vectors of the thermal expansion values
    */
   void
-  vector_value(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  vector_value(const FieldVectors & /*field_vectors*/,
                std::vector<double> &property_vector) override
   {
     std::fill(property_vector.begin(),
@@ -99,10 +99,9 @@ public:
    */
 
   void
-  vector_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override
+  vector_jacobian(const FieldVectors & /*field_vectors*/,
+                  const field /*id*/,
+                  std::vector<double> &jacobian_vector) override
   {
     std::fill(jacobian_vector.begin(), jacobian_vector.end(), 0);
   };
@@ -149,13 +148,13 @@ public:
    * @param property_vector Values of the thermal expansion coefficients
    */
   void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
+  vector_value(const FieldVectors  &field_vectors,
                std::vector<double> &property_vector) override
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined(
                   "ThermalExpansionPhaseChange", "temperature"));
-    const std::vector<double> &T = field_vectors.at(field::temperature);
+    const ArrayView<const double> &T = field_vectors.at(field::temperature);
     for (unsigned int i = 0; i < property_vector.size(); ++i)
       {
         // Thermal expansion of solid phase
@@ -197,11 +196,11 @@ public:
    */
 
   void
-  vector_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                  const field                                 id,
+  vector_jacobian(const FieldVectors  &field_vectors,
+                  const field          id,
                   std::vector<double> &jacobian_vector) override
   {
-    AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::temperature),
                 PhysicialPropertyModelFieldUndefined(
                   "ThermalExpansionPhaseChange", "temperature"));
     vector_numerical_jacobian(field_vectors, id, jacobian_vector);
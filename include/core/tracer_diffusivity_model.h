@@ -67,7 +67,7 @@ public:
    * @param property_vector Vectors of the tracer diffusivity values
    */
   void
-  vector_value(const std::map<field, std::vector<double>> & /*field_vectors*/,
+  vector_value(const FieldVectors & /*field_vectors*/,
                std::vector<double> &property_vector) override
   {
     std::fill(property_vector.begin(),
@@ -98,10 +98,9 @@ public:
    */
 
   void
-  vector_jacobian(
-    const std::map<field, std::vector<double>> & /*field_vectors*/,
-    const field /*id*/,
-    std::vector<double> &jacobian_vector) override
+  vector_jacobian(const FieldVectors & /*field_vectors*/,
+                  const field /*id*/,
+                  std::vector<double> &jacobian_vector) override
   {
     std::fill(jacobian_vector.begin(), jacobian_vector.end(), 0);
   };
@@ -166,14 +165,15 @@ public:
    * @param[out] property_vector Vectors of computed diffusivities.
    */
   void
-  vector_value(const std::map<field, std::vector<double>> &field_vectors,
+  vector_value(const FieldVectors  &field_vectors,
                std::vector<double> &property_vector) override
   {
-    AssertThrow(field_vectors.find(field::levelset) != field_vectors.end(),
+    AssertThrow(field_vectors.is_defined(field::levelset),
                 PhysicialPropertyModelFieldUndefined(
                   "TanhLevelsetTracerDiffusivity", "levelset"));
 
-    const std::vector<double> &levelset_vec = field_vectors.at(field::levelset);
+    const ArrayView<const double> &levelset_vec =
+      field_vectors.at(field::levelset);
 
     const unsigned int n_values = levelset_vec.size();
 
@@ -229,13 +229,13 @@ public:
    * diffusivity with respect to the field of the specified @p id.
    */
   void
-  vector_jacobian(const std::map<field, std::vector<double>> &field_vectors,
-                  const field                                 id,
+  vector_jacobian(const FieldVectors  &field_vectors,
+                  const field          id,
                   std::vector<double> &jacobian_vector) override
   {
     if (id == field::levelset)
       {
-        AssertThrow(field_vectors.find(field::levelset) != field_vectors.end(),
+        AssertThrow(field_vectors.is_defined(field::levelset),
                     PhysicialPropertyModelFieldUndefined(
                       "TanhLevelsetTracerDiffusivity", "levelset"));
         vector_numerical_jacobian(field_vectors, id, jacobian_vector);
@@ -17,6 +17,7 @@
 #ifndef lethe_utilities_h
 #define lethe_utilities_h
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/conditional_ostream.h>
 #include <deal.II/base/table_handler.h>
 #include <deal.II/base/tensor.h>
@@ -622,12 +623,12 @@ compute_cell_diameter(const double cell_measure, const unsigned int fe_degree)
  *
  * @tparam dim Number of spatial dimensions (2D or 3D).
  *
- * @param[in] JxW_values Vector of mapped quadrature weights.
+ * @param[in] JxW_values Mapped quadrature weights.
  *
  * @return Area (2D) volume (3D) of the cell.
  */
 inline double
-compute_cell_measure_with_JxW(const std::vector<double> &JxW_values)
+compute_cell_measure_with_JxW(const ArrayView<const double> &JxW_values)
 {
   double cell_measure = 0;
   for (const double &JxW : JxW_values)
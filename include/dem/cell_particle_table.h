@@ -0,0 +1,103 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+#ifndef lethe_cell_particle_table_h
+#define lethe_cell_particle_table_h
+
+#include <deal.II/base/array_view.h>
+
+#include <deal.II/grid/tria.h>
+
+#include <deal.II/particles/particle_handler.h>
+
+#include <utility>
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief Flat table of the ids of the particles (locally owned and ghost)
+ * located in each active cell of the triangulation.
+ *
+ * The ids are stored contiguously cell after cell and the range of each cell
+ * is given by the prefix sum of the number of particles in the cells, indexed
+ * by the active cell index. The table is built once per contact search, after
+ * the particles are sorted into the cells and the ghost particles are
+ * exchanged. The broad searches then read contiguous ranges of ids instead of
+ * creating a particle iterator range for every pair of cells they visit.
+ *
+ * @tparam dim Spatial dimension
+ */
+template <int dim>
+class CellParticleTable
+{
+public:
+  /**
+   * @brief Build the table from the locally owned and ghost particles of the
+   * particle handler. The order of the particles within a cell is the order
+   * in which they are stored in the particle handler.
+   *
+   * @param particle_handler The particle handler of the particles.
+   */
+  void
+  build(const Particles::ParticleHandler<dim> &particle_handler);
+
+  /**
+   * @brief Return the ids of the particles located in a cell.
+   *
+   * @param cell The active cell.
+   *
+   * @return A view on the ids of the particles in the cell. The view is
+   * empty if the cell holds no particle.
+   */
+  inline ArrayView<const types::particle_index>
+  particles_in_cell(
+    const typename Triangulation<dim>::active_cell_iterator &cell) const
+  {
+    const unsigned int cell_index = cell->active_cell_index();
+
+    // Cells with an index beyond the last cell holding particles are empty
+    if (cell_index + 1 >= cell_offsets.size())
+      return {};
+
+    return ArrayView<const types::particle_index>(
+      particle_ids.data() + cell_offsets[cell_index],
+      cell_offsets[cell_index + 1] - cell_offsets[cell_index]);
+  }
+
+private:
+  /**
+   * @brief Offset of the first particle of each cell in particle_ids. The
+   * particles of the cell with active index i are stored between
+   * cell_offsets[i] and cell_offsets[i + 1].
+   */
+  std::vector<unsigned int> cell_offsets;
+
+  /**
+   * @brief Ids of the particles sorted by cell.
+   */
+  std::vector<types::particle_index> particle_ids;
+
+  /**
+   * @brief Active cell index and id of every particle gathered before the
+   * counting sort. It is kept as a member to reuse its memory from one build
+   * to the next.
+   */
+  std::vector<std::pair<unsigned int, types::particle_index>>
+    cell_index_and_particle_id;
+};
+
+#endif
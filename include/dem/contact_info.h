@@ -24,18 +24,52 @@
 
 using namespace dealii;
 
+namespace DEM
+{
+  /**
+   * @brief Floating point type used to store the per-contact quantities of the
+   * contact containers: the history of the contacts (tangential overlaps) and,
+   * for the particle-wall contacts, the normal overlap and the relative
+   * velocities that are stored between the update of the contact and the force
+   * calculation. These quantities are only ever used as magnitudes or as
+   * increments on top of double precision quantities, so they can be stored in
+   * single precision. All the arithmetic is carried out in double precision.
+   *
+   * The geometric members of the contacts (normal vectors, points on the
+   * boundaries and periodic offsets) remain in double precision since they are
+   * combined with the particle locations. With a 24 bytes particle iterator,
+   * this shrinks a particle-wall contact from 144 to 112 bytes and a
+   * particle-particle contact by 8 bytes (88 to 80 bytes in 2D, 96 to 88 bytes
+   * in 3D).
+   *
+   * LETHE_DEM_MIXED_PRECISION is defined using the CMake flag
+   * -DLETHE_DEM_MIXED_PRECISION=ON
+   */
+#ifdef LETHE_DEM_MIXED_PRECISION
+  using contact_history_number = float;
+#else
+  using contact_history_number = double;
+#endif
+} // namespace DEM
+
 /**
  * @brief Handle the information related to the calculation of the
  * particle-particle contact force. Notably it is responsible for storing
  * information that has to be preserved over multiple iterations of a contact,
- * namely everything related to tangential overlaps
+ * namely everything related to tangential overlaps.
+ *
+ * Periodic contacts are stored in the same containers as the regular contacts.
+ * The periodic offset is the translation that is subtracted from the location
+ * of particle two to obtain its periodic image next to particle one. It is
+ * zero for contacts that do not cross a periodic boundary.
  */
 template <int dim>
 struct particle_particle_contact_info
 {
-  Particles::ParticleIterator<dim> particle_one;
-  Particles::ParticleIterator<dim> particle_two;
-  Tensor<1, 3>                     tangential_overlap;
+  Particles::ParticleIterator<dim>          particle_one;
+  Particles::ParticleIterator<dim>          particle_two;
+  Tensor<1, 3, DEM::contact_history_number> tangential_overlap;
+  Tensor<1, dim>                            periodic_offset;
 };
 
 template <int dim>
@@ -66,9 +100,9 @@ public:
     , normal_vector(normal_vector)
     , point_on_boundary(point_on_boundary)
     , boundary_id(boundary_id)
+    , tangential_overlap({0, 0, 0})
     , normal_overlap(0)
     , normal_relative_velocity(0)
-    , tangential_overlap({0, 0, 0})
     , tangential_relative_velocity({0, 0, 0})
   {}
 
@@ -85,20 +119,22 @@ public:
     , normal_vector({0, 0, 0})
     , point_on_boundary({0, 0, 0})
     , boundary_id(0)
+    , tangential_overlap({0, 0, 0})
     , normal_overlap(0)
     , normal_relative_velocity(0)
-    , tangential_overlap({0, 0, 0})
     , tangential_relative_velocity({0, 0, 0})
   {}
 
-  Particles::ParticleIterator<dim> particle;
-  Tensor<1, 3>                     normal_vector;
-  Point<3>                         point_on_boundary;
-  types::boundary_id               boundary_id;
-  double                           normal_overlap;
-  double                           normal_relative_velocity;
-  Tensor<1, 3>                     tangential_overlap;
-  Tensor<1, 3>                     tangential_relative_velocity;
+  Particles::ParticleIterator<dim>          particle;
+  Tensor<1, 3>                              normal_vector;
+  Point<3>                                  point_on_boundary;
+  types::boundary_id                        boundary_id;
+  // The tangential overlap is stored next to the boundary id such that, in
+  // single precision, the two fill 16 bytes without padding
+  Tensor<1, 3, DEM::contact_history_number> tangential_overlap;
+  DEM::contact_history_number               normal_overlap;
+  DEM::contact_history_number               normal_relative_velocity;
+  Tensor<1, 3, DEM::contact_history_number> tangential_relative_velocity;
 };
 
 /**
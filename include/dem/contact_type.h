@@ -24,9 +24,6 @@ enum ContactType
 {
   local_particle_particle,
   ghost_particle_particle,
-  local_periodic_particle_particle,
-  ghost_periodic_particle_particle,
-  ghost_local_periodic_particle_particle,
   particle_wall,
   particle_floating_wall,
   particle_floating_mesh,
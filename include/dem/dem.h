@@ -165,6 +165,16 @@ private:
   inline void
   check_contact_search_iteration_dynamic();
 
+  /**
+   * @brief Compute the criteria of the adaptative time stepping, the particle
+   * CFL (displacement of the particles during a time step relative to their
+   * diameter) and the largest ratio between the normal overlap and the
+   * diameter of the particles in contact, and give them to the simulation
+   * control.
+   */
+  void
+  update_adaptative_time_step_criteria();
+
   /**
    * @brief Check if particles have to be inserted at this iteration and
    * perform it if necessary.
@@ -334,6 +344,14 @@ private:
    */
   std::shared_ptr<SimulationControl> simulation_control;
 
+  /**
+   * @brief The simulation control, with its transient DEM type. It points to
+   * the same object as simulation_control and is used to give the criteria of
+   * the adaptative time stepping.
+   */
+  std::shared_ptr<SimulationControlTransientDEM>
+    transient_dem_simulation_control;
+
   /**
    * @brief The boundary cells object.
    */
@@ -403,7 +421,7 @@ private:
 
   /**
    * @brief The displacement tracking of particles for the dynamic contact
-   * detection.
+   * detection. It is updated by the integrator.
    */
   std::vector<double> displacement;
 
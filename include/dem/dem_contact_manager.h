@@ -21,6 +21,7 @@
 
 #include <dem/adaptive_sparse_contacts.h>
 #include <dem/boundary_cells_info_struct.h>
+#include <dem/cell_particle_table.h>
 #include <dem/data_containers.h>
 #include <dem/find_boundary_cells_information.h>
 #include <dem/find_cell_neighbors.h>
@@ -130,10 +131,12 @@ public:
    *
    * Calls proper functions to find the candidates of local and ghost
    * particle-particle contact pairs and the periodic particle-particle contacts
-   * if required. These contact pairs will be used in the fine search step to
-   * investigate if they are in contact.
+   * if required. The periodic pairs are stored in the local and ghost
+   * candidates containers. These contact pairs will be used in the fine search
+   * step to investigate if they are in contact.
    * It checks if the adaptive sparse contacts is enabled and use proper
-   * functions.
+   * functions. The table of the particles in each cell used by all the
+   * particle-particle broad searches is built once beforehand.
    *
    * @param[in,out] particle_handler Storage of particles and their accessor
    * functions.
@@ -279,33 +282,6 @@ public:
     return ghost_adjacent_particles;
   }
 
-  /**
-   * @brief Return the local-local periodic particle contact container.
-   */
-  inline typename dem_data_structures<dim>::adjacent_particle_pairs &
-  get_local_local_periodic_adjacent_particles()
-  {
-    return local_local_periodic_adjacent_particles;
-  }
-
-  /**
-   * @brief Return the local-ghost periodic particle contact container.
-   */
-  inline typename dem_data_structures<dim>::adjacent_particle_pairs &
-  get_local_ghost_periodic_adjacent_particles()
-  {
-    return local_ghost_periodic_adjacent_particles;
-  }
-
-  /**
-   * @brief Return the ghost-local periodic particle contact container.
-   */
-  inline typename dem_data_structures<dim>::adjacent_particle_pairs &
-  get_ghost_local_periodic_adjacent_particles()
-  {
-    return ghost_local_periodic_adjacent_particles;
-  }
-
   /**
    * @brief Return the local particle-particle contact candidates.
    */
@@ -344,19 +320,15 @@ private:
   typename dem_data_structures<dim>::cells_neighbor_list
     cells_ghost_local_periodic_neighbor_list;
 
+  // Table of the ids of the local and ghost particles in each cell, built at
+  // every particle-particle broad search
+  CellParticleTable<dim> cell_particle_table;
+
   // Container with all collision candidate particles within adjacent cells
   typename dem_data_structures<dim>::particle_particle_candidates
     local_contact_pair_candidates;
   typename dem_data_structures<dim>::particle_particle_candidates
     ghost_contact_pair_candidates;
-  typename dem_data_structures<dim>::particle_particle_candidates
-    ghost_local_contact_pair_candidates;
-  typename dem_data_structures<dim>::particle_particle_candidates
-    local_contact_pair_periodic_candidates;
-  typename dem_data_structures<dim>::particle_particle_candidates
-    ghost_contact_pair_periodic_candidates;
-  typename dem_data_structures<dim>::particle_particle_candidates
-    ghost_local_contact_pair_periodic_candidates;
   typename dem_data_structures<dim>::particle_floating_mesh_candidates
     particle_floating_mesh_candidates;
   typename dem_data_structures<dim>::particle_floating_wall_candidates
@@ -383,17 +355,12 @@ private:
 
 
   // Container with all the contact information of adjacent
-  // local/ghost-local for pairwise contact force calculation
+  // local/ghost-local for pairwise contact force calculation. Periodic
+  // contacts are stored in these containers with their periodic offset
   typename dem_data_structures<dim>::adjacent_particle_pairs
     local_adjacent_particles;
   typename dem_data_structures<dim>::adjacent_particle_pairs
     ghost_adjacent_particles;
-  typename dem_data_structures<dim>::adjacent_particle_pairs
-    local_local_periodic_adjacent_particles;
-  typename dem_data_structures<dim>::adjacent_particle_pairs
-    local_ghost_periodic_adjacent_particles;
-  typename dem_data_structures<dim>::adjacent_particle_pairs
-    ghost_local_periodic_adjacent_particles;
 
   // Containers with other information
   typename DEM::dem_data_structures<dim>::cell_vector periodic_cells_container;
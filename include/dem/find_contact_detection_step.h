@@ -28,33 +28,26 @@ using namespace dealii;
 
 /**
  * @brief Find steps for dynamic contact search for particle-particle contacts.
+ * The displacement of the particles is accumulated by the integrator during
+ * the integration of the particle motion, so only the maximal displacement is
+ * required here.
  *
- * @param particle_handler
- * @param dt DEM time step
+ * @param max_displacement Maximal displacement of the locally owned particles
+ * since the last contact search
  * @param smallest_contact_search_criterion A criterion for finding
  * dynamic contact search steps. This value is defined as the minimum of
  * particle-particle and particle-wall displacement threshold values
  * @param mpi_communicator
- * @param displacement Displacement of particles since last sorting step
  * @param parallel_update Update the identification of the contact detection
- * step in parallel. If this parameter is set to false, the distance will be
- * calculated but the
- * logical OR statement won't be called and a false value will be returned. In
- * essence, this will only update the displacement.
- *
- * @return Returns true if the maximum cumulative displacement of particles
- * exceeds the threshold and false otherwise
-
+ * step in parallel. If this parameter is set to false, the logical OR
+ * statement won't be called and no contact search will be triggered.
  */
-template <int dim>
 void
 find_particle_contact_detection_step(
-  Particles::ParticleHandler<dim> &particle_handler,
-  const double                     dt,
-  const double                     smallest_contact_search_criterion,
-  MPI_Comm                        &mpi_communicator,
-  std::vector<double>             &displacement,
-  const bool                       parallel_update = true);
+  const double max_displacement,
+  const double smallest_contact_search_criterion,
+  MPI_Comm    &mpi_communicator,
+  const bool   parallel_update = true);
 
 /**
  * @brief Find steps for dynamic contact search in particle-floating
@@ -20,6 +20,24 @@
 #include <dem/dem_solver_parameters.h>
 #include <dem/distributions.h>
 
+/**
+ * @brief Calculate the Rayleigh time step, which is the smallest over the
+ * particle types of the time taken by a Rayleigh wave to travel across the
+ * smallest particle of the type.
+ *
+ * @param physical_properties Lagrangian physical properties of the particles
+ * @param size_distribution_object_container Contain all the types of distribution
+ * being used for each type of particle.
+ *
+ * @return Rayleigh time step
+ */
+double
+calculate_rayleigh_time_step(
+  const Parameters::Lagrangian::LagrangianPhysicalProperties
+    &physical_properties,
+  const std::vector<std::shared_ptr<Distribution>>
+    &size_distribution_object_container);
+
 /**
  * @brief Check input parameters in the parameter handler to be in the
  * correct range. Warnings or error would appear if the parameters are not in
@@ -24,6 +24,9 @@
 
 #include <deal.II/particles/particle_handler.h>
 
+#include <algorithm>
+#include <vector>
+
 using namespace dealii;
 
 /**
@@ -94,6 +97,74 @@ public:
             const std::vector<double>                       &MOI,
             const parallel::distributed::Triangulation<dim> &triangulation,
             AdaptiveSparseContacts<dim> &sparse_contacts_object) = 0;
+
+  /**
+   * @brief Enable the tracking of the displacement of the particles for the
+   * dynamic contact detection. The displacement of each particle is updated
+   * in the same loop as its velocity and location, which removes the need for
+   * a separate loop over the particles to identify the contact search steps.
+   *
+   * @param particle_displacement Container of the displacement of the
+   * particles since the last contact search, indexed by the local index of
+   * the particles. It must outlive the integrator.
+   */
+  void
+  set_displacement_container(std::vector<double> &particle_displacement)
+  {
+    displacement = &particle_displacement;
+  }
+
+  /**
+   * @brief Reset the displacement of the particles and the maximal
+   * displacement. This is called at every contact search step.
+   */
+  void
+  reset_displacement()
+  {
+    if (displacement != nullptr)
+      std::fill(displacement->begin(), displacement->end(), 0.);
+    maximum_displacement = 0.;
+  }
+
+  /**
+   * @brief Return the maximal displacement of the locally owned particles
+   * since the last call to reset_displacement().
+   */
+  double
+  get_maximum_displacement() const
+  {
+    return maximum_displacement;
+  }
+
+protected:
+  /**
+   * @brief Increment the displacement of a particle and update the maximal
+   * displacement of the particles.
+   *
+   * @param particle_id Local index of the particle
+   * @param distance Distance travelled by the particle during the time step
+   */
+  inline void
+  update_displacement(const types::particle_index particle_id,
+                      const double                distance)
+  {
+    double &particle_displacement = (*displacement)[particle_id];
+    particle_displacement += distance;
+    maximum_displacement =
+      std::max(maximum_displacement, particle_displacement);
+  }
+
+  /**
+   * @brief Displacement of the particles since the last contact search. The
+   * displacement is not tracked if this pointer is null.
+   */
+  std::vector<double> *displacement = nullptr;
+
+  /**
+   * @brief Maximal displacement of the locally owned particles since the last
+   * contact search.
+   */
+  double maximum_displacement = 0.;
 };
 
 #endif
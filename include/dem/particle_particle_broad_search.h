@@ -18,6 +18,7 @@
 #define lethe_particle_particle_broad_search_h
 
 #include <dem/adaptive_sparse_contacts.h>
+#include <dem/cell_particle_table.h>
 #include <dem/contact_info.h>
 #include <dem/data_containers.h>
 #include <dem/find_boundary_cells_information.h>
@@ -33,8 +34,9 @@
  * candidate particle-particle collision pairs. These collision pairs will be
  * used in the fine search to investigate if they are in contact or not.
  *
- * @param[in] particle_handler The particle handler of particles in the broad
- * search
+ * @param[in] cell_particle_table The table of the ids of the particles
+ * located in each cell. It must be built after the particles are sorted into
+ * the cells.
  * @param[in] cells_local_neighbor_list  A vector (with size equal to the number
  * of local cells) of vectors. Each sub-vector have a size equal to the number
  * of adjacent local cells plus one. First element of each sub-vector shows the
@@ -53,7 +55,7 @@
 template <int dim>
 void
 find_particle_particle_contact_pairs(
-  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const CellParticleTable<dim> &cell_particle_table,
   const typename DEM::dem_data_structures<dim>::cells_neighbor_list
     &cells_local_neighbor_list,
   const typename DEM::dem_data_structures<dim>::cells_neighbor_list
@@ -70,8 +72,9 @@ find_particle_particle_contact_pairs(
  * This version of the function is used when adaptive sparse contacts is
  * enabled.
  *
- * @param particle_handler The particle handler of particles in the broad
- * search
+ * @param cell_particle_table The table of the ids of the particles
+ * located in each cell. It must be built after the particles are sorted into
+ * the cells.
  * @param[in] cells_local_neighbor_list  A vector (with size equal to the number
  * of local cells) of vectors. Each sub-vector have a size equal to the number
  * of adjacent local cells of the main cell plus one. The first element of each
@@ -89,7 +92,7 @@ find_particle_particle_contact_pairs(
 template <int dim>
 void
 find_particle_particle_contact_pairs(
-  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const CellParticleTable<dim> &cell_particle_table,
   const typename DEM::dem_data_structures<dim>::cells_neighbor_list
     &cells_local_neighbor_list,
   const typename DEM::dem_data_structures<dim>::cells_neighbor_list
@@ -101,12 +104,16 @@ find_particle_particle_contact_pairs(
   const AdaptiveSparseContacts<dim> &sparse_contacts_object);
 
 /**
- * @brief Finds vectors of pairs (particle_particle_candidates) which contains the
- * candidate particle-particle collision pairs. These collision pairs will be
- * used in the fine search to investigate if they are in contact or not.
+ * @brief Finds the candidate particle-particle collision pairs across the
+ * periodic boundaries. The pairs are appended to the candidates containers of
+ * the regular broad search, hence this function must be called after
+ * find_particle_particle_contact_pairs. The periodic image of the pairs is
+ * resolved in the fine search, so a single contact container is used for the
+ * regular and periodic contacts.
  *
- * @param[in] particle_handler The particle handler of particles in the broad
- * search.
+ * @param[in] cell_particle_table The table of the ids of the particles
+ * located in each cell. It must be built after the particles are sorted into
+ * the cells.
  * @param[in] cells_local_periodic_neighbor_list A vector (with size equal to
  * the number of local periodic cells at boundary 0) of vectors. Each sub-vector
  * have a size equal to the number of adjacent local cells of the main cell plus
@@ -115,23 +122,24 @@ find_particle_particle_contact_pairs(
  * the number of local periodic cells at boundary 0) of vectors. Each sub-vector
  * have a size equal to the number of adjacent ghost cells of the main cell plus
  * one. The first element of each sub-vector shows the main cell itself.
- * @param[out] local_contact_pair_periodic_candidates Ankerl unordered dense
- * map. Stores potential pairs of local-local periodic particles in contact.
- * Keys are local particle ids at boundary 0 and mapped types are vectors of
- * local particle ids at boundary 1.
- * @param[out] ghost_contact_pair_periodic_candidates Ankerl unordered dense
- * map. Stores potential pairs of local-ghost periodic particles in contact.
- * Keys are local particle ids at boundary 0 and mapped types are vectors of
- * ghost particle ids at boundary 1.
- * @param[out] ghost_local_contact_pair_periodic_candidates Ankerl unordered
- * dense map. Stores potential pairs of local-ghost periodic particles in
- * contact. Keys are ghost at boundary 0 particle ids and mapped types are
- * vectors of local particle ids at boundary 1.
+ * @param[in] cells_ghost_local_periodic_neighbor_list A vector (with size
+ * equal to the number of ghost periodic cells at boundary 0) of vectors. Each
+ * sub-vector have a size equal to the number of adjacent local cells of the
+ * main cell plus one. The first element of each sub-vector shows the main cell
+ * itself.
+ * @param[in,out] local_contact_pair_candidates Ankerl unordered dense map.
+ * The local-local periodic pairs are appended to it. Keys are local particle
+ * ids at boundary 0 and mapped types are vectors of local particle ids at
+ * boundary 1.
+ * @param[in,out] ghost_contact_pair_candidates Ankerl unordered dense map.
+ * The local-ghost and ghost-local periodic pairs are appended to it. Keys are
+ * always local particle ids and mapped types are vectors of ghost particle
+ * ids on the opposite periodic boundary.
  */
 template <int dim>
 void
 find_particle_particle_periodic_contact_pairs(
-  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const CellParticleTable<dim> &cell_particle_table,
   const typename DEM::dem_data_structures<dim>::cells_neighbor_list
     &cells_local_periodic_neighbor_list,
   const typename DEM::dem_data_structures<dim>::cells_neighbor_list
@@ -139,21 +147,23 @@ find_particle_particle_periodic_contact_pairs(
   const typename DEM::dem_data_structures<dim>::cells_neighbor_list
     &cells_ghost_local_periodic_neighbor_list,
   typename DEM::dem_data_structures<dim>::particle_particle_candidates
-    &local_contact_pair_periodic_candidates,
-  typename DEM::dem_data_structures<dim>::particle_particle_candidates
-    &ghost_contact_pair_periodic_candidates,
+    &local_contact_pair_candidates,
   typename DEM::dem_data_structures<dim>::particle_particle_candidates
-    &ghost_local_contact_pair_periodic_candidates);
+    &ghost_contact_pair_candidates);
 
 /**
- * @brief Finds a vector of pairs (particle_particle_candidates) which contains the
- * candidate particle-particle collision pairs. These collision pairs will be
- * used in the fine search to investigate if they are in contact or not.
+ * @brief Finds the candidate particle-particle collision pairs across the
+ * periodic boundaries. The pairs are appended to the candidates containers of
+ * the regular broad search, hence this function must be called after
+ * find_particle_particle_contact_pairs. The periodic image of the pairs is
+ * resolved in the fine search, so a single contact container is used for the
+ * regular and periodic contacts.
  * This version of the function is used when adaptive sparse contacts is
  * enabled.
  *
- * @param[in] particle_handler The particle handler of particles in the broad
- * search.
+ * @param[in] cell_particle_table The table of the ids of the particles
+ * located in each cell. It must be built after the particles are sorted into
+ * the cells.
  * @param[in] cells_local_periodic_neighbor_list A vector (with size equal to
  * the number of local periodic cells at boundary 0) of vectors. Each sub-vector
  * have a size equal to the number of adjacent local cells of the main cell plus
@@ -162,25 +172,26 @@ find_particle_particle_periodic_contact_pairs(
  * the number of local periodic cells at boundary 0) of vectors. Each sub-vector
  * have a size equal to the number of adjacent ghost cells of the main cell plus
  * one. The first element of each sub-vector shows the main cell itself.
- * @param[out] local_contact_pair_periodic_candidates Ankerl unordered dense
- * map. Stores potential pairs of local-local periodic particles in contact.
- * Keys are local particle ids at boundary 0 and mapped types are vectors of
- * local particle ids at boundary 1.
- * @param[out] ghost_contact_pair_periodic_candidates Ankerl unordered dense
- * map. Stores potential pairs of local-ghost periodic particles in contact.
- * Keys are local particle ids at boundary 0 and mapped types are vectors of
- * ghost particle ids at boundary 1.
- * @param[out] ghost_local_contact_pair_periodic_candidates Ankerl unordered
- * dense map. Stores potential pairs of local-ghost periodic particles in
- * contact. Keys are ghost at boundary 0 particle ids and mapped types are
- * vectors of local particle ids at boundary 1.
+ * @param[in] cells_ghost_local_periodic_neighbor_list A vector (with size
+ * equal to the number of ghost periodic cells at boundary 0) of vectors. Each
+ * sub-vector have a size equal to the number of adjacent local cells of the
+ * main cell plus one. The first element of each sub-vector shows the main cell
+ * itself.
+ * @param[in,out] local_contact_pair_candidates Ankerl unordered dense map.
+ * The local-local periodic pairs are appended to it. Keys are local particle
+ * ids at boundary 0 and mapped types are vectors of local particle ids at
+ * boundary 1.
+ * @param[in,out] ghost_contact_pair_candidates Ankerl unordered dense map.
+ * The local-ghost and ghost-local periodic pairs are appended to it. Keys are
+ * always local particle ids and mapped types are vectors of ghost particle
+ * ids on the opposite periodic boundary.
  * @param sparse_contacts_object The object that contains the
  * information about the mobility status of cells
  */
 template <int dim>
 void
 find_particle_particle_periodic_contact_pairs(
-  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const CellParticleTable<dim> &cell_particle_table,
   const typename DEM::dem_data_structures<dim>::cells_neighbor_list
     &cells_local_periodic_neighbor_list,
   const typename DEM::dem_data_structures<dim>::cells_neighbor_list
@@ -188,36 +199,32 @@ find_particle_particle_periodic_contact_pairs(
   const typename DEM::dem_data_structures<dim>::cells_neighbor_list
     &cells_ghost_local_periodic_neighbor_list,
   typename DEM::dem_data_structures<dim>::particle_particle_candidates
-    &local_contact_pair_periodic_candidates,
+                                    &local_contact_pair_candidates,
   typename DEM::dem_data_structures<dim>::particle_particle_candidates
-    &ghost_contact_pair_periodic_candidates,
-  typename DEM::dem_data_structures<dim>::particle_particle_candidates
-    &ghost_local_contact_pair_periodic_candidates,
+                                    &ghost_contact_pair_candidates,
   const AdaptiveSparseContacts<dim> &sparse_contacts_object);
 
 /**
  * @brief Stores the candidate particle-particle collision pairs with a given
- * particle iterator. particle_begin iterator is useful to skip storage of the
- * first particle in main cell (particle_begin will be the iterator after the
+ * particle id. particle_begin is useful to skip storage of the first particle
+ * in main cell (particle_begin will be the one after
  * particles_to_evaluate.begin() in that case). When particle_begin is
- * particles_to_evaluate.begin(), it stores all the particle id in
+ * particles_to_evaluate.begin(), it stores all the particle ids in
  * contact_pair_candidates.
  *
  * @param main_particle_id The id of the main particle to store the candidate.
- * @param particle_begin The particle iterator to start storing particle ids.
- * @param particles_to_evaluate The particle range to evaluate with the
- * particle iterator prior storing ids.
+ * @param particle_begin The position in particles_to_evaluate from which the
+ * particle ids are stored.
+ * @param particles_to_evaluate The contiguous range of particle ids of a cell.
  * @param contact_pair_candidates A map which will contain all the particle
  * pairs candidate.
  */
 template <int dim>
 inline void
 store_candidates(
-  const types::particle_index &main_particle_id,
-  const typename dealii::Particles::ParticleHandler<
-    dim>::particle_iterator_range::iterator &particle_begin,
-  const typename dealii::Particles::ParticleHandler<
-    dim>::particle_iterator_range &particles_to_evaluate,
+  const types::particle_index                            &main_particle_id,
+  const ArrayView<const types::particle_index>::iterator &particle_begin,
+  const ArrayView<const types::particle_index>           &particles_to_evaluate,
   typename DEM::dem_data_structures<dim>::particle_particle_candidates
     &contact_pair_candidates);
 
@@ -53,18 +53,11 @@ public:
    *
    * @param local_adjacent_particles Container of the contact pair candidates
    * information for calculation of the local particle-particle contact forces.
+   * Periodic contacts are stored in the local and ghost containers with their
+   * periodic offset.
    * @param ghost_adjacent_particles Container of the contact pair candidates
    * information for calculation of the local-ghost particle-particle contact
    * forces.
-   * @param local_local_periodic_adjacent_particles Container of the contact pair
-   * candidates information for calculation of the local periodic
-   * particle-particle contact forces.
-   * @param local_ghost_periodic_adjacent_particles Container of the contact pair
-   * candidates information for calculation of the local-ghost periodic
-   * particle-particle contact forces.
-   * @param ghost_local_periodic_adjacent_particles Container of the contact pair
-   * candidates information for calculation of the ghost-local periodic
-   * particle-particle contact forces.
    * @param dt DEM time step.
    * @param torque Torque acting on particles.
    * @param force Force acting on particles.
@@ -74,25 +67,29 @@ public:
     typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
       &local_adjacent_particles,
     typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
-      &ghost_adjacent_particles,
-    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
-      &local_local_periodic_adjacent_particles,
-    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
-      &local_ghost_periodic_adjacent_particles,
-    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
-                              &ghost_local_periodic_adjacent_particles,
+                              &ghost_adjacent_particles,
     const double               dt,
     std::vector<Tensor<1, 3>> &torque,
     std::vector<Tensor<1, 3>> &force) = 0;
 
-  void
-  set_periodic_offset(const Tensor<1, dim> &periodic_offset)
+  /**
+   * @brief Return the largest growth of the normal overlap during a time step
+   * relative to the average diameter of the particles in contact found during
+   * the last calculation of the contact forces. It is used by the adaptative
+   * time stepping.
+   */
+  double
+  get_max_normal_overlap_growth_ratio() const
   {
-    this->periodic_offset = periodic_offset;
+    return max_normal_overlap_growth_ratio;
   }
 
 protected:
-  Tensor<1, dim> periodic_offset;
+  /**
+   * @brief Largest growth of the normal overlap during a time step relative to
+   * the average diameter of the particles in contact.
+   */
+  double max_normal_overlap_growth_ratio = 0.;
 };
 
 /**
@@ -127,18 +124,11 @@ public:
    *
    * @param local_adjacent_particles Container of the contact pair candidates
    * information for calculation of the local particle-particle contact forces.
+   * Periodic contacts are stored in the local and ghost containers with their
+   * periodic offset.
    * @param ghost_adjacent_particles Container of the contact pair candidates
    * information for calculation of the local-ghost particle-particle contact
    * forces.
-   * @param local_local_periodic_adjacent_particles Container of the contact pair
-   * candidates information for calculation of the local periodic
-   * particle-particle contact forces.
-   * @param local_ghost_periodic_adjacent_particles Container of the contact pair
-   * candidates information for calculation of the local-ghost periodic
-   * particle-particle contact forces.
-   * @param ghost_local_periodic_adjacent_particles Container of the contact pair
-   * candidates information for calculation of the ghost-local periodic
-   * particle-particle contact forces.
    * @param dt DEM time step.
    * @param torque Torque acting on particles.
    * @param force Force acting on particles.
@@ -148,13 +138,7 @@ public:
     typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
       &local_adjacent_particles,
     typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
-      &ghost_adjacent_particles,
-    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
-      &local_local_periodic_adjacent_particles,
-    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
-      &local_ghost_periodic_adjacent_particles,
-    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
-                              &ghost_local_periodic_adjacent_particles,
+                              &ghost_adjacent_particles,
     const double               dt,
     std::vector<Tensor<1, 3>> &torque,
     std::vector<Tensor<1, 3>> &force) override;
@@ -268,17 +252,20 @@ protected:
 
   /**
    * @brief Get the shifted location of the particle on the periodic boundary.
+   * The offset is zero if the contact is not a periodic contact.
    *
    * @param particle The particle to get the location from.
+   * @param periodic_offset The periodic offset of the contact.
    */
   inline Point<3>
-  get_periodic_location(const Particles::ParticleIterator<dim> &particle) &
+  get_periodic_location(const Particles::ParticleIterator<dim> &particle,
+                        const Tensor<1, dim> &periodic_offset) &
   {
     if constexpr (dim == 3)
-      return (particle->get_location() - this->periodic_offset);
+      return (particle->get_location() - periodic_offset);
 
     if constexpr (dim == 2)
-      return point_nd_to_3d(particle->get_location() - this->periodic_offset);
+      return point_nd_to_3d(particle->get_location() - periodic_offset);
   }
 
   /**
@@ -1560,24 +1547,10 @@ private:
         auto particle_two            = contact_info.particle_two;
         auto particle_two_properties = particle_two->get_properties();
 
-        // Get particle 2 location
-        Point<3> particle_two_location;
-        if constexpr (contact_type == ContactType::local_particle_particle ||
-                      contact_type == ContactType::ghost_particle_particle)
-          {
-            particle_two_location = get_location(particle_two);
-          }
-
-        // Get particle 2 location in periodic boundary
-        if constexpr (contact_type ==
-                        ContactType::local_periodic_particle_particle ||
-                      contact_type ==
-                        ContactType::ghost_periodic_particle_particle ||
-                      contact_type ==
-                        ContactType::ghost_local_periodic_particle_particle)
-          {
-            particle_two_location = get_periodic_location(particle_two);
-          }
+        // Get particle 2 location, or the location of its periodic image if
+        // the contact crosses a periodic boundary
+        Point<3> particle_two_location =
+          get_periodic_location(particle_two, contact_info.periodic_offset);
 
         // Calculation of normal overlap
         double normal_overlap =
@@ -1592,88 +1565,43 @@ private:
 
         if (normal_overlap > force_calculation_threshold_distance)
           {
-            // Update of contact information and calculation of contact force
-            // are the same for all local-local and local-ghost contact.
-            // However, they are based on particle two for ghost-local periodic
-            // contact, where particle one is the ghost particle, so the order
-            // of particles given to the function are reversed.
-            if constexpr (contact_type ==
-                            ContactType::local_particle_particle ||
-                          contact_type ==
-                            ContactType::ghost_particle_particle ||
-                          contact_type ==
-                            ContactType::local_periodic_particle_particle ||
-                          contact_type ==
-                            ContactType::ghost_periodic_particle_particle)
-              {
-                // Update all the information
-                this->update_contact_information(contact_info,
-                                                 tangential_relative_velocity,
-                                                 normal_relative_velocity_value,
-                                                 normal_unit_vector,
-                                                 particle_one_properties,
-                                                 particle_two_properties,
-                                                 particle_one_location,
-                                                 particle_two_location,
-                                                 dt);
-
-                // Calculation the contact force
-                this->calculate_contact(contact_info,
-                                        tangential_relative_velocity,
-                                        normal_relative_velocity_value,
-                                        normal_unit_vector,
-                                        normal_overlap,
-                                        particle_one_properties,
-                                        particle_two_properties,
-                                        normal_force,
-                                        tangential_force,
-                                        particle_one_tangential_torque,
-                                        particle_two_tangential_torque,
-                                        rolling_resistance_torque);
-              }
-
-            if constexpr (contact_type ==
-                          ContactType::ghost_local_periodic_particle_particle)
-              {
-                // In ghost_local periodic contacts, particle one and two are
-                // swapped when calling the update_contact_information and the
-                // calculate_contact. This is because the first particle
-                // received by these functions
-                // should always be a local particle. In this case, since this
-                // is a ghost_local container, particle_two is the local
-                // particle and particle_one is a ghost particle.
-                //  Update all the information
-                this->update_contact_information(contact_info,
-                                                 tangential_relative_velocity,
-                                                 normal_relative_velocity_value,
-                                                 normal_unit_vector,
-                                                 particle_two_properties,
-                                                 particle_one_properties,
-                                                 particle_two_location,
-                                                 particle_one_location,
-                                                 dt);
-
-                // Calculation the contact force
-                this->calculate_contact(contact_info,
-                                        tangential_relative_velocity,
-                                        normal_relative_velocity_value,
-                                        normal_unit_vector,
-                                        normal_overlap,
-                                        particle_two_properties,
-                                        particle_one_properties,
-                                        normal_force,
-                                        tangential_force,
-                                        particle_two_tangential_torque,
-                                        particle_one_tangential_torque,
-                                        rolling_resistance_torque);
-              }
+            // Update all the information
+            this->update_contact_information(contact_info,
+                                             tangential_relative_velocity,
+                                             normal_relative_velocity_value,
+                                             normal_unit_vector,
+                                             particle_one_properties,
+                                             particle_two_properties,
+                                             particle_one_location,
+                                             particle_two_location,
+                                             dt);
+
+            // Track the largest growth of the overlap during a time step
+            // relative to the average diameter. A positive normal relative
+            // velocity means that the particles approach each other.
+            this->max_normal_overlap_growth_ratio =
+              std::max(this->max_normal_overlap_growth_ratio,
+                       normal_relative_velocity_value * dt /
+                         (0.5 * (particle_one_properties[PropertiesIndex::dp] +
+                                 particle_two_properties[PropertiesIndex::dp])));
+
+            // Calculation the contact force
+            this->calculate_contact(contact_info,
+                                    tangential_relative_velocity,
+                                    normal_relative_velocity_value,
+                                    normal_unit_vector,
+                                    normal_overlap,
+                                    particle_one_properties,
+                                    particle_two_properties,
+                                    normal_force,
+                                    tangential_force,
+                                    particle_one_tangential_torque,
+                                    particle_two_tangential_torque,
+                                    rolling_resistance_torque);
 
             // Apply the calculated forces and torques on both particles
             // of the pair for local-local contacts
-            if constexpr (contact_type ==
-                            ContactType::local_particle_particle ||
-                          contact_type ==
-                            ContactType::local_periodic_particle_particle)
+            if constexpr (contact_type == ContactType::local_particle_particle)
               {
                 types::particle_index particle_two_id =
                   particle_two->get_local_index();
@@ -1695,9 +1623,7 @@ private:
 
             // Apply the calculated forces and torques only on the local
             // particle of the pair for local-ghost contacts
-            if constexpr (contact_type ==
-                            ContactType::ghost_periodic_particle_particle ||
-                          contact_type == ContactType::ghost_particle_particle)
+            if constexpr (contact_type == ContactType::ghost_particle_particle)
               {
                 this->apply_force_and_torque_on_single_local_particle(
                   normal_force,
@@ -1707,26 +1633,6 @@ private:
                   particle_one_torque,
                   particle_one_force);
               }
-
-            // Apply the calculated forces and torques only on the local
-            // particle of the pair for ghost-local contacts
-            if constexpr (contact_type ==
-                          ContactType::ghost_local_periodic_particle_particle)
-              {
-                types::particle_index particle_two_id =
-                  particle_two->get_local_index();
-
-                Tensor<1, 3> &particle_two_torque = torque[particle_two_id];
-                Tensor<1, 3> &particle_two_force  = force[particle_two_id];
-
-                this->apply_force_and_torque_on_single_local_particle(
-                  normal_force,
-                  tangential_force,
-                  particle_two_tangential_torque,
-                  rolling_resistance_torque,
-                  particle_two_torque,
-                  particle_two_force);
-              }
           }
         else
           {
@@ -43,9 +43,10 @@ using namespace dealii;
  * @param contact_pair_candidates The output of broad search which shows
  * contact pair candidates
  * @param neighborhood_threshold A value which defines the neighbor particles
- * @param periodic_offset A tensor of the periodic offset to change the
- * particle location of the particles on the periodic boundary 1 side,
- * the tensor as 0.0 values by default
+ * @param periodic_offset A tensor of the periodic offset between the periodic
+ * boundaries 0 and 1. When it is non-zero, the nearest periodic image of the
+ * new candidates is used and its offset is stored in the contact information,
+ * the tensor as 0.0 values by default (no periodic boundaries)
  */
 template <int dim>
 void
@@ -119,6 +119,30 @@ public:
     return torque_on_walls;
   }
 
+  /**
+   * @brief Return the largest growth of the normal overlap during a time step
+   * relative to the diameter of the particles in contact with the walls and
+   * the floating meshes found since the last reset. It is used by the
+   * adaptative time stepping.
+   */
+  double
+  get_max_normal_overlap_growth_ratio() const
+  {
+    return max_normal_overlap_growth_ratio;
+  }
+
+  /**
+   * @brief Reset the largest growth of the normal overlap relative to the
+   * diameter of the particles. It must be called before the particle-wall
+   * contact forces of a time step are calculated, since they are calculated
+   * over several containers (walls, floating walls and floating meshes).
+   */
+  void
+  reset_max_normal_overlap_growth_ratio()
+  {
+    max_normal_overlap_growth_ratio = 0.;
+  }
+
   /**
    * @brief This function is used to find the projection of vector_a on
    * vector_b
@@ -267,6 +291,12 @@ protected:
   Point<3>                        center_mass_container;
   std::vector<types::boundary_id> boundary_index;
   const unsigned int              vertices_per_triangle = 3;
+
+  /**
+   * @brief Largest growth of the normal overlap during a time step relative to
+   * the diameter of the particles in contact with the walls.
+   */
+  double max_normal_overlap_growth_ratio = 0.;
 };
 
 #endif
@@ -72,6 +72,18 @@ public:
     sharp_edge();
   }
 
+protected:
+  /**
+   * @brief The residual is assembled by this solver, which imposes the
+   * particles through the sharp-edge constraints.
+   *
+   * @return false.
+   */
+  bool
+  matrix_free_residual_is_supported() override
+  {
+    return false;
+  }
 
 private:
   /**
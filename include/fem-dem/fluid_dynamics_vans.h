@@ -25,11 +25,13 @@
 #include <core/time_integration_utilities.h>
 
 #include <solvers/fluid_dynamics_matrix_based.h>
+#include <solvers/fluid_dynamics_matrix_free.h>
 #include <solvers/postprocessing_cfd.h>
 
 #include <dem/dem.h>
 #include <fem-dem/cfd_dem_simulation_parameters.h>
 #include <fem-dem/vans_assemblers.h>
+#include <fem-dem/vans_matrix_free_operators.h>
 
 #include <deal.II/distributed/tria.h>
 
@@ -202,6 +204,17 @@ private:
   }
 
 protected:
+  /**
+   * @brief The residual of the VANS equations is assembled by this solver.
+   *
+   * @return false.
+   */
+  bool
+  matrix_free_residual_is_supported() override
+  {
+    return false;
+  }
+
   /**
    * @brief associates the degrees of freedom to each vertex of the finite elements
    * and initialize the void fraction
@@ -234,11 +247,32 @@ protected:
   finish_time_step_fd();
 
   /**
-   *  @brief Assembles the matrix associated with the solver
+   * @brief Assembles the matrix associated with the solver. If the
+   * matrix-free path is used, the coefficients of the matrix-free operator
+   * are evaluated at the current linearization point instead.
    */
   void
   assemble_system_matrix() override;
 
+  /**
+   * @brief Set-up the appropriate preconditioner. If the matrix-free path is
+   * used, the geometric multigrid preconditioner is set up.
+   */
+  void
+  setup_preconditioner() override;
+
+  /**
+   * @brief Solve the linear system, with the matrix-free operator and the
+   * geometric multigrid preconditioner if the matrix-free path is used.
+   *
+   * @param[in] initial_step Indicates if this is the first solution of the
+   * linear system, in which case the non-zero constraints are used.
+   * @param[in] renewed_matrix Indicates if the matrix has been reassembled.
+   */
+  void
+  solve_linear_system(const bool initial_step,
+                      const bool renewed_matrix = true) override;
+
   /**
    * @brief Assembles the rhs associated with the solver
    */
@@ -319,6 +353,50 @@ protected:
   void
   percolate_void_fraction();
 
+  /**
+   * @brief Initialize the matrix-free operator and the vectors of the
+   * matrix-free path once the DoFs are distributed.
+   */
+  void
+  setup_matrix_free();
+
+  /**
+   * @brief Evaluate the coefficients of the matrix-free operator: the
+   * particle-fluid interactions of each cell, the void fraction, the
+   * linearization point, the stabilization parameters and the time
+   * derivatives of the previous solutions.
+   */
+  void
+  update_matrix_free_operator();
+
+  /**
+   * @brief Create the geometric multigrid preconditioner if needed, provide
+   * the VANS coefficients to the level operators and initialize it.
+   */
+  void
+  setup_GMG();
+
+  /**
+   * @brief Interpolate the void fraction, the stabilization velocity and the
+   * drag coefficient to the levels of the geometric multigrid preconditioner
+   * and evaluate them in the level operators.
+   *
+   * @tparam MGNumber Number type of the level operators.
+   */
+  template <typename MGNumber>
+  void
+  update_level_coefficients();
+
+  /**
+   * @brief GMRES solver with the matrix-free operator and the geometric
+   * multigrid preconditioner.
+   *
+   * @param[in] initial_step Indicates if this is the first solution of the
+   * linear system, in which case the non-zero constraints are used.
+   */
+  void
+  solve_system_matrix_free(const bool initial_step);
+
   /**
    * Member Variables
    */
@@ -359,6 +437,31 @@ protected:
   const double GLS_u_scale = 1;
   double       pressure_drop;
 
+  // Matrix-free path, used if the gcmg preconditioner is selected
+  using MFVectorType = LinearAlgebra::distributed::Vector<double>;
+
+  bool use_matrix_free;
+
+  std::shared_ptr<VANSStabilizedOperator<dim, double>>    system_operator;
+  std::shared_ptr<MFNavierStokesPreconditionGMGBase<dim>> gmg_preconditioner;
+
+  // Required by the multigrid preconditioner, FE_Q_iso_Q1 levels are not
+  // supported by the matrix-free VANS path
+  DoFHandler<dim> dof_handler_fe_q_iso_q1;
+
+  MFVectorType mf_present_solution;
+  MFVectorType mf_stabilization_solution;
+  MFVectorType mf_time_derivative_previous_solutions;
+  // The void fraction and the drag coefficient are stored in the pressure and
+  // in the first velocity components, respectively
+  MFVectorType mf_void_fraction;
+  MFVectorType mf_drag_coefficient;
+
+  // Particle-fluid interactions of each active cell
+  std::vector<double>         cell_drag_coefficient;
+  std::vector<Tensor<1, dim>> cell_particle_velocity;
+  std::vector<Tensor<1, dim>> cell_undisturbed_flow_force;
+
   bool           has_periodic_boundaries;
   Tensor<1, dim> periodic_offset;
   unsigned int   periodic_direction;
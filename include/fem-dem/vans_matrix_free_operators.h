@@ -0,0 +1,195 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------*/
+
+#ifndef lethe_vans_matrix_free_operators_h
+#define lethe_vans_matrix_free_operators_h
+
+#include <solvers/fluid_dynamics_matrix_free_operators.h>
+
+#include <fem-dem/parameters_cfd_dem.h>
+
+using namespace dealii;
+
+/**
+ * @brief Matrix-free operator of the volume-averaged Navier-Stokes (VANS)
+ * equations stabilized with SUPG/PSPG, for the model A and the model B
+ * formulations. The void fraction, its gradient and the stabilization
+ * parameters are stored at the quadrature points, while the particle-fluid
+ * interactions (drag coefficient, average particle velocity and undisturbed
+ * flow force) are stored per cell. These coefficients must be evaluated with
+ * the corresponding functions before the operator is applied. The optional
+ * grad-div stabilization of the matrix-based VANS assemblers is supported.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam number Abstract type for number across the class (i.e., double).
+ */
+template <int dim, typename number>
+class VANSStabilizedOperator : public NavierStokesOperatorBase<dim, number>
+{
+public:
+  using FECellIntegrator = FEEvaluation<dim, -1, 0, dim + 1, number>;
+  using VectorType       = LinearAlgebra::distributed::Vector<number>;
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] cfd_dem CFD-DEM parameters, which define the VANS model and
+   * the grad-div stabilization.
+   */
+  VANSStabilizedOperator(const Parameters::CFDDEM &cfd_dem);
+
+  /**
+   * @brief Store the void fraction and its gradient at the quadrature points.
+   *
+   * @param[in] void_fraction Vector with the layout of the operator whose
+   * pressure component contains the nodal values of the void fraction.
+   */
+  void
+  evaluate_void_fraction(const VectorType &void_fraction);
+
+  /**
+   * @brief Pre-calculate the SUPG/PSPG and grad-div stabilization parameters
+   * with the magnitude of the velocity of the provided solution, which is
+   * either the linearization point or the previous solution depending on the
+   * implicit stabilization parameter.
+   *
+   * @param[in] stabilization_solution Solution used to evaluate the magnitude
+   * of the velocity.
+   */
+  void
+  evaluate_stabilization_parameters(const VectorType &stabilization_solution);
+
+  /**
+   * @brief Store the drag coefficient of every cell batch as the average of
+   * a nodal field over the quadrature points, without particle velocity nor
+   * undisturbed flow force. Used by the levels of the geometric multigrid
+   * preconditioner, whose cells do not match the cells of the particles.
+   *
+   * @param[in] drag_coefficient Vector with the layout of the operator whose
+   * first velocity component contains the nodal values of the drag
+   * coefficient.
+   */
+  void
+  evaluate_drag_coefficient(const VectorType &drag_coefficient);
+
+  /**
+   * @brief Store the particle-fluid interactions of every cell. Only valid if
+   * the operator is built on the active cells of the triangulation of the
+   * particles.
+   *
+   * @param[in] beta_drag Drag coefficient of each active cell.
+   * @param[in] average_particle_velocity Average velocity of the particles of
+   * each active cell.
+   * @param[in] undisturbed_force Undisturbed flow force of each active cell,
+   * only used by the model B.
+   */
+  void
+  set_particle_fluid_interactions(
+    const std::vector<double>         &beta_drag,
+    const std::vector<Tensor<1, dim>> &average_particle_velocity,
+    const std::vector<Tensor<1, dim>> &undisturbed_force);
+
+protected:
+  /**
+   * @brief Perform cell integral on a cell batch without gathering and
+   * scattering the values, and according to the Jacobian of the stabilized
+   * VANS equations.
+   *
+   * @param[in] integrator FEEvaluation object that allows to evaluate functions
+   * at quadrature points and perform cell integrations.
+   */
+  void
+  do_cell_integral_local(FECellIntegrator &integrator) const override;
+
+  /**
+   * @brief Perform cell integral on a cell batch with gathering and scattering
+   * the values, and according to the residual of the stabilized VANS
+   * equations. The time derivative of the void fraction is not included.
+   *
+   * @param[in] matrix_free Object that contains all data.
+   * @param[in,out] dst Global vector where the final result is added.
+   * @param[in] src Input vector with all values in all cells.
+   * @param[in] range Range of the cell batch.
+   */
+  void
+  local_evaluate_residual(
+    const MatrixFree<dim, number>               &matrix_free,
+    VectorType                                  &dst,
+    const VectorType                            &src,
+    const std::pair<unsigned int, unsigned int> &range) const override;
+
+private:
+  /**
+   * @brief Allocate the tables of the particle-fluid interactions and set
+   * them to zero.
+   */
+  void
+  reset_particle_fluid_interactions();
+
+  /**
+   * @brief CFD-DEM parameters.
+   *
+   */
+  Parameters::CFDDEM cfd_dem;
+
+  /**
+   * @brief Table with correct alignment for vectorization to store the values
+   * of the void fraction.
+   *
+   */
+  Table<2, VectorizedArray<number>> void_fraction;
+
+  /**
+   * @brief Table with correct alignment for vectorization to store the
+   * gradients of the void fraction.
+   *
+   */
+  Table<2, Tensor<1, dim, VectorizedArray<number>>> void_fraction_gradient;
+
+  /**
+   * @brief Table with correct alignment for vectorization to store the values
+   * of the SUPG/PSPG stabilization parameter of the VANS equations.
+   *
+   */
+  Table<2, VectorizedArray<number>> vans_stabilization_parameter;
+
+  /**
+   * @brief Table with correct alignment for vectorization to store the values
+   * of the grad-div stabilization parameter.
+   *
+   */
+  Table<2, VectorizedArray<number>> grad_div_parameter;
+
+  /**
+   * @brief Drag coefficient of each cell batch.
+   *
+   */
+  AlignedVector<VectorizedArray<number>> drag_coefficient;
+
+  /**
+   * @brief Average velocity of the particles of each cell batch.
+   *
+   */
+  AlignedVector<Tensor<1, dim, VectorizedArray<number>>> particle_velocity;
+
+  /**
+   * @brief Undisturbed flow force of each cell batch.
+   *
+   */
+  AlignedVector<Tensor<1, dim, VectorizedArray<number>>>
+    undisturbed_flow_force;
+};
+
+#endif
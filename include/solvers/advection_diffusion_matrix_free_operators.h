@@ -0,0 +1,352 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------*/
+
+#ifndef lethe_advection_diffusion_matrix_free_operators_h
+#define lethe_advection_diffusion_matrix_free_operators_h
+
+#include <core/simulation_control.h>
+#include <core/vector.h>
+
+#include <deal.II/base/function.h>
+#include <deal.II/base/subscriptor.h>
+
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/matrix_free/tools.h>
+
+#include <functional>
+
+using namespace dealii;
+
+/**
+ * @brief Matrix-free operator of the Jacobian of the SUPG stabilized scalar
+ * advection-diffusion equation
+ * \f$ \alpha \left( \frac{\partial \phi}{\partial t} + u \cdot \nabla \phi
+ * \right) - \kappa \nabla^2 \phi = f \f$,
+ * where \f$ \alpha \f$ is the transport coefficient (e.g., \f$ \rho C_p \f$
+ * for heat transfer) and \f$ \kappa \f$ the diffusivity (e.g., the thermal
+ * conductivity). Both coefficients are assumed to be constant. The velocity
+ * field is provided by the fluid dynamics solver at the quadrature points.
+ * A compressibility term and a linearized discontinuity-capturing dissipation
+ * can be added on top of the SUPG stabilization. If no velocity is provided,
+ * the operator reduces to a stabilized mass-diffusion operator, which is used
+ * for the levels of the geometric multigrid preconditioner.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam number Abstract type for number across the class (i.e., double).
+ */
+template <int dim, typename number>
+class AdvectionDiffusionOperator : public Subscriptor
+{
+public:
+  using FECellIntegrator = FEEvaluation<dim, -1, 0, 1, number>;
+  using VectorType       = LinearAlgebra::distributed::Vector<number>;
+  using value_type       = number;
+  using size_type        = VectorizedArray<number>;
+
+  /**
+   * @brief Default constructor.
+   */
+  AdvectionDiffusionOperator();
+
+  /**
+   * @brief Initialize the main matrix free object that contains all data and
+   * is needed to perform loops over cells, and initialize relevant member
+   * variables such as the coefficients and the element size.
+   *
+   * @param[in] mapping Describes the transformations from unit to real cell.
+   * @param[in] dof_handler Describes the layout of DoFs and the type of FE.
+   * @param[in] constraints Object with constraints according to DoFs.
+   * @param[in] quadrature Required for local operations on cells.
+   * @param[in] transport_coefficient Coefficient multiplying the time
+   * derivative and the advection term.
+   * @param[in] diffusivity Coefficient multiplying the diffusion term.
+   * @param[in] enable_ggls Flag to enable the gradient-Galerkin least-squares
+   * stabilization of the time derivative.
+   * @param[in] simulation_control Required to get the time stepping method.
+   */
+  void
+  reinit(const Mapping<dim>                       &mapping,
+         const DoFHandler<dim>                    &dof_handler,
+         const AffineConstraints<number>          &constraints,
+         const Quadrature<dim>                    &quadrature,
+         const double                              transport_coefficient,
+         const double                              diffusivity,
+         const bool                                enable_ggls,
+         const std::shared_ptr<SimulationControl> &simulation_control);
+
+  /**
+   * @brief Store the velocity of the fluid at the quadrature points of the
+   * cells and pre-calculate the SUPG stabilization parameter. The fluid
+   * dynamics DoFHandler must share the triangulation of the operator.
+   *
+   * @tparam FluidVectorType Type of the fluid dynamics solution vector.
+   * @param[in] mapping Describes the transformations from unit to real cell.
+   * @param[in] fluid_dof_handler DoFHandler of the fluid dynamics.
+   * @param[in] fluid_solution Present solution of the fluid dynamics.
+   * @param[in] drift_velocity Optional vector-valued function added to the
+   * velocity of the fluid (e.g., the drift velocity of a tracer).
+   */
+  template <typename FluidVectorType>
+  void
+  evaluate_velocity_and_calculate_tau(
+    const Mapping<dim>    &mapping,
+    const DoFHandler<dim> &fluid_dof_handler,
+    const FluidVectorType &fluid_solution,
+    const Function<dim>   *drift_velocity = nullptr);
+
+  /**
+   * @brief Same as above, but the velocity is a linear combination of several
+   * fluid solutions, e.g., the extrapolation of the previous solutions to the
+   * current time.
+   *
+   * @tparam FluidVectorType Type of the fluid dynamics solution vector.
+   * @param[in] mapping Describes the transformations from unit to real cell.
+   * @param[in] fluid_dof_handler DoFHandler of the fluid dynamics.
+   * @param[in] fluid_solutions Solutions of the fluid dynamics.
+   * @param[in] weights Weight of each solution in the linear combination.
+   * Only the first weights.size() solutions are used.
+   * @param[in] drift_velocity Optional vector-valued function added to the
+   * velocity of the fluid.
+   */
+  template <typename FluidVectorType>
+  void
+  evaluate_velocity_and_calculate_tau(
+    const Mapping<dim>                 &mapping,
+    const DoFHandler<dim>              &fluid_dof_handler,
+    const std::vector<FluidVectorType> &fluid_solutions,
+    const std::vector<double>          &weights,
+    const Function<dim>                *drift_velocity = nullptr);
+
+  /**
+   * @brief Store the divergence of the velocity of the fluid at the quadrature
+   * points of the cells, which adds the compressibility term
+   * \f$ \alpha \phi \nabla \cdot u \f$ to the operator.
+   *
+   * @tparam FluidVectorType Type of the fluid dynamics solution vector.
+   * @param[in] mapping Describes the transformations from unit to real cell.
+   * @param[in] fluid_dof_handler DoFHandler of the fluid dynamics.
+   * @param[in] fluid_solution Present solution of the fluid dynamics.
+   */
+  template <typename FluidVectorType>
+  void
+  evaluate_velocity_divergence(const Mapping<dim>    &mapping,
+                               const DoFHandler<dim> &fluid_dof_handler,
+                               const FluidVectorType &fluid_solution);
+
+  /**
+   * @brief Pre-calculate the discontinuity-capturing directional dissipation
+   * (DCDD) tensor at the quadrature points of the cells. The dissipation is
+   * evaluated with the gradient of the provided solution and is kept constant
+   * within the operator, which corresponds to the linearization used by the
+   * matrix-based assemblers for transient simulations. Must be called after
+   * the velocity has been evaluated.
+   *
+   * @param[in] mapping Describes the transformations from unit to real cell.
+   * @param[in] solution Solution used to evaluate the gradient of the field,
+   * with the ghost values of the DoFHandler of the operator.
+   * @param[in] dissipation_model Function returning the dissipation tensor
+   * from the velocity, the gradient of the field and the element size. It
+   * must match the shock-capturing term of the physics.
+   */
+  void
+  evaluate_dcdd_dissipation(
+    const Mapping<dim>     &mapping,
+    const GlobalVectorType &solution,
+    const std::function<Tensor<2, dim>(const Tensor<1, dim> &velocity,
+                                       const Tensor<1, dim> &gradient,
+                                       const double          h)>
+      &dissipation_model);
+
+  /**
+   * @brief Get the total number of DoFs.
+   *
+   * @return Total number of degrees of freedom.
+   */
+  types::global_dof_index
+  m() const;
+
+  /**
+   * @brief Access a particular element in the matrix. Only required
+   * for compilation and it is not used.
+   *
+   * @param int
+   * @param int
+   * @return number
+   */
+  number
+  el(unsigned int, unsigned int) const;
+
+  /**
+   * @brief Clear the matrix-free object.
+   */
+  void
+  clear();
+
+  /**
+   * @brief Initialize a given vector by delegating it to the MatrixFree
+   * function in charge of this task.
+   *
+   * @param[in,out] vec Vector to be initialized.
+   */
+  void
+  initialize_dof_vector(VectorType &vec) const;
+
+  /**
+   * @brief Get the vector partitioner object.
+   *
+   * @return Pointer to vector partitioner.
+   */
+  const std::shared_ptr<const Utilities::MPI::Partitioner> &
+  get_vector_partitioner() const;
+
+  /**
+   * @brief Perform an operator evaluation dst = A*src by looping with the help
+   * of the MatrixFree object over all cells and evaluating the effect of cell
+   * integrals.
+   *
+   * @param[in,out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * @brief Perform the transposed operator evaluation.
+   *
+   * @param[in,out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   */
+  void
+  Tvmult(VectorType &dst, const VectorType &src) const;
+
+  /**
+   * @brief Calculate matrix if needed, e.g., by coarse-grid solver when a
+   * multigrid algorithm is used.
+   *
+   * @return Trilinos sparse matrix.
+   */
+  const TrilinosWrappers::SparseMatrix &
+  get_system_matrix() const;
+
+  /**
+   * @brief Get the system matrix free object.
+   *
+   * @return Matrix free object.
+   */
+  const MatrixFree<dim, number> &
+  get_system_matrix_free() const;
+
+  /**
+   * @brief Compute the diagonal of the operator using an optimized MatrixFree
+   * function. Needed for preconditioners.
+   *
+   * @param[in,out] diagonal The vector where the computed inverse diagonal is
+   * stored.
+   */
+  void
+  compute_inverse_diagonal(VectorType &diagonal) const;
+
+private:
+  /**
+   * @brief Compute the element size h of the cells required to calculate
+   * the stabilization parameters.
+   */
+  void
+  compute_element_size();
+
+  /**
+   * @brief Store the velocity, as a linear combination of fluid solutions, at
+   * the quadrature points and calculate the SUPG stabilization parameter.
+   *
+   * @tparam FluidVectorType Type of the fluid dynamics solution vector.
+   * @param[in] mapping Describes the transformations from unit to real cell.
+   * @param[in] fluid_dof_handler DoFHandler of the fluid dynamics.
+   * @param[in] fluid_solutions Weights and pointers to the solutions.
+   * @param[in] drift_velocity Optional function added to the velocity.
+   */
+  template <typename FluidVectorType>
+  void
+  fill_velocity_and_tau(
+    const Mapping<dim>    &mapping,
+    const DoFHandler<dim> &fluid_dof_handler,
+    const std::vector<std::pair<double, const FluidVectorType *>>
+                        &fluid_solutions,
+    const Function<dim> *drift_velocity);
+
+  /**
+   * @brief Evaluate the Jacobian at the quadrature points of a batch of cells.
+   *
+   * @param[in,out] integrator FEEvaluation object holding the DoF values of
+   * the cell batch on input and the integrated result on output.
+   */
+  void
+  do_cell_integral_local(FECellIntegrator &integrator) const;
+
+  /**
+   * @brief Loop over a range of cell batches and apply the Jacobian.
+   *
+   * @param[in] matrix_free Matrix free object.
+   * @param[in,out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   * @param[in] range Range of cell batches.
+   */
+  void
+  do_cell_integral_range(
+    const MatrixFree<dim, number>               &matrix_free,
+    VectorType                                  &dst,
+    const VectorType                            &src,
+    const std::pair<unsigned int, unsigned int> &range) const;
+
+  MatrixFree<dim, number> matrix_free;
+
+  AffineConstraints<number> constraints;
+
+  mutable TrilinosWrappers::SparseMatrix system_matrix;
+
+  AlignedVector<VectorizedArray<number>> element_size;
+
+  unsigned int fe_degree;
+
+  double transport_coefficient;
+
+  double diffusivity;
+
+  bool enable_ggls;
+
+  std::shared_ptr<SimulationControl> simulation_control;
+
+  bool enable_advection;
+
+  Table<2, Tensor<1, dim, VectorizedArray<number>>> velocity;
+
+  Table<2, VectorizedArray<number>> stabilization_parameter;
+
+  bool enable_compressibility;
+
+  Table<2, VectorizedArray<number>> velocity_divergence;
+
+  bool enable_dcdd;
+
+  Table<2, Tensor<2, dim, VectorizedArray<number>>> dcdd_dissipation;
+
+  std::vector<unsigned int> constrained_indices;
+};
+
+#endif
@@ -0,0 +1,204 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------*/
+
+#ifndef lethe_advection_diffusion_matrix_free_preconditioner_h
+#define lethe_advection_diffusion_matrix_free_preconditioner_h
+
+#include <core/parameters.h>
+#include <core/simulation_control.h>
+
+#include <solvers/advection_diffusion_matrix_free_operators.h>
+
+#include <deal.II/base/conditional_ostream.h>
+
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_gmres.h>
+#include <deal.II/lac/trilinos_precondition.h>
+
+#include <deal.II/multigrid/mg_coarse.h>
+#include <deal.II/multigrid/mg_matrix.h>
+#include <deal.II/multigrid/mg_smoother.h>
+#include <deal.II/multigrid/mg_transfer_global_coarsening.h>
+#include <deal.II/multigrid/multigrid.h>
+
+using namespace dealii;
+
+/**
+ * @brief A geometric multigrid preconditioner for the matrix-free
+ * advection-diffusion operator. The levels are built with global coarsening
+ * and the level operators only contain the time derivative and the
+ * diffusion terms. They are therefore symmetric positive definite and are
+ * smoothed with a Chebyshev iteration around the point-Jacobi method.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ */
+template <int dim>
+class MFAdvectionDiffusionPreconditionGMG : public Subscriptor
+{
+  using VectorType     = LinearAlgebra::distributed::Vector<double>;
+  using GCTransferType = MGTransferGlobalCoarsening<dim, VectorType>;
+  using OperatorType   = AdvectionDiffusionOperator<dim, double>;
+  using SmootherPreconditionerType = DiagonalMatrix<VectorType>;
+  using SmootherType =
+    PreconditionChebyshev<OperatorType, VectorType, SmootherPreconditionerType>;
+  using PreconditionerType = PreconditionMG<dim, VectorType, GCTransferType>;
+
+public:
+  /**
+   * @brief Construct the preconditioner. Creates the level triangulations,
+   * DoFHandlers, constraints, operators and transfers.
+   *
+   * @param[in] linear_solver_parameters Parameters of the linear solver of
+   * the physics.
+   * @param[in] dof_handler Describes the layout of DoFs and the type of FE.
+   * @param[in] mapping Describes the transformations from unit to real cell.
+   * @param[in] cell_quadrature Required for local operations on cells.
+   * @param[in] dirichlet_boundary_ids Boundary ids on which a Dirichlet
+   * boundary condition is imposed.
+   * @param[in] transport_coefficient Coefficient multiplying the time
+   * derivative.
+   * @param[in] diffusivity Coefficient multiplying the diffusion term.
+   * @param[in] enable_ggls Flag to enable the gradient-Galerkin least-squares
+   * stabilization of the time derivative.
+   * @param[in] simulation_control Required to get the time stepping method.
+   */
+  MFAdvectionDiffusionPreconditionGMG(
+    const Parameters::LinearSolver           &linear_solver_parameters,
+    const DoFHandler<dim>                    &dof_handler,
+    const Mapping<dim>                       &mapping,
+    const Quadrature<dim>                    &cell_quadrature,
+    const std::set<types::boundary_id>       &dirichlet_boundary_ids,
+    const double                              transport_coefficient,
+    const double                              diffusivity,
+    const bool                                enable_ggls,
+    const std::shared_ptr<SimulationControl> &simulation_control);
+
+  /**
+   * @brief Initialize the smoother, the coarse-grid solver and the multigrid
+   * object. The level operators only depend on the time step, through the
+   * first coefficient of the BDF scheme. The smoother and the coarse-grid
+   * solver are therefore only rebuilt on the first call and when this
+   * coefficient changed since the last set up. The preconditioner must be
+   * created again when the DoFs change.
+   */
+  void
+  initialize();
+
+  /**
+   * @brief Apply the preconditioner.
+   *
+   * @param[in,out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const;
+
+private:
+  /**
+   * @brief Set up the algebraic multigrid preconditioner of the coarse level.
+   */
+  void
+  setup_AMG();
+
+  /// Parameters of the linear solver.
+  const Parameters::LinearSolver linear_solver_parameters;
+
+  /// Simulation control, used to detect changes of the time step.
+  const std::shared_ptr<SimulationControl> simulation_control;
+
+  /// First BDF coefficient used by the level operators at the last set up.
+  double setup_bdf_coefficient;
+
+  /// DoFHandler of the finest level.
+  const DoFHandler<dim> &dof_handler;
+
+  /// Triangulations of the levels.
+  std::vector<std::shared_ptr<const Triangulation<dim>>>
+    coarse_grid_triangulations;
+
+  /// DoFHandlers of the levels.
+  MGLevelObject<DoFHandler<dim>> dof_handlers;
+
+  /// Homogeneous constraints of the levels.
+  MGLevelObject<AffineConstraints<double>> constraints;
+
+  /// Level operators.
+  MGLevelObject<std::shared_ptr<OperatorType>> mg_operators;
+
+  /// Transfers between two consecutive levels.
+  MGLevelObject<MGTwoLevelTransfer<dim, VectorType>> transfers;
+
+  /// Global coarsening transfer.
+  std::shared_ptr<GCTransferType> mg_transfer;
+
+  /// Coarsest level.
+  unsigned int minlevel;
+
+  /// Finest level.
+  unsigned int maxlevel;
+
+  std::shared_ptr<mg::Matrix<VectorType>> mg_matrix;
+
+  std::shared_ptr<
+    MGSmootherPrecondition<OperatorType, SmootherType, VectorType>>
+    mg_smoother;
+
+  std::shared_ptr<ReductionControl> coarse_grid_solver_control;
+
+  std::shared_ptr<SolverGMRES<VectorType>> coarse_grid_solver;
+
+  std::shared_ptr<TrilinosWrappers::PreconditionAMG> precondition_amg;
+
+  std::shared_ptr<MGCoarseGridBase<VectorType>> mg_coarse;
+
+  std::shared_ptr<Multigrid<VectorType>> mg;
+
+  std::shared_ptr<PreconditionerType> multigrid_preconditioner;
+
+  ConditionalOStream pcout;
+};
+
+/**
+ * @brief Solve the linear system of a matrix-free advection-diffusion physics
+ * with GMRES. The right-hand side assembled in the global vector of the
+ * physics is copied into a vector compatible with the operator, and the
+ * solution is copied back into the Newton update and constrained.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam PreconditionerType Type of the preconditioner of GMRES.
+ *
+ * @param[in] system_operator Matrix-free operator of the physics.
+ * @param[in] preconditioner Preconditioner of GMRES.
+ * @param[in] linear_solver_parameters Parameters of the linear solver of the
+ * physics.
+ * @param[in] system_rhs Right-hand side assembled by the physics.
+ * @param[in] constraints Constraints distributed to the solution.
+ * @param[out] newton_update Solution of the linear system.
+ * @param[in] pcout Stream used to report the iterations of the solver.
+ */
+template <int dim, typename PreconditionerType>
+void
+solve_advection_diffusion_matrix_free(
+  const AdvectionDiffusionOperator<dim, double> &system_operator,
+  const PreconditionerType                      &preconditioner,
+  const Parameters::LinearSolver                &linear_solver_parameters,
+  const GlobalVectorType                        &system_rhs,
+  const AffineConstraints<double>               &constraints,
+  GlobalVectorType                              &newton_update,
+  const ConditionalOStream                      &pcout);
+
+#endif
@@ -0,0 +1,195 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------*/
+
+#ifndef lethe_assembly_coloring_h
+#define lethe_assembly_coloring_h
+
+#include <deal.II/base/index_set.h>
+#include <deal.II/base/work_stream.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/lac/affine_constraints.h>
+
+#include <mutex>
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief Coloring of the locally owned cells of a DoFHandler used to assemble
+ * the matrix-based physics with WorkStream without serializing the copy of
+ * the local contributions to the global matrix and right-hand side.
+ *
+ * Two cells of the same color do not share any degree of freedom, including
+ * the degrees of freedom that constrain the degrees of freedom of the cells.
+ * The local contributions of the cells of a color are thus written to
+ * different rows of the global matrix and can be copied concurrently. The
+ * Trilinos matrices and vectors store the contributions to the rows owned by
+ * other processes in shared buffers, which are not thread-safe. The cells that
+ * write to such rows are therefore copied under a lock.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ */
+template <int dim>
+class AssemblyColoring
+{
+public:
+  using CellIterator = typename DoFHandler<dim>::active_cell_iterator;
+
+  /**
+   * @brief Color the locally owned cells. Must be called again every time the
+   * mesh, the degrees of freedom or the constraints change.
+   *
+   * @param[in] dof_handler DoFHandler of the physics.
+   *
+   * @param[in] constraints Constraints used to copy the local contributions
+   * to the global matrix and right-hand side.
+   */
+  void
+  reinit(const DoFHandler<dim>           &dof_handler,
+         const AffineConstraints<double> &constraints);
+
+  /**
+   * @brief Return the locally owned cells grouped by color.
+   */
+  const std::vector<std::vector<CellIterator>> &
+  get_colored_cells() const
+  {
+    return colored_cells;
+  }
+
+  /**
+   * @brief Copy the local contributions of a cell with the provided copier,
+   * under a lock if the cell writes to rows owned by other processes.
+   *
+   * @param[in] local_dof_indices Degrees of freedom of the cell.
+   *
+   * @param[in] copier Function that copies the local contributions of the
+   * cell to the global matrix or right-hand side.
+   */
+  template <typename CopierType>
+  void
+  copy_local_to_global(
+    const std::vector<types::global_dof_index> &local_dof_indices,
+    const CopierType                           &copier) const
+  {
+    for (const types::global_dof_index index : local_dof_indices)
+      if (!lock_free_dofs.is_element(index))
+        {
+          std::lock_guard<std::mutex> lock(nonlocal_mutex);
+          copier();
+          return;
+        }
+
+    copier();
+  }
+
+  /**
+   * @brief Return the number of colors.
+   */
+  unsigned int
+  n_colors() const
+  {
+    return colored_cells.size();
+  }
+
+private:
+  /**
+   * @brief Locally owned cells grouped by color.
+   */
+  std::vector<std::vector<CellIterator>> colored_cells;
+
+  /**
+   * @brief Locally owned degrees of freedom that are not constrained by
+   * degrees of freedom owned by other processes. The contributions of a cell
+   * whose degrees of freedom are all in this set are only written to locally
+   * owned rows.
+   */
+  IndexSet lock_free_dofs;
+
+  /**
+   * @brief Mutex that serializes the copy of the cells that write to rows
+   * owned by other processes.
+   */
+  mutable std::mutex nonlocal_mutex;
+};
+
+/**
+ * @brief Run the cell assembly of a matrix-based physics with WorkStream. If
+ * a coloring is provided, the cells of a color are assembled and copied
+ * concurrently. Otherwise, all the active cells are assembled concurrently
+ * and copied one after the other, as done by WorkStream::run.
+ *
+ * @param[in] dof_handler DoFHandler of the physics.
+ *
+ * @param[in] coloring Coloring of the cells of the DoFHandler or nullptr.
+ *
+ * @param[in] object Physics that assembles the system.
+ *
+ * @param[in] worker Function of the physics that assembles the local
+ * contributions of a cell.
+ *
+ * @param[in] copier Function of the physics that copies the local
+ * contributions of a cell to the global system.
+ *
+ * @param[in] sample_scratch_data Scratch data copied for every thread.
+ *
+ * @param[in] sample_copy_data Copy data copied for every thread.
+ */
+template <int dim, class MainClass, typename ScratchData, typename CopyData>
+void
+run_cell_assembly(
+  const DoFHandler<dim>       &dof_handler,
+  const AssemblyColoring<dim> *coloring,
+  MainClass                   &object,
+  void (MainClass::*worker)(
+    const typename DoFHandler<dim>::active_cell_iterator &,
+    ScratchData &,
+    CopyData &),
+  void (MainClass::*copier)(const CopyData &),
+  const ScratchData &sample_scratch_data,
+  const CopyData    &sample_copy_data)
+{
+  if (coloring == nullptr)
+    {
+      WorkStream::run(dof_handler.begin_active(),
+                      dof_handler.end(),
+                      object,
+                      worker,
+                      copier,
+                      sample_scratch_data,
+                      sample_copy_data);
+      return;
+    }
+
+  using CellIterator = typename DoFHandler<dim>::active_cell_iterator;
+
+  WorkStream::run(
+    coloring->get_colored_cells(),
+    [&object, worker](const CellIterator &cell,
+                      ScratchData        &scratch_data,
+                      CopyData           &copy_data) {
+      (object.*worker)(cell, scratch_data, copy_data);
+    },
+    [&object, copier, coloring](const CopyData &copy_data) {
+      coloring->copy_local_to_global(copy_data.local_dof_indices,
+                                     [&]() { (object.*copier)(copy_data); });
+    },
+    sample_scratch_data,
+    sample_copy_data);
+}
+
+#endif
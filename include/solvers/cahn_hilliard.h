@@ -33,6 +33,7 @@
 #include <core/simulation_control.h>
 #include <core/vector.h>
 
+#include <solvers/assembly_coloring.h>
 #include <solvers/auxiliary_physics.h>
 #include <solvers/cahn_hilliard_assemblers.h>
 #include <solvers/cahn_hilliard_filter.h>
@@ -476,6 +477,9 @@ private:
   TrilinosWrappers::SparseMatrix system_matrix;
   GlobalVectorType               filtered_solution;
 
+  // Coloring of the cells used by the assembly, if it is enabled
+  std::shared_ptr<AssemblyColoring<dim>> assembly_coloring;
+
 
   // Previous solutions vectors
   std::vector<GlobalVectorType> previous_solutions;
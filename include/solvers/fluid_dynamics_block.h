@@ -218,16 +218,45 @@ private:
                      const bool   renewed_matrix);
 
   /**
-   * Set-up AMG preconditioner
+   * @brief Set-up AMG preconditioner
+   *
+   * @param[in] setup_velocity Rebuild the preconditioner of the velocity
+   * block.
+   *
+   * @param[in] setup_pressure Rebuild the preconditioner of the pressure
+   * block.
    */
   void
-  setup_AMG();
+  setup_AMG(const bool setup_velocity, const bool setup_pressure);
 
   /**
-   * Set-up ILU preconditioner
+   * @brief Set-up ILU preconditioner
+   *
+   * @param[in] setup_velocity Rebuild the preconditioner of the velocity
+   * block.
+   *
+   * @param[in] setup_pressure Rebuild the preconditioner of the pressure
+   * block.
    */
   void
-  setup_ILU();
+  setup_ILU(const bool setup_velocity, const bool setup_pressure);
+
+  /**
+   * @brief Check if the preconditioner of the velocity block has to be
+   * rebuilt when the block preconditioners are reused. This is the case if
+   * the inverse of the time step or the velocity around which the convective
+   * term is linearized changed by more than the relative tolerance since the
+   * preconditioner was built.
+   */
+  bool
+  velocity_preconditioner_is_outdated() const;
+
+  /**
+   * @brief Return the inverse of the time step, or zero for steady
+   * simulations.
+   */
+  double
+  get_inverse_time_step() const;
 
 
 
@@ -255,6 +284,12 @@ private:
   std::shared_ptr<BlockSchurPreconditioner<TrilinosWrappers::PreconditionAMG>>
     system_amg_preconditioner;
 
+  /// Velocity at which the preconditioner of the velocity block was built
+  GlobalVectorType velocity_preconditioner_velocity;
+
+  /// Inverse of the time step at which the velocity preconditioner was built
+  double velocity_preconditioner_inverse_time_step;
+
   const double gamma = 1;
 };
 
@@ -19,7 +19,9 @@
 #include <core/exceptions.h>
 #include <core/vector.h>
 
+#include <solvers/assembly_coloring.h>
 #include <solvers/copy_data.h>
+#include <solvers/fluid_dynamics_matrix_free_operators.h>
 #include <solvers/navier_stokes_base.h>
 #include <solvers/navier_stokes_scratch_data.h>
 
@@ -114,6 +116,54 @@ protected:
   void
   setup_preconditioner() override;
 
+  /**
+   * @brief Indicate if the system matrix no longer corresponds to the current
+   * problem. This is the case if the jacobian has not been assembled since the
+   * last set up of the degrees of freedom, or if the time-stepping method or
+   * the BDF coefficients have changed since its assembly.
+   *
+   * @return Boolean that is true if the system matrix must be reassembled.
+   */
+  bool
+  system_matrix_is_outdated() override;
+
+  /**
+   * @brief Store the time-stepping method and the BDF coefficients with which
+   * the jacobian is assembled in the system matrix. Must be called by every
+   * function that assembles the jacobian.
+   */
+  void
+  register_system_matrix_assembly();
+
+  /**
+   * @brief Indicate if the residual of the problem can be evaluated by the
+   * matrix-free operator. This is the case for the single-phase flows of
+   * Newtonian fluids with a constant density that are solved with SUPG/PSPG or
+   * GLS stabilization, a BDF or steady time-stepping method, strongly imposed
+   * boundary conditions and the same order for the velocity and the pressure
+   * on a hex mesh, without any additional source term than the forcing
+   * function and the dynamic flow control. Derived solvers that assemble
+   * other equations must override it and return false.
+   *
+   * @return Boolean that is true if the matrix-free residual is supported.
+   */
+  virtual bool
+  matrix_free_residual_is_supported();
+
+  /**
+   * @brief Indicate if the structure of the system matrix, i.e. the partition
+   * of the DoFs, the DoFs of the locally owned and ghost cells and the
+   * constraints, is the same as at the previous call. The invariants and the
+   * current structure are stored for the next call. Must be
+   * called by all the processes after the DoFs and the constraints are set
+   * up.
+   *
+   * @return Boolean that is true if the sparsity pattern and the system
+   * matrix can be reused.
+   */
+  bool
+  matrix_structure_is_unchanged();
+
   /**
    * @brief Define the non-zero constraints used to solve the problem.
    */
@@ -228,6 +278,23 @@ private:
   void
   assemble_L2_projection();
 
+  /**
+   * @brief Set up the DoF handler and the zero constraints of the matrix-free
+   * operator that evaluates the residual, and map the locally owned DoFs of
+   * the system matrix to the DoFs of the operator. The FE of the solver is
+   * left untouched.
+   */
+  void
+  setup_matrix_free_residual_dofs();
+
+  /**
+   * @brief Assemble the rhs with the sum-factorization kernels of the
+   * matrix-free operator instead of the assemblers. The result is identical
+   * to the one of the assemblers for the supported problems.
+   */
+  void
+  assemble_system_rhs_matrix_free();
+
 
 
   /**
@@ -255,7 +322,10 @@ private:
                       const double relative_residual);
 
   /**
-   * @brief  Set-up AMG preconditioner
+   * @brief  Set-up AMG preconditioner. If the hierarchy is reused, the
+   * aggregates of the existing preconditioner are kept and only the level
+   * matrices and the smoothers are recomputed from the values of the system
+   * matrix.
    */
   void
   setup_AMG();
@@ -273,12 +343,68 @@ private:
 protected:
   TrilinosWrappers::SparseMatrix system_matrix;
 
+  // Evaluate the residual with the matrix-free operator. It is set when the
+  // DoFs are set up for the first time.
+  bool use_matrix_free_residual;
+
 private:
   SparsityPattern                                    sparsity_pattern;
   std::shared_ptr<TrilinosWrappers::PreconditionILU> ilu_preconditioner;
   std::shared_ptr<TrilinosWrappers::PreconditionAMG> amg_preconditioner;
   int current_preconditioner_fill_level;
   int initial_preconditioner_fill_level;
+
+  // Indicate if the support of the matrix-free residual has been checked
+  bool matrix_free_residual_checked;
+
+  // Smoother fill level with which the hierarchy of the AMG preconditioner
+  // was built
+  int amg_hierarchy_fill_level;
+
+  // State of the problem for which the jacobian stored in the system matrix
+  // was assembled. It is used to detect that a jacobian carried over from the
+  // previous time step must be reassembled.
+  bool                                              system_matrix_is_jacobian;
+  Parameters::SimulationControl::TimeSteppingMethod jacobian_assembly_method;
+  Vector<double>                                    jacobian_bdf_coefficients;
+
+  // Invariants of the structure of the system matrix, and DoFs of the locally
+  // owned and ghost cells followed by the constraints, used to reuse the
+  // sparsity pattern and the matrix when the mesh is not modified
+  types::global_dof_index              matrix_structure_n_dofs;
+  unsigned int                         matrix_structure_n_active_cells;
+  IndexSet                             matrix_structure_locally_owned_dofs;
+  IndexSet                             matrix_structure_locally_relevant_dofs;
+  std::vector<types::global_dof_index> matrix_structure;
+
+  // Cache of the shape functions of the affine cells used by the assembly, if
+  // it is enabled
+  std::shared_ptr<NavierStokesShapeDataCache<dim>> shape_data_cache;
+
+  // Coloring of the cells used by the assembly, if it is enabled
+  std::shared_ptr<AssemblyColoring<dim>> assembly_coloring;
+
+  // Matrix-free operator used to evaluate the residual, if it is enabled
+  using MFVectorType = LinearAlgebra::distributed::Vector<double>;
+  std::shared_ptr<NavierStokesStabilizedOperator<dim, double>>
+    residual_operator;
+
+  // FE system with a single base element, DoF handler and zero constraints
+  // of the matrix-free operator. The DoFs of the operator at the position of
+  // the locally owned DoFs of the system matrix are stored in
+  // residual_dof_indices.
+  std::shared_ptr<FESystem<dim>>       residual_fe;
+  DoFHandler<dim>                      residual_dof_handler;
+  AffineConstraints<double>            residual_zero_constraints;
+  std::vector<types::global_dof_index> residual_dof_indices;
+
+  // Vectors with the layout of the matrix-free operator. The time derivative
+  // of the previous solutions is only evaluated once per time step, at the
+  // time stored in residual_time_derivative_time.
+  MFVectorType residual_evaluation_point;
+  MFVectorType residual_vector;
+  MFVectorType residual_time_derivative;
+  double       residual_time_derivative_time;
 };
 
 
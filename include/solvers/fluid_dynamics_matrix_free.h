@@ -18,9 +18,11 @@
 
 #include <core/exceptions.h>
 
+#include <solvers/advection_diffusion_matrix_free_preconditioner.h>
 #include <solvers/fluid_dynamics_matrix_free_operators.h>
 #include <solvers/navier_stokes_base.h>
 
+#include <deal.II/lac/diagonal_matrix.h>
 #include <deal.II/lac/precondition.h>
 #include <deal.II/lac/solver_gmres.h>
 
@@ -33,28 +35,139 @@
 #include <deal.II/multigrid/mg_transfer_matrix_free.h>
 #include <deal.II/multigrid/multigrid.h>
 
+#include <functional>
+
 
 using namespace dealii;
 
 template <typename VectorType>
 class PreconditionBase;
 
+template <typename VectorType>
+class TrilinosPreconditionerAdapter;
+
+/**
+ * @brief Interface of the geometric multigrid preconditioners compatible with
+ * the matrix-free solver. The preconditioner is always applied to double
+ * precision vectors, while the multigrid levels can be stored and evaluated
+ * in another number type.
+ */
+template <int dim>
+class MFNavierStokesPreconditionGMGBase
+{
+protected:
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+public:
+  /**
+   * @brief Constructor that sets the timers and the output stream.
+   */
+  MFNavierStokesPreconditionGMGBase();
+
+  /**
+   * @brief Destructor.
+   */
+  virtual ~MFNavierStokesPreconditionGMGBase() = default;
+
+  /**
+   * @brief Initialize smoother, coarse grid solver and multigrid object
+   * needed for the geometric multigrid preconditioner. The level operators
+   * and the transfers are created once in the constructor. Every call updates
+   * the linearization data of the levels and the smoother, while the
+   * eigenvalue estimates and the coarse-grid solver can be reused until the
+   * convergence of the outer solver degrades.
+   *
+   * @param[in] simulation_control Required to get the time stepping method.
+   * @param[in] flow_control Required for dynamic flow control.
+   * @param[in] present_solution Previous solution needed to evaluate the non
+   * linear term.
+   * @param[in] time_derivative_previous_solutions Vector storing time
+   * derivatives of previous solutions.
+   */
+  virtual void
+  initialize(const std::shared_ptr<SimulationControl> &simulation_control,
+             FlowControl<dim>                         &flow_control,
+             const VectorType                         &present_solution,
+             const VectorType &time_derivative_previous_solutions) = 0;
+
+  /**
+   * @brief Calls the v cycle function of the multigrid object.
+   *
+   * @param[in,out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   */
+  virtual void
+  vmult(VectorType &dst, const VectorType &src) const = 0;
+
+  /**
+   * @brief Prints relevant multigrid information
+   *
+   */
+  virtual void
+  print_relevant_info() const = 0;
+
+  /**
+   * @brief Set the kinematic viscosity of all level operators.
+   *
+   * @param[in] kinematic_viscosity New value of the kinematic viscosity.
+   */
+  virtual void
+  set_kinematic_viscosity(const double kinematic_viscosity) = 0;
+
+  /**
+   * @brief Print and reset the timers of the level operators and of the
+   * smoother preconditioners.
+   */
+  virtual void
+  print_level_timers() const = 0;
+
+  /**
+   * @brief Monitor the number of iterations of the outer linear solver. If the
+   * convergence degrades compared to the first solve that followed the last
+   * full set up, the reused eigenvalue estimates and coarse-grid solver are
+   * rebuilt at the next initialization.
+   *
+   * @param[in] n_iterations Number of iterations of the last outer solve.
+   */
+  virtual void
+  monitor_outer_iterations(const unsigned int n_iterations) = 0;
+
+protected:
+  /// Conditional Ostream
+  ConditionalOStream pcout;
+
+public:
+  /// Timer for specific geometric multigrid components.
+  mutable TimerOutput mg_setup_timer;
+
+  /// Internal timer for vmult timings
+  mutable TimerOutput mg_vmult_timer;
+};
+
 /**
  * @brief A geometric multigrid preconditioner compatible with the
  * matrix-free solver.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ * @tparam MGNumber Number type of the level operators, smoothers and
+ * transfers (i.e., double or float).
  */
-template <int dim>
+template <int dim, typename MGNumber>
 class MFNavierStokesPreconditionGMG
+  : public MFNavierStokesPreconditionGMGBase<dim>
 {
   using VectorType     = LinearAlgebra::distributed::Vector<double>;
-  using LSTransferType = MGTransferMatrixFree<dim, double>;
-  using GCTransferType = MGTransferGlobalCoarsening<dim, VectorType>;
-  using OperatorType   = NavierStokesOperatorBase<dim, double>;
-  using SmootherPreconditionerType = PreconditionBase<VectorType>;
+  using MGVectorType   = LinearAlgebra::distributed::Vector<MGNumber>;
+  using LSTransferType = MGTransferMatrixFree<dim, MGNumber>;
+  using GCTransferType = MGTransferGlobalCoarsening<dim, MGVectorType>;
+  using OperatorType   = NavierStokesOperatorBase<dim, MGNumber>;
+  using SmootherPreconditionerType = PreconditionBase<MGVectorType>;
   using SmootherType =
     PreconditionRelaxation<OperatorType, SmootherPreconditionerType>;
-  using PreconditionerTypeLS = PreconditionMG<dim, VectorType, LSTransferType>;
-  using PreconditionerTypeGC = PreconditionMG<dim, VectorType, GCTransferType>;
+  using PreconditionerTypeLS =
+    PreconditionMG<dim, MGVectorType, LSTransferType>;
+  using PreconditionerTypeGC =
+    PreconditionMG<dim, MGVectorType, GCTransferType>;
 
 public:
   /**
@@ -72,6 +185,10 @@ public:
    * term.
    * @param[in] simulation_control Required to get the time stepping method.
    * @param[in] fe Describes the FE system for the vector-valued problem.
+   * @param[in] level_operator_factory Optional function creating the level
+   * operators, e.g., to precondition a solver whose equations differ from the
+   * Navier-Stokes equations. The stabilized Navier-Stokes operator is used if
+   * it is empty.
    */
   MFNavierStokesPreconditionGMG(
     const SimulationParameters<dim>          &simulation_parameters,
@@ -81,11 +198,17 @@ public:
     const std::shared_ptr<Quadrature<dim>>   &cell_quadrature,
     const std::shared_ptr<Function<dim>>      forcing_function,
     const std::shared_ptr<SimulationControl> &simulation_control,
-    const std::shared_ptr<FESystem<dim>>      fe);
+    const std::shared_ptr<FESystem<dim>>      fe,
+    const std::function<std::shared_ptr<OperatorType>()>
+      &level_operator_factory = {});
 
   /**
    * @brief Initialize smoother, coarse grid solver and multigrid object
-   * needed for the geometric multigrid preconditioner.
+   * needed for the geometric multigrid preconditioner. The level operators
+   * and the transfers are created once in the constructor. Every call updates
+   * the linearization data of the levels and the smoother, while the
+   * eigenvalue estimates and the coarse-grid solver can be reused until the
+   * convergence of the outer solver degrades.
    *
    * @param[in] simulation_control Required to get the time stepping method.
    * @param[in] flow_control Required for dynamic flow control.
@@ -98,7 +221,7 @@ public:
   initialize(const std::shared_ptr<SimulationControl> &simulation_control,
              FlowControl<dim>                         &flow_control,
              const VectorType                         &present_solution,
-             const VectorType &time_derivative_previous_solutions);
+             const VectorType &time_derivative_previous_solutions) override;
 
   /**
    * @brief Calls the v cycle function of the multigrid object.
@@ -107,14 +230,52 @@ public:
    * @param[in] src Input source vector.
    */
   void
-  vmult(VectorType &dst, const VectorType &src) const;
+  vmult(VectorType &dst, const VectorType &src) const override;
 
   /**
    * @brief Prints relevant multigrid information
    *
    */
   void
-  print_relevant_info() const;
+  print_relevant_info() const override;
+
+  /**
+   * @brief Set the kinematic viscosity of all level operators.
+   *
+   * @param[in] kinematic_viscosity New value of the kinematic viscosity.
+   */
+  void
+  set_kinematic_viscosity(const double kinematic_viscosity) override;
+
+  /**
+   * @brief Print and reset the timers of the level operators and of the
+   * smoother preconditioners.
+   */
+  void
+  print_level_timers() const override;
+
+  /**
+   * @brief Monitor the number of iterations of the outer linear solver. If the
+   * convergence degrades compared to the first solve that followed the last
+   * full set up, the reused eigenvalue estimates and coarse-grid solver are
+   * rebuilt at the next initialization.
+   *
+   * @param[in] n_iterations Number of iterations of the last outer solve.
+   */
+  void
+  monitor_outer_iterations(const unsigned int n_iterations) override;
+
+  /**
+   * @brief Interpolate a vector of the finest level to all the levels of the
+   * multigrid hierarchy with the transfer of the preconditioner. Used to
+   * provide additional coefficients to the level operators.
+   *
+   * @param[in] src Vector of the finest level.
+   * @param[out] dst Vectors of all the levels, initialized by this function.
+   */
+  void
+  interpolate_to_levels(const VectorType            &src,
+                        MGLevelObject<MGVectorType> &dst) const;
 
   /**
    * @brief Getter function for all level operators.
@@ -130,10 +291,58 @@ public:
    *
    * @return Multigrid object that contains all level smoother preconditioners.
    */
-  const MGLevelObject<std::shared_ptr<PreconditionBase<VectorType>>> &
+  const MGLevelObject<std::shared_ptr<PreconditionBase<MGVectorType>>> &
   get_mg_smoother_preconditioners() const;
 
 private:
+  /**
+   * @brief Transfer the linearization point and the time derivatives of the
+   * previous solutions to the levels and update the level operators.
+   *
+   * @param[in] simulation_control Required to get the time stepping method.
+   * @param[in] flow_control Required for dynamic flow control.
+   * @param[in] present_solution Previous solution needed to evaluate the non
+   * linear term.
+   * @param[in] time_derivative_previous_solutions Vector storing time
+   * derivatives of previous solutions.
+   */
+  void
+  update_level_operators(
+    const std::shared_ptr<SimulationControl> &simulation_control,
+    FlowControl<dim>                         &flow_control,
+    const VectorType                         &present_solution,
+    const VectorType &time_derivative_previous_solutions);
+
+  /**
+   * @brief Compute the smoother preconditioners of all levels and initialize
+   * the smoother.
+   *
+   * @param[in] simulation_control Required to get the time stepping method.
+   * @param[in] full_setup Flag to estimate the eigenvalues even if the
+   * previous estimates could be reused.
+   */
+  void
+  setup_smoother(const std::shared_ptr<SimulationControl> &simulation_control,
+                 const bool                                full_setup);
+
+  /**
+   * @brief Create the coarse-grid solver.
+   *
+   * @param[in] full_setup Flag to create the coarse-grid solver even if the
+   * previous one could be reused.
+   *
+   * @return True if a new coarse-grid solver was created.
+   */
+  bool
+  setup_coarse_grid_solver(const bool full_setup);
+
+  /**
+   * @brief Create the multigrid objects and the multigrid preconditioner, and
+   * connect the timers.
+   */
+  void
+  setup_multigrid();
+
   /**
    * @brief Set up AMG object needed for coarse-grid solver or
    * preconditioning.
@@ -167,28 +376,28 @@ private:
   MGLevelObject<DoFHandler<dim>> dof_handlers;
 
   /// Transfers for each of the levels of the global coarsening algorithm
-  MGLevelObject<MGTwoLevelTransfer<dim, VectorType>> transfers;
+  MGLevelObject<MGTwoLevelTransfer<dim, MGVectorType>> transfers;
 
   /// Level operators for the geometric multigrid
   MGLevelObject<std::shared_ptr<OperatorType>> mg_operators;
 
   /// Multigrid level object storing all operators
-  std::shared_ptr<mg::Matrix<VectorType>> mg_matrix;
+  std::shared_ptr<mg::Matrix<MGVectorType>> mg_matrix;
 
   /// Interface edge matrix needed only for local smoothing
-  std::shared_ptr<mg::Matrix<VectorType>> mg_interface_matrix_in;
+  std::shared_ptr<mg::Matrix<MGVectorType>> mg_interface_matrix_in;
   MGLevelObject<MatrixFreeOperators::MGInterfaceOperator<OperatorType>>
     ls_mg_operators;
   MGLevelObject<MatrixFreeOperators::MGInterfaceOperator<OperatorType>>
     ls_mg_interface_in;
 
   /// Preconditioners associated to smoothers
-  mutable MGLevelObject<std::shared_ptr<PreconditionBase<VectorType>>>
+  mutable MGLevelObject<std::shared_ptr<PreconditionBase<MGVectorType>>>
     mg_smoother_preconditioners;
 
   /// Smoother object
   std::shared_ptr<
-    MGSmootherPrecondition<OperatorType, SmootherType, VectorType>>
+    MGSmootherPrecondition<OperatorType, SmootherType, MGVectorType>>
     mg_smoother;
 
   /// Collection of boundary constraints and refinement edge constrations for
@@ -217,40 +426,40 @@ private:
   std::shared_ptr<SolverControl> direct_solver_control;
 
   /// GMRES as coarse grid solver
-  std::shared_ptr<SolverGMRES<VectorType>> coarse_grid_solver;
+  std::shared_ptr<SolverGMRES<MGVectorType>> coarse_grid_solver;
+
+  /// AMG or ILU preconditioner of the coarse grid GMRES solver applied to the
+  /// level vectors
+  std::shared_ptr<TrilinosPreconditionerAdapter<MGVectorType>>
+    coarse_grid_preconditioner;
 
   /// Multigrid wrapper for the coarse grid solver
-  std::shared_ptr<MGCoarseGridBase<VectorType>> mg_coarse;
+  std::shared_ptr<MGCoarseGridBase<MGVectorType>> mg_coarse;
 
   /// Solver control for the coarse grid solver (intermediate level)
   std::shared_ptr<SolverControl> coarse_grid_solver_control_intermediate;
 
   /// Multigrid wrapper for the coarse grid solver (intermediate level)
-  std::shared_ptr<MGCoarseGridBase<VectorType>> mg_coarse_intermediate;
+  std::shared_ptr<MGCoarseGridBase<MGVectorType>> mg_coarse_intermediate;
 
   /// GMRES as coarse grid solver (intermediate level)
-  std::shared_ptr<SolverGMRES<VectorType>> coarse_grid_solver_intermediate;
+  std::shared_ptr<SolverGMRES<MGVectorType>> coarse_grid_solver_intermediate;
 
   /// Multigrid method (intermediate level)
-  std::shared_ptr<Multigrid<VectorType>> mg_intermediate;
+  std::shared_ptr<Multigrid<MGVectorType>> mg_intermediate;
 
   /// Global coarsening multigrid preconditioner object (intermediate level)
-  std::shared_ptr<PreconditionMG<dim, VectorType, GCTransferType>>
+  std::shared_ptr<PreconditionerTypeGC>
     gc_multigrid_preconditioner_intermediate;
 
   /// Multigrid method
-  std::shared_ptr<Multigrid<VectorType>> mg;
+  std::shared_ptr<Multigrid<MGVectorType>> mg;
 
   /// Local smoothing multigrid preconditioner object
-  std::shared_ptr<PreconditionMG<dim, VectorType, LSTransferType>>
-    ls_multigrid_preconditioner;
+  std::shared_ptr<PreconditionerTypeLS> ls_multigrid_preconditioner;
 
   /// Global coarsening multigrid preconditioner object
-  std::shared_ptr<PreconditionMG<dim, VectorType, GCTransferType>>
-    gc_multigrid_preconditioner;
-
-  /// Conditional Ostream
-  ConditionalOStream pcout;
+  std::shared_ptr<PreconditionerTypeGC> gc_multigrid_preconditioner;
 
   /// Simulation parameters
   SimulationParameters<dim> simulation_parameters;
@@ -264,15 +473,229 @@ private:
   /// Vector holding number of coarse grid iterations
   mutable std::vector<unsigned int> coarse_grid_iterations;
 
-public:
-  /// Timer for specific geometric multigrid components.
-  mutable TimerOutput mg_setup_timer;
+  /// Flag to rebuild the reused components at the next initialization
+  bool rebuild_reused_components = false;
 
-  /// Internal timer for vmult timings
-  mutable TimerOutput mg_vmult_timer;
+  /// Number of outer iterations of the first solve after the last full set up
+  unsigned int reference_outer_iterations = 0;
 };
 
 
+/**
+ * @brief A block preconditioner compatible with the matrix-free solver. It
+ * applies the upper block-triangular factorization of the Jacobian
+ * \f$ \begin{bmatrix} A & B_1 \\ 0 & S \end{bmatrix}^{-1} \f$,
+ * where the coupling block \f$ B_1 \f$ is applied with the matrix-free
+ * system operator. The velocity block \f$ A \f$ is approximated component by
+ * component by the SUPG stabilized advection-diffusion operator and inverted
+ * with one V-cycle of a matrix-free geometric multigrid. The pressure Schur
+ * complement is approximated with the pressure convection-diffusion (PCD)
+ * method \f$ S^{-1} \approx M_p^{-1} F_p A_p^{-1} \f$, where
+ * \f$ M_p \f$ is the pressure mass matrix, \f$ F_p \f$ the
+ * convection-diffusion operator on the pressure space and \f$ A_p \f$ the
+ * pressure Laplacian, all of them applied in a matrix-free fashion.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ */
+template <int dim>
+class MFNavierStokesPreconditionBlockSchur
+  : public MFNavierStokesPreconditionGMGBase<dim>
+{
+  using VectorType         = LinearAlgebra::distributed::Vector<double>;
+  using ScalarOperatorType = AdvectionDiffusionOperator<dim, double>;
+  using ScalarGMGType      = MFAdvectionDiffusionPreconditionGMG<dim>;
+
+public:
+  /**
+   * @brief Construct a new block Schur preconditioner. Creates the scalar
+   * DoFHandler shared by the velocity components and the pressure, the
+   * constraints and the mapping between the DoFs of the vector-valued problem
+   * and the ones of the scalar fields.
+   *
+   * @param[in] simulation_parameters Object containing all parameters specified
+   * in input file.
+   * @param[in] dof_handler Describes the layout of DoFs and the type of FE.
+   * @param[in] mapping Describes the transformations from unit to real cell.
+   * @param[in] cell_quadrature Required for local operations on cells.
+   * @param[in] simulation_control Required to get the time stepping method.
+   * @param[in] system_operator Matrix-free operator of the Jacobian, used to
+   * apply the velocity-pressure coupling block.
+   */
+  MFNavierStokesPreconditionBlockSchur(
+    const SimulationParameters<dim>          &simulation_parameters,
+    const DoFHandler<dim>                    &dof_handler,
+    const std::shared_ptr<Mapping<dim>>      &mapping,
+    const std::shared_ptr<Quadrature<dim>>   &cell_quadrature,
+    const std::shared_ptr<SimulationControl> &simulation_control,
+    const std::shared_ptr<NavierStokesOperatorBase<dim, double>>
+      &system_operator);
+
+  /**
+   * @brief Evaluate the velocity of the linearization point in the velocity
+   * and the pressure convection-diffusion operators and initialize the
+   * multigrid preconditioners of the velocity block and of the pressure
+   * Laplacian.
+   *
+   * @param[in] simulation_control Required to get the time stepping method.
+   * @param[in] flow_control Required for dynamic flow control.
+   * @param[in] present_solution Previous solution needed to evaluate the non
+   * linear term.
+   * @param[in] time_derivative_previous_solutions Vector storing time
+   * derivatives of previous solutions.
+   */
+  void
+  initialize(const std::shared_ptr<SimulationControl> &simulation_control,
+             FlowControl<dim>                         &flow_control,
+             const VectorType                         &present_solution,
+             const VectorType &time_derivative_previous_solutions) override;
+
+  /**
+   * @brief Apply the block preconditioner.
+   *
+   * @param[in,out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const override;
+
+  /**
+   * @brief Prints relevant information of the preconditioner. There is
+   * nothing to report since the inner multigrid cycles use a fixed number
+   * of smoothing steps.
+   */
+  void
+  print_relevant_info() const override;
+
+  /**
+   * @brief Set the kinematic viscosity of the velocity and pressure
+   * operators. The velocity multigrid is created again at the next
+   * initialization since its levels depend on the viscosity.
+   *
+   * @param[in] kinematic_viscosity New value of the kinematic viscosity.
+   */
+  void
+  set_kinematic_viscosity(const double kinematic_viscosity) override;
+
+  /**
+   * @brief Print the timers of the levels. The inner multigrid
+   * preconditioners do not time their levels, so there is nothing to print.
+   */
+  void
+  print_level_timers() const override;
+
+  /**
+   * @brief Monitor the number of iterations of the outer linear solver. No
+   * component is reused across initializations, so this does nothing.
+   *
+   * @param[in] n_iterations Number of iterations of the last outer solve.
+   */
+  void
+  monitor_outer_iterations(const unsigned int n_iterations) override;
+
+private:
+  /**
+   * @brief Initialize the velocity and pressure operators with the present
+   * kinematic viscosity and create the multigrid preconditioner of the
+   * velocity block.
+   */
+  void
+  setup_operators();
+
+  /**
+   * @brief Copy one component of a vector of the vector-valued problem to a
+   * vector of the scalar DoFHandler.
+   *
+   * @param[in] src Vector of the vector-valued problem.
+   * @param[in] component Index of the component to extract.
+   * @param[out] dst Vector of the scalar DoFHandler.
+   */
+  void
+  extract_component(const VectorType  &src,
+                    const unsigned int component,
+                    VectorType        &dst) const;
+
+  /**
+   * @brief Copy a vector of the scalar DoFHandler in one component of a
+   * vector of the vector-valued problem.
+   *
+   * @param[in] src Vector of the scalar DoFHandler.
+   * @param[in] component Index of the component to fill.
+   * @param[in,out] dst Vector of the vector-valued problem.
+   */
+  void
+  insert_component(const VectorType  &src,
+                   const unsigned int component,
+                   VectorType        &dst) const;
+
+  /// Object containing all parameters specified in input file.
+  SimulationParameters<dim> simulation_parameters;
+
+  /// Parameters of the inner multigrid preconditioners.
+  Parameters::LinearSolver scalar_linear_solver_parameters;
+
+  /// Describes the layout of DoFs of the vector-valued problem.
+  const DoFHandler<dim> &dof_handler;
+
+  /// Describes the transformations from unit to real cell.
+  std::shared_ptr<Mapping<dim>> mapping;
+
+  /// Required for local operations on cells.
+  std::shared_ptr<Quadrature<dim>> cell_quadrature;
+
+  /// Required to get the time stepping method.
+  std::shared_ptr<SimulationControl> simulation_control;
+
+  /// Matrix-free operator of the Jacobian.
+  std::shared_ptr<NavierStokesOperatorBase<dim, double>> system_operator;
+
+  /// Present kinematic viscosity.
+  double kinematic_viscosity;
+
+  /// DoFHandler of the scalar fields (velocity components and pressure).
+  DoFHandler<dim> dof_handler_scalar;
+
+  /// Boundary ids on which the velocity is prescribed.
+  std::set<types::boundary_id> velocity_dirichlet_ids;
+
+  /// Boundary ids on which the pressure is prescribed.
+  std::set<types::boundary_id> pressure_dirichlet_ids;
+
+  /// Homogeneous constraints of the velocity components.
+  AffineConstraints<double> velocity_constraints;
+
+  /// Homogeneous constraints of the pressure.
+  AffineConstraints<double> pressure_constraints;
+
+  /// Pairs of local indices of the vector-valued problem and of the scalar
+  /// fields for each component.
+  std::vector<std::vector<std::pair<unsigned int, unsigned int>>>
+    component_indices;
+
+  /// Advection-diffusion operator of a velocity component.
+  ScalarOperatorType velocity_operator;
+
+  /// Multigrid preconditioner of the velocity block.
+  std::shared_ptr<ScalarGMGType> velocity_preconditioner;
+
+  /// Convection-diffusion operator on the pressure space.
+  ScalarOperatorType pressure_operator;
+
+  /// Multigrid preconditioner of the pressure Laplacian.
+  std::shared_ptr<ScalarGMGType> pressure_laplacian_preconditioner;
+
+  /// Inverse diagonal of the pressure mass matrix.
+  DiagonalMatrix<VectorType> pressure_mass_inverse;
+
+  /// Flag to create the velocity preconditioner at the next initialization.
+  bool rebuild_velocity_preconditioner = true;
+
+  /// Temporary vectors of the scalar fields.
+  mutable VectorType scalar_src, scalar_dst, pressure_solution;
+
+  /// Temporary vectors of the vector-valued problem.
+  mutable VectorType system_tmp, system_coupling;
+};
+
 /**
  * @brief A solver for the incompressible Navier-Stokes equations implemented
  * in a matrix-free fashion.
@@ -441,6 +864,14 @@ private:
                      const double absolute_residual,
                      const double relative_residual);
 
+  /**
+   * @brief Create the geometric multigrid preconditioner with the number type
+   * of the levels specified in the simulation parameters, or the block Schur
+   * preconditioner.
+   */
+  void
+  create_GMG();
+
   /**
    * @brief  Setup the geometric multigrid preconditioner and call the solve
    * function of the linear solver.
@@ -453,11 +884,7 @@ private:
    * linear solver. Attention: an actual matrix needs to be constructed using
    * the matrix-free operator.
    */
-  void
-  setup_ILU();
-
-  /**
-   * @brief Prints the setup times for the geometric multigrid preconditioner.
+XX for the geometric multigrid preconditioner.
    *
    */
   void
@@ -474,7 +901,7 @@ protected:
    * @brief Geometric multigrid preconditioner.
    *
    */
-  std::shared_ptr<MFNavierStokesPreconditionGMG<dim>> gmg_preconditioner;
+  std::shared_ptr<MFNavierStokesPreconditionGMGBase<dim>> gmg_preconditioner;
 
   /**
    * @brief Implicit LU preconditioner.
@@ -22,6 +22,7 @@
 
 #include <solvers/simulation_parameters.h>
 
+#include <deal.II/base/thread_local_storage.h>
 #include <deal.II/base/timer.h>
 
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
@@ -35,6 +36,8 @@
 
 #include <deal.II/multigrid/mg_tools.h>
 
+#include <optional>
+
 using namespace dealii;
 
 /**
@@ -322,6 +325,33 @@ public:
     kinematic_viscosity = p_kinematic_viscosity;
   }
 
+  /**
+   * @brief Get the kinematic viscosity of the operator.
+   *
+   * @return Kinematic viscosity.
+   */
+  double
+  get_kinematic_viscosity() const
+  {
+    return kinematic_viscosity;
+  }
+
+  /**
+   * @brief Set whether the values, gradients and stabilization parameters of
+   * the linearization point are stored at the quadrature points or
+   * recomputed on the fly from its DoF values in every cell integral of the
+   * Jacobian and of the residual. Recomputing them reduces the memory
+   * footprint of the operator at the cost of additional operations.
+   *
+   * @param[in] p_recompute_linearization Flag to recompute the linearization
+   * data on the fly.
+   */
+  void
+  set_recompute_linearization(const bool p_recompute_linearization)
+  {
+    recompute_linearization = p_recompute_linearization;
+  }
+
 protected:
   /**
    * @brief Interface to function that performs a cell integral in a cell batch
@@ -334,6 +364,25 @@ protected:
   virtual void
   do_cell_integral_local(FECellIntegrator &integrator) const = 0;
 
+  /**
+   * @brief Compute the stabilization parameters tau and tau lsic at a
+   * quadrature point.
+   *
+   * @param[in] previous_values Values of the linearization point at the
+   * quadrature point.
+   * @param[in] h Element size of the cell batch.
+   * @param[in] sdt Inverse of the time step, zero for steady problems.
+   * @param[out] tau Stabilization parameter tau.
+   * @param[out] tau_lsic Stabilization parameter tau lsic.
+   */
+  void
+  compute_stabilization_parameters(
+    const Tensor<1, dim + 1, VectorizedArray<number>> &previous_values,
+    const VectorizedArray<number>                     &h,
+    const double                                       sdt,
+    VectorizedArray<number>                           &tau,
+    VectorizedArray<number>                           &tau_lsic) const;
+
   /**
    * @brief Loop over all cell batches within certain range and perform a cell
    * integral with access to global vectors, i.e., gathering and scattering
@@ -366,8 +415,8 @@ protected:
   /**
    * @brief Loop over all boundary face batches within certain range and perform a face
    * integral with access to global vectors, i.e., gathering and scattering
-   * values. This is used to weakly impose Dirichlet boundary conditions or
-   * outlet boundary conditions.
+   * values. This is used to weakly impose Dirichlet, outlet, pressure and
+   * partial slip boundary conditions.
    *
    * @tparam assemble_residual Flag to assemble the residual or the Jacobian.
    *
@@ -505,7 +554,8 @@ protected:
   /**
    * @brief  Boundary conditions object to impose the correct boundary conditions. This object
    * is only used to impose boundary conditions that appear in the weak form as
-   * face terms (Weak Dirichlet boundary conditions and, eventually, outlets).
+   * face terms (weak Dirichlet, outlet, pressure and partial slip boundary
+   * conditions).
    * However, the entire boundary_conditions object is stored instead of trying
    * to isolate which parameters are used since many of them are used in the
    * initialization of the boundary conditions.
@@ -533,7 +583,8 @@ protected:
 
   /**
    * @brief Flag to turn the calculation of face terms on or off.
-   * This is used for weakly imposed Dirichlet boundary conditions or outlets.
+   * This is used for weakly imposed Dirichlet, outlet, pressure and partial
+   * slip boundary conditions.
    *
    */
   bool enable_face_terms;
@@ -585,6 +636,13 @@ protected:
    */
   Table<2, Tensor<1, dim, VectorizedArray<number>>> face_target_velocity;
 
+  /**
+   * @brief Table with correct alignment for vectorization to store the values
+   * of the target pressure of a pressure boundary condition.
+   *
+   */
+  Table<2, VectorizedArray<number>> face_target_pressure;
+
 
   /**
    * @brief Table with correct alignment for vectorization to store the values
@@ -600,6 +658,39 @@ protected:
    */
   Table<2, VectorizedArray<number>> stabilization_parameter_lsic;
 
+  /**
+   * @brief Flag to recompute the linearization data at the quadrature points
+   * in the cell integrals instead of storing it in tables.
+   *
+   */
+  bool recompute_linearization = false;
+
+  /**
+   * @brief DoF values of the linearization point. Only used if the
+   * linearization data is recomputed on the fly.
+   *
+   */
+  VectorType linearization_point;
+
+  /**
+   * @brief DoF values of the time derivatives of previous solutions. Only used
+   * if the linearization data is recomputed on the fly.
+   *
+   */
+  VectorType linearization_time_derivatives;
+
+  /**
+   * @brief Integrators used to interpolate the linearization point and the
+   * time derivatives in the cell integrals. They are created once per thread,
+   * since the cell loops may run on several threads when more than one
+   * assembly thread is used, and are only reinitialized on each cell batch.
+   *
+   */
+  mutable Threads::ThreadLocalStorage<std::optional<FECellIntegrator>>
+    linearization_integrator_storage;
+  mutable Threads::ThreadLocalStorage<std::optional<FECellIntegrator>>
+    time_derivatives_integrator_storage;
+
 
   /**
    * @brief Table with correct alignment for vectorization to store the values
@@ -37,6 +37,9 @@
 #include <core/simulation_control.h>
 #include <core/vector.h>
 
+#include <solvers/advection_diffusion_matrix_free_operators.h>
+#include <solvers/advection_diffusion_matrix_free_preconditioner.h>
+#include <solvers/assembly_coloring.h>
 #include <solvers/auxiliary_physics.h>
 #include <solvers/heat_transfer_assemblers.h>
 #include <solvers/heat_transfer_scratch_data.h>
@@ -147,6 +150,12 @@ public:
             this->dof_handler));
       }
 
+    // The matrix-free operator replaces the system matrix when the geometric
+    // multigrid preconditioner is selected
+    use_matrix_free =
+      simulation_parameters.linear_solver.at(PhysicsID::heat_transfer)
+        .preconditioner == Parameters::LinearSolver::PreconditionerType::gcmg;
+
     // Change the behavior of the timer for situations when you don't want
     // outputs
     if (simulation_parameters.timer.type == Parameters::Timer::Type::none)
@@ -485,6 +494,33 @@ private:
   virtual void
   copy_local_rhs_to_global_rhs(const StabilizedMethodsCopyData &copy_data);
 
+  /**
+   * @brief Create the matrix-free operator and the geometric multigrid
+   * preconditioner used instead of the system matrix when the gcmg
+   * preconditioner is selected. Only constant physical properties and
+   * single phase simulations are supported.
+   */
+  void
+  setup_matrix_free();
+
+  /**
+   * @brief Store the velocity of the fluid in the matrix-free operator and
+   * initialize the geometric multigrid preconditioner. Replaces the assembly
+   * of the system matrix when the matrix-free operator is used.
+   */
+  void
+  update_matrix_free();
+
+  /**
+   * @brief Solve the linear system with GMRES using the matrix-free operator
+   * and the geometric multigrid preconditioner.
+   *
+   * @param initial_step Provides the linear solver with indication if this
+   * solution is the first one for the system of equation or not.
+   */
+  void
+  solve_linear_system_matrix_free(const bool initial_step);
+
   /**
    * @brief Post-processing.
    * Calculate temperature statistics on the domain : Max, min, average and
@@ -729,6 +765,29 @@ private:
    */
   TrilinosWrappers::SparseMatrix system_matrix;
 
+  /**
+   * @brief Coloring of the cells used by the assembly if the colored assembly
+   * is enabled.
+   */
+  std::shared_ptr<AssemblyColoring<dim>> assembly_coloring;
+
+  /**
+   * @brief Whether the system matrix is replaced by a matrix-free operator
+   * preconditioned with geometric multigrid. Enabled when the preconditioner
+   * of the heat transfer linear solver is gcmg.
+   */
+  bool use_matrix_free;
+
+  /**
+   * @brief Matrix-free operator of the Jacobian.
+   */
+  std::shared_ptr<AdvectionDiffusionOperator<dim, double>> system_operator;
+
+  /**
+   * @brief Geometric multigrid preconditioner of the matrix-free operator.
+   */
+  std::shared_ptr<MFAdvectionDiffusionPreconditionGMG<dim>> gmg_preconditioner;
+
 
   /**
    * @brief Previous solution vector.
@@ -444,8 +444,8 @@ public:
 
 
   // Physical properties
-  PhysicalPropertiesManager            properties_manager;
-  std::map<field, std::vector<double>> fields;
+  PhysicalPropertiesManager properties_manager;
+  FieldVectors              fields;
   dealii::types::material_id           material_id;
   std::vector<double>                  specific_heat;
   std::vector<double>                  thermal_conductivity;
@@ -22,6 +22,7 @@
 #ifndef lethe_multiphysics_interface_h
 #define lethe_multiphysics_interface_h
 
+#include <core/anderson_acceleration.h>
 #include <core/exceptions.h>
 #include <core/multiphysics.h>
 #include <core/parameters_multiphysics.h>
@@ -189,6 +190,106 @@ public:
     block_physics[physics_id]->modify_solution();
   }
 
+  /**
+   * @brief Return the maximal number of coupling iterations between the fluid
+   * dynamics and the auxiliary physics solved after it within a time step.
+   */
+  unsigned int
+  get_max_coupling_iterations() const
+  {
+    return multiphysics_parameters.coupling_parameters.max_iterations;
+  }
+
+  /**
+   * @brief Start the coupling iterations of a time step. The present solutions
+   * of the auxiliary physics solved after the fluid dynamics are stored as the
+   * first iterate of the fixed-point iteration.
+   */
+  void
+  initialize_coupling_iterations()
+  {
+    coupling_acceleration.clear();
+    coupling_iterate.clear();
+
+    // The auxiliary physics solved before the fluid dynamics are percolated
+    // before the fluid dynamics is solved and cannot be solved again within
+    // the time step. Only the auxiliary physics solved after it are coupled.
+    for (auto &iphys : physics)
+      if (!solve_pre_fluid[iphys.first])
+        {
+          const DoFHandler<dim> &dof_handler = iphys.second->get_dof_handler();
+          coupling_iterate.emplace_back(dof_handler.locally_owned_dofs(),
+                                        dof_handler.get_communicator());
+          coupling_iterate.back() = iphys.second->get_present_solution();
+        }
+  }
+
+  /**
+   * @brief Finish a coupling iteration once the fluid dynamics and the
+   * auxiliary physics solved after it have been solved. If the coupling has
+   * not converged, the next iterate computed by the Anderson acceleration is
+   * set as the present solution of the coupled auxiliary physics.
+   *
+   * @param[in] iteration Index of the coupling iteration.
+   *
+   * @return True if the relative change of the solutions of the coupled
+   * auxiliary physics is below the coupling tolerance. The solutions are not
+   * modified in that case or at the last coupling iteration.
+   */
+  bool
+  update_coupling_iterations(const unsigned int iteration)
+  {
+    if (coupling_iterate.empty())
+      return true;
+
+    std::vector<GlobalVectorType> evaluation;
+    unsigned int                  i = 0;
+    for (auto &iphys : physics)
+      if (!solve_pre_fluid[iphys.first])
+        {
+          evaluation.emplace_back(coupling_iterate[i++]);
+          evaluation.back() = iphys.second->get_present_solution();
+        }
+
+    double evaluation_norm = 0;
+    for (const auto &vector : evaluation)
+      evaluation_norm += vector.norm_sqr();
+    evaluation_norm = std::sqrt(evaluation_norm);
+
+    const double residual_norm =
+      coupling_acceleration.update(coupling_iterate, evaluation);
+    const bool has_converged =
+      residual_norm <=
+      multiphysics_parameters.coupling_parameters.tolerance * evaluation_norm;
+
+    if (multiphysics_parameters.coupling_parameters.verbosity !=
+        Parameters::Verbosity::quiet)
+      {
+        pcout << "   Coupling iteration: " << iteration + 1
+              << "  Relative change: "
+              << residual_norm / std::max(evaluation_norm, 1e-300)
+              << std::endl;
+      }
+
+    // The solutions of the last coupling iteration are kept as they are
+    if (has_converged ||
+        iteration + 1 >=
+          multiphysics_parameters.coupling_parameters.max_iterations)
+      return has_converged;
+
+    // The next iterate becomes the present solution of the coupled physics
+    i = 0;
+    for (auto &iphys : physics)
+      if (!solve_pre_fluid[iphys.first])
+        {
+          iphys.second->get_present_solution() = evaluation[i];
+          coupling_iterate[i]                  = evaluation[i];
+          ++i;
+        }
+
+    return false;
+  }
+
 
   /**
    * @brief Call the attachment of the solution vector to the data out for enabled
@@ -929,6 +1030,11 @@ private:
   std::map<PhysicsID, GlobalVectorType *>      physics_solutions_m1;
   std::map<PhysicsID, GlobalBlockVectorType *> block_physics_solutions_m1;
 
+  // Acceleration of the coupling iterations and present iterate, made of the
+  // solutions of the auxiliary physics solved after the fluid dynamics
+  AndersonAcceleration<GlobalVectorType> coupling_acceleration;
+  std::vector<GlobalVectorType>          coupling_iterate;
+
   // Checks the required dependencies between multiphase models and handles the
   // corresponding assertions
   void
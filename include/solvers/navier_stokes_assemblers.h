@@ -24,6 +24,8 @@
 #include <solvers/copy_data.h>
 #include <solvers/navier_stokes_scratch_data.h>
 
+#include <tuple>
+
 
 /*
  * Exceptions used to capture incoherent setup of assemblers
@@ -78,6 +80,40 @@ public:
                StabilizedMethodsTensorCopyData<dim> &copy_data) = 0;
 };
 
+/**
+ * @brief Time-stepping information used by the assemblers that provide
+ * quadrature point kernels. It is gathered once per cell and shared by the
+ * kernels at all the quadrature points of the cell.
+ *
+ * @ingroup assemblers
+ */
+struct NavierStokesTimeSteppingData
+{
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] simulation_control SimulationControl object of the solver.
+   */
+  NavierStokesTimeSteppingData(SimulationControl &simulation_control)
+    : method(simulation_control.get_assembly_method())
+    , sdt(1. / simulation_control.get_time_steps_vector()[0])
+    , bdf_coefs(&simulation_control.get_bdf_coefficients())
+    , n_previous_solutions(number_of_previous_solutions(method))
+  {}
+
+  /// Time-stepping method used for the assembly
+  const Parameters::SimulationControl::TimeSteppingMethod method;
+
+  /// Inverse of the current time step
+  const double sdt;
+
+  /// BDF coefficients of the current time step
+  const Vector<double> *bdf_coefs;
+
+  /// Number of previous solutions used by the time-stepping method
+  const unsigned int n_previous_solutions;
+};
+
 /**
  * @brief Class that assembles the core of the Navier-Stokes equation.
  * According to the following weak form:
@@ -118,6 +154,38 @@ public:
   assemble_rhs(NavierStokesScratchData<dim>         &scratch_data,
                StabilizedMethodsTensorCopyData<dim> &copy_data) override;
 
+  /**
+   * @brief Assemble the matrix at a single quadrature point. Used by
+   * assemble_matrix and by the NavierStokesAssemblerPipeline.
+   *
+   * @param[in] q Index of the quadrature point.
+   * @param[in] time_data Time-stepping information of the cell.
+   * @param[in] scratch_data (see base class)
+   * @param[in,out] copy_data (see base class)
+   */
+  void
+  assemble_matrix_at_quadrature_point(
+    const unsigned int                    q,
+    const NavierStokesTimeSteppingData   &time_data,
+    NavierStokesScratchData<dim>         &scratch_data,
+    StabilizedMethodsTensorCopyData<dim> &copy_data) const;
+
+  /**
+   * @brief Assemble the rhs at a single quadrature point. Used by
+   * assemble_rhs and by the NavierStokesAssemblerPipeline.
+   *
+   * @param[in] q Index of the quadrature point.
+   * @param[in] time_data Time-stepping information of the cell.
+   * @param[in] scratch_data (see base class)
+   * @param[in,out] copy_data (see base class)
+   */
+  void
+  assemble_rhs_at_quadrature_point(
+    const unsigned int                    q,
+    const NavierStokesTimeSteppingData   &time_data,
+    NavierStokesScratchData<dim>         &scratch_data,
+    StabilizedMethodsTensorCopyData<dim> &copy_data) const;
+
   std::shared_ptr<SimulationControl> simulation_control;
 };
 
@@ -162,6 +230,38 @@ public:
   assemble_rhs(NavierStokesScratchData<dim>         &scratch_data,
                StabilizedMethodsTensorCopyData<dim> &copy_data) override;
 
+  /**
+   * @brief Assemble the matrix at a single quadrature point. Used by
+   * assemble_matrix and by the NavierStokesAssemblerPipeline.
+   *
+   * @param[in] q Index of the quadrature point.
+   * @param[in] time_data Time-stepping information of the cell.
+   * @param[in] scratch_data (see base class)
+   * @param[in,out] copy_data (see base class)
+   */
+  void
+  assemble_matrix_at_quadrature_point(
+    const unsigned int                    q,
+    const NavierStokesTimeSteppingData   &time_data,
+    NavierStokesScratchData<dim>         &scratch_data,
+    StabilizedMethodsTensorCopyData<dim> &copy_data) const;
+
+  /**
+   * @brief Assemble the rhs at a single quadrature point. Used by
+   * assemble_rhs and by the NavierStokesAssemblerPipeline.
+   *
+   * @param[in] q Index of the quadrature point.
+   * @param[in] time_data Time-stepping information of the cell.
+   * @param[in] scratch_data (see base class)
+   * @param[in,out] copy_data (see base class)
+   */
+  void
+  assemble_rhs_at_quadrature_point(
+    const unsigned int                    q,
+    const NavierStokesTimeSteppingData   &time_data,
+    NavierStokesScratchData<dim>         &scratch_data,
+    StabilizedMethodsTensorCopyData<dim> &copy_data) const;
+
   std::shared_ptr<SimulationControl> simulation_control;
 };
 
@@ -352,7 +452,90 @@ public:
   assemble_rhs(NavierStokesScratchData<dim>         &scratch_data,
                StabilizedMethodsTensorCopyData<dim> &copy_data) override;
 
+  /**
+   * @brief Assemble the matrix at a single quadrature point. Used by
+   * assemble_matrix and by the NavierStokesAssemblerPipeline.
+   *
+   * @param[in] q Index of the quadrature point.
+   * @param[in] time_data Time-stepping information of the cell.
+   * @param[in] scratch_data (see base class)
+   * @param[in,out] copy_data (see base class)
+   */
+  void
+  assemble_matrix_at_quadrature_point(
+    const unsigned int                    q,
+    const NavierStokesTimeSteppingData   &time_data,
+    NavierStokesScratchData<dim>         &scratch_data,
+    StabilizedMethodsTensorCopyData<dim> &copy_data) const;
+
+  /**
+   * @brief Assemble the rhs at a single quadrature point. Used by
+   * assemble_rhs and by the NavierStokesAssemblerPipeline.
+   *
+   * @param[in] q Index of the quadrature point.
+   * @param[in] time_data Time-stepping information of the cell.
+   * @param[in] scratch_data (see base class)
+   * @param[in,out] copy_data (see base class)
+   */
+  void
+  assemble_rhs_at_quadrature_point(
+    const unsigned int                    q,
+    const NavierStokesTimeSteppingData   &time_data,
+    NavierStokesScratchData<dim>         &scratch_data,
+    StabilizedMethodsTensorCopyData<dim> &copy_data) const;
+
+  std::shared_ptr<SimulationControl> simulation_control;
+};
+
+/**
+ * @brief Class that fuses a sequence of assemblers into a single loop over the
+ * quadrature points of a cell. At every quadrature point, the quadrature point
+ * kernels of the assemblers are called in the order of the parameter pack.
+ * The contributions of an assembler to the strong residual and the strong
+ * jacobian are thus available to the following assemblers, as for a sequence
+ * of separate assemblers. Since the kernels are not virtual, they are inlined
+ * in the loop and the fields and shape functions of the scratch data at a
+ * quadrature point are shared by the assemblers while they are in cache.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions
+ * @tparam AssemblerTypes Assemblers that are constructed from the
+ * SimulationControl and that provide assemble_matrix_at_quadrature_point and
+ * assemble_rhs_at_quadrature_point.
+ *
+ * @ingroup assemblers
+ */
+template <int dim, typename... AssemblerTypes>
+class NavierStokesAssemblerPipeline : public NavierStokesAssemblerBase<dim>
+{
+public:
+  NavierStokesAssemblerPipeline(
+    std::shared_ptr<SimulationControl> simulation_control)
+    : simulation_control(simulation_control)
+    , assemblers(AssemblerTypes(simulation_control)...)
+  {}
+
+  /**
+   * @brief assemble_matrix Assembles the matrix of all the assemblers
+   * @param scratch_data (see base class)
+   * @param copy_data (see base class)
+   */
+  virtual void
+  assemble_matrix(NavierStokesScratchData<dim>         &scratch_data,
+                  StabilizedMethodsTensorCopyData<dim> &copy_data) override;
+
+  /**
+   * @brief assemble_rhs Assembles the rhs of all the assemblers
+   * @param scratch_data (see base class)
+   * @param copy_data (see base class)
+   */
+  virtual void
+  assemble_rhs(NavierStokesScratchData<dim>         &scratch_data,
+               StabilizedMethodsTensorCopyData<dim> &copy_data) override;
+
   std::shared_ptr<SimulationControl> simulation_control;
+
+private:
+  std::tuple<AssemblerTypes...> assemblers;
 };
 
 
@@ -27,9 +27,11 @@
 #include <core/time_integration_utilities.h>
 
 #include <solvers/cahn_hilliard_filter.h>
+#include <solvers/navier_stokes_shape_data_cache.h>
 #include <solvers/physical_properties_manager.h>
 #include <solvers/vof_filter.h>
 
+#include <deal.II/base/array_view.h>
 #include <deal.II/base/quadrature.h>
 
 #include <deal.II/dofs/dof_renumbering.h>
@@ -107,6 +109,7 @@ public:
                 quadrature,
                 update_values | update_quadrature_points | update_JxW_values |
                   update_gradients | update_hessians)
+    , fe_values_cached_cells(mapping, fe, quadrature, update_quadrature_points)
     , fe_face_values(mapping,
                      fe,
                      face_quadrature,
@@ -145,6 +148,10 @@ public:
                 sd.fe_values.get_quadrature(),
                 update_values | update_quadrature_points | update_JxW_values |
                   update_gradients | update_hessians)
+    , fe_values_cached_cells(sd.fe_values.get_mapping(),
+                             sd.fe_values.get_fe(),
+                             sd.fe_values.get_quadrature(),
+                             update_quadrature_points)
     , fe_face_values(sd.fe_face_values.get_mapping(),
                      sd.fe_face_values.get_fe(),
                      sd.fe_face_values.get_quadrature(),
@@ -198,7 +205,8 @@ public:
                            sd.fe_values_cahn_hilliard->get_mapping(),
                            sd.cahn_hilliard_filter);
 
-    gather_hessian = sd.gather_hessian;
+    gather_hessian   = sd.gather_hessian;
+    shape_data_cache = sd.shape_data_cache;
   }
 
 
@@ -241,10 +249,24 @@ public:
          Tensor<1, dim>                 beta_force,
          const double                   pressure_scaling_factor)
   {
-    this->fe_values.reinit(cell);
+    // The shape functions and the JxW values of the cells stored in the shape
+    // data cache are read from the cache. For these cells, the FEValues only
+    // evaluate the quadrature points.
+    const typename NavierStokesShapeDataCache<dim>::ShapeData *cached_data =
+      shape_data_cache ? shape_data_cache->get_shape_data(cell) : nullptr;
 
-    quadrature_points = this->fe_values.get_quadrature_points();
-    auto &fe          = this->fe_values.get_fe();
+    if (cached_data != nullptr)
+      {
+        this->fe_values_cached_cells.reinit(cell);
+        quadrature_points =
+          this->fe_values_cached_cells.get_quadrature_points();
+      }
+    else
+      {
+        this->fe_values.reinit(cell);
+        quadrature_points = this->fe_values.get_quadrature_points();
+      }
+    auto &fe = this->fe_values.get_fe();
 
     forcing_function->vector_value_list(quadrature_points, this->rhs_force);
 
@@ -272,66 +294,88 @@ public:
         components[k] = fe.system_to_component_index(k).first;
       }
 
-    // Compute cell diameter
-    double cell_measure =
-      compute_cell_measure_with_JxW(this->fe_values.get_JxW_values());
-    this->cell_size = compute_cell_diameter<dim>(cell_measure, fe.degree);
-
-    // Gather velocity (values, gradient and laplacian)
-    this->fe_values[velocities].get_function_values(current_solution,
-                                                    this->velocity_values);
-    this->fe_values[velocities].get_function_gradients(
-      current_solution, this->velocity_gradients);
-    this->fe_values[velocities].get_function_laplacians(
-      current_solution, this->velocity_laplacians);
-    if (gather_hessian)
-      this->fe_values[velocities].get_function_hessians(
-        current_solution, this->velocity_hessians);
-
-    for (unsigned int q = 0; q < this->n_q_points; ++q)
+    if (cached_data != nullptr)
+      set_shape_function_views(*cached_data);
+    else
       {
-        this->velocity_divergences[q] = trace(this->velocity_gradients[q]);
+        for (unsigned int q = 0; q < n_q_points; ++q)
+          {
+            this->cell_shape_data.JxW[q] = this->fe_values.JxW(q);
+            for (unsigned int k = 0; k < n_dofs; ++k)
+              {
+                // Velocity
+                this->cell_shape_data.phi_u[q][k] =
+                  this->fe_values[velocities].value(k, q);
+                this->cell_shape_data.div_phi_u[q][k] =
+                  this->fe_values[velocities].divergence(k, q);
+                this->cell_shape_data.grad_phi_u[q][k] =
+                  this->fe_values[velocities].gradient(k, q);
+                this->cell_shape_data.hess_phi_u[q][k] =
+                  this->fe_values[velocities].hessian(k, q);
+                for (int d = 0; d < dim; ++d)
+                  this->cell_shape_data.laplacian_phi_u[q][k][d] =
+                    trace(this->cell_shape_data.hess_phi_u[q][k][d]);
+                // Pressure
+                this->cell_shape_data.phi_p[q][k] =
+                  this->fe_values[pressure].value(k, q);
+                this->cell_shape_data.grad_phi_p[q][k] =
+                  this->fe_values[pressure].gradient(k, q);
+              }
+          }
+        set_shape_function_views(this->cell_shape_data);
       }
 
-    // Gather pressure (values, gradient)
-    fe_values[pressure].get_function_values(current_solution,
-                                            this->pressure_values);
-    fe_values[pressure].get_function_gradients(current_solution,
-                                               this->pressure_gradients);
+    // Compute cell diameter
+    double cell_measure = compute_cell_measure_with_JxW(this->JxW);
+    this->cell_size     = compute_cell_diameter<dim>(cell_measure, fe.degree);
+
     this->pressure_scaling_factor = pressure_scaling_factor;
 
-    for (unsigned int p = 0; p < previous_solutions.size(); ++p)
+    if (cached_data != nullptr)
       {
-        this->fe_values[velocities].get_function_values(
-          previous_solutions[p], previous_velocity_values[p]);
+        // The solution fields are interpolated with the cached shape functions
+        reinit_fields_from_shape_data(cell,
+                                      current_solution,
+                                      previous_solutions);
       }
-
-    // Only gather the pressure when a pressure history is necessary
-    // (compressible Navier-Stokes)
-    if (!this->properties_manager.density_is_constant())
-      for (unsigned int p = 0; p < previous_solutions.size(); ++p)
-        {
-          this->fe_values[pressure].get_function_values(
-            previous_solutions[p], previous_pressure_values[p]);
-        }
-
-    for (unsigned int q = 0; q < n_q_points; ++q)
+    else
       {
-        this->JxW[q] = this->fe_values.JxW(q);
-        for (unsigned int k = 0; k < n_dofs; ++k)
+        // Gather velocity (values, gradient and laplacian)
+        this->fe_values[velocities].get_function_values(current_solution,
+                                                        this->velocity_values);
+        this->fe_values[velocities].get_function_gradients(
+          current_solution, this->velocity_gradients);
+        this->fe_values[velocities].get_function_laplacians(
+          current_solution, this->velocity_laplacians);
+        if (gather_hessian)
+          this->fe_values[velocities].get_function_hessians(
+            current_solution, this->velocity_hessians);
+
+        // Gather pressure (values, gradient)
+        fe_values[pressure].get_function_values(current_solution,
+                                                this->pressure_values);
+        fe_values[pressure].get_function_gradients(current_solution,
+                                                   this->pressure_gradients);
+
+        for (unsigned int p = 0; p < previous_solutions.size(); ++p)
           {
-            // Velocity
-            this->phi_u[q][k] = this->fe_values[velocities].value(k, q);
-            this->div_phi_u[q][k] =
-              this->fe_values[velocities].divergence(k, q);
-            this->grad_phi_u[q][k] = this->fe_values[velocities].gradient(k, q);
-            this->hess_phi_u[q][k] = this->fe_values[velocities].hessian(k, q);
-            for (int d = 0; d < dim; ++d)
-              this->laplacian_phi_u[q][k][d] = trace(this->hess_phi_u[q][k][d]);
-            // Pressure
-            this->phi_p[q][k]      = this->fe_values[pressure].value(k, q);
-            this->grad_phi_p[q][k] = this->fe_values[pressure].gradient(k, q);
+            this->fe_values[velocities].get_function_values(
+              previous_solutions[p], previous_velocity_values[p]);
           }
+
+        // Only gather the pressure when a pressure history is necessary
+        // (compressible Navier-Stokes)
+        if (!this->properties_manager.density_is_constant())
+          for (unsigned int p = 0; p < previous_solutions.size(); ++p)
+            {
+              this->fe_values[pressure].get_function_values(
+                previous_solutions[p], previous_pressure_values[p]);
+            }
+      }
+
+    for (unsigned int q = 0; q < this->n_q_points; ++q)
+      {
+        this->velocity_divergences[q] = trace(this->velocity_gradients[q]);
       }
 
     is_boundary_cell = cell->at_boundary();
@@ -474,6 +518,129 @@ public:
   }
 
 
+  /**
+   * @brief Enable the use of a cache of the shape functions by the reinit
+   * function. The cache must be initialized with the mesh, the mapping and the
+   * quadrature of the scratch.
+   *
+   * @param[in] cache Cache of the shape functions of the affine cells.
+   */
+  void
+  enable_shape_data_cache(
+    const std::shared_ptr<const NavierStokesShapeDataCache<dim>> &cache)
+  {
+    shape_data_cache = cache;
+  }
+
+  /**
+   * @brief Point the shape functions and the JxW values of the scratch to the
+   * arrays of a shape data, which is either the shape data of the scratch or
+   * an entry of the shape data cache.
+   *
+   * @param[in] data Shape data of the current cell.
+   */
+  void
+  set_shape_function_views(
+    const typename NavierStokesShapeDataCache<dim>::ShapeData &data)
+  {
+    this->JxW             = make_array_view(data.JxW);
+    this->div_phi_u       = make_array_view(data.div_phi_u);
+    this->phi_u           = make_array_view(data.phi_u);
+    this->hess_phi_u      = make_array_view(data.hess_phi_u);
+    this->laplacian_phi_u = make_array_view(data.laplacian_phi_u);
+    this->grad_phi_u      = make_array_view(data.grad_phi_u);
+    this->phi_p           = make_array_view(data.phi_p);
+    this->grad_phi_p      = make_array_view(data.grad_phi_p);
+  }
+
+  /**
+   * @brief Interpolate the velocity and the pressure fields of a cell whose
+   * shape functions are read from the shape data cache. The FEValues of the
+   * scratch are not reinitialized with the shape functions for these cells,
+   * so the fields are evaluated from the DoF values of the cell and the shape
+   * functions of the cache.
+   *
+   * @param[in] cell The cell over which the assembly is being carried.
+   *
+   * @param[in] current_solution The present value of the solution for [u,p].
+   *
+   * @param[in] previous_solutions The solutions at the previous time steps.
+   */
+  template <typename VectorType>
+  void
+  reinit_fields_from_shape_data(
+    const typename DoFHandler<dim>::active_cell_iterator &cell,
+    const VectorType                                     &current_solution,
+    const std::vector<VectorType>                        &previous_solutions)
+  {
+    cell->get_dof_values(current_solution, this->cell_dof_values);
+
+    for (unsigned int q = 0; q < n_q_points; ++q)
+      {
+        this->velocity_values[q]     = 0;
+        this->velocity_gradients[q]  = 0;
+        this->velocity_laplacians[q] = 0;
+        if (gather_hessian)
+          this->velocity_hessians[q] = 0;
+        this->pressure_values[q]    = 0;
+        this->pressure_gradients[q] = 0;
+
+        // Each shape function is only non-zero in its own component
+        for (unsigned int k = 0; k < n_dofs; ++k)
+          {
+            const unsigned int component = components[k];
+            const double       dof_value = this->cell_dof_values[k];
+            if (component < dim)
+              {
+                this->velocity_values[q][component] +=
+                  dof_value * this->phi_u[q][k][component];
+                this->velocity_gradients[q][component] +=
+                  dof_value * this->grad_phi_u[q][k][component];
+                this->velocity_laplacians[q][component] +=
+                  dof_value * this->laplacian_phi_u[q][k][component];
+                if (gather_hessian)
+                  this->velocity_hessians[q][component] +=
+                    dof_value * this->hess_phi_u[q][k][component];
+              }
+            else
+              {
+                this->pressure_values[q] += dof_value * this->phi_p[q][k];
+                this->pressure_gradients[q] +=
+                  dof_value * this->grad_phi_p[q][k];
+              }
+          }
+      }
+
+    // Only gather the pressure when a pressure history is necessary
+    // (compressible Navier-Stokes)
+    const bool gather_previous_pressure =
+      !this->properties_manager.density_is_constant();
+
+    for (unsigned int p = 0; p < previous_solutions.size(); ++p)
+      {
+        cell->get_dof_values(previous_solutions[p], this->cell_dof_values);
+
+        for (unsigned int q = 0; q < n_q_points; ++q)
+          {
+            this->previous_velocity_values[p][q] = 0;
+            if (gather_previous_pressure)
+              this->previous_pressure_values[p][q] = 0;
+
+            for (unsigned int k = 0; k < n_dofs; ++k)
+              {
+                const unsigned int component = components[k];
+                const double       dof_value = this->cell_dof_values[k];
+                if (component < dim)
+                  this->previous_velocity_values[p][q][component] +=
+                    dof_value * this->phi_u[q][k][component];
+                else if (gather_previous_pressure)
+                  this->previous_pressure_values[p][q] +=
+                    dof_value * this->phi_p[q][k];
+              }
+          }
+      }
+  }
+
   /**
    * @brief enable_vof Enables the collection of the VOF data by the scratch
    *
@@ -675,7 +842,7 @@ public:
   template <typename VectorType>
   void
   reinit_particle_fluid_interactions(
-    const typename DoFHandler<dim>::active_cell_iterator & /*cell*/,
+    const typename DoFHandler<dim>::active_cell_iterator &cell,
     const VectorType & /*current_solution*/,
     const VectorType                      &previous_solution,
     const VectorType                      &void_fraction_solution,
@@ -683,11 +850,10 @@ public:
     DoFHandler<dim>                       &dof_handler,
     DoFHandler<dim>                       &void_fraction_dof_handler)
   {
-    pic = particle_handler.particles_in_cell(this->fe_values.get_cell());
+    pic = particle_handler.particles_in_cell(cell);
 
     average_particle_velocity = 0;
-    cell_volume =
-      compute_cell_measure_with_JxW(this->fe_values.get_JxW_values());
+    cell_volume               = compute_cell_measure_with_JxW(this->JxW);
 
     // Loop over particles in cell
     double total_particle_volume = 0;
@@ -780,8 +946,7 @@ public:
     // Evaluate the relevant information at the
     // quadrature points to do the interpolation.
     const auto &velocity_cell =
-      typename DoFHandler<dim>::cell_iterator(*this->fe_values.get_cell(),
-                                              &dof_handler);
+      typename DoFHandler<dim>::cell_iterator(*cell, &dof_handler);
 
     fe_values_local_particles.reinit(velocity_cell);
 
@@ -1015,8 +1180,8 @@ public:
   const std::shared_ptr<SimulationControl> simulation_control;
 
   // Physical properties
-  const PhysicalPropertiesManager      properties_manager;
-  std::map<field, std::vector<double>> fields;
+  const PhysicalPropertiesManager properties_manager;
+  FieldVectors                    fields;
   std::vector<double>                  density;
   double                               density_ref;
   double                               density_psi;
@@ -1064,7 +1229,10 @@ public:
   std::vector<double> surface_tension_gradient;
 
   // FEValues for the Navier-Stokes problem
-  FEValues<dim>              fe_values;
+  FEValues<dim> fe_values;
+  // FEValues of the cells whose shape functions are read from the shape data
+  // cache, which only evaluates the quadrature points
+  FEValues<dim>              fe_values_cached_cells;
   unsigned int               n_dofs;
   unsigned int               n_q_points;
   double                     cell_size;
@@ -1077,7 +1245,7 @@ public:
   std::vector<double>         mass_source;
 
   // Quadrature
-  std::vector<double>     JxW;
+  ArrayView<const double> JxW;
   std::vector<Point<dim>> quadrature_points;
 
   // Components index
@@ -1095,14 +1263,23 @@ public:
   std::vector<std::vector<double>>         previous_pressure_values;
   std::vector<std::vector<Tensor<1, dim>>> previous_velocity_values;
 
-  // Shape functions
-  std::vector<std::vector<double>>         div_phi_u;
-  std::vector<std::vector<Tensor<1, dim>>> phi_u;
-  std::vector<std::vector<Tensor<3, dim>>> hess_phi_u;
-  std::vector<std::vector<Tensor<1, dim>>> laplacian_phi_u;
-  std::vector<std::vector<Tensor<2, dim>>> grad_phi_u;
-  std::vector<std::vector<double>>         phi_p;
-  std::vector<std::vector<Tensor<1, dim>>> grad_phi_p;
+  // Shape functions. They point either to the cell_shape_data of the scratch
+  // or to an entry of the shape data cache.
+  ArrayView<const std::vector<double>>         div_phi_u;
+  ArrayView<const std::vector<Tensor<1, dim>>> phi_u;
+  ArrayView<const std::vector<Tensor<3, dim>>> hess_phi_u;
+  ArrayView<const std::vector<Tensor<1, dim>>> laplacian_phi_u;
+  ArrayView<const std::vector<Tensor<2, dim>>> grad_phi_u;
+  ArrayView<const std::vector<double>>         phi_p;
+  ArrayView<const std::vector<Tensor<1, dim>>> grad_phi_p;
+
+  // Shape functions and JxW values of the cells that are not in the shape data
+  // cache, evaluated with the FEValues
+  typename NavierStokesShapeDataCache<dim>::ShapeData cell_shape_data;
+
+  // DoF values of the cell, used to interpolate the fields of the cells whose
+  // shape functions are read from the shape data cache
+  Vector<double> cell_dof_values;
 
   /**
    * Scratch component for the VOF auxiliary physics
@@ -1200,6 +1377,9 @@ public:
   // If a rheological model is being used for a non-Newtonian flow
   bool gather_hessian;
 
+  // Cache of the shape functions of the affine cells, if it is enabled
+  std::shared_ptr<const NavierStokesShapeDataCache<dim>> shape_data_cache;
+
   FEFaceValues<dim> fe_face_values;
 
   unsigned int n_faces;
@@ -0,0 +1,160 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------*/
+
+#ifndef lethe_navier_stokes_shape_data_cache_h
+#define lethe_navier_stokes_shape_data_cache_h
+
+#include <deal.II/base/quadrature.h>
+#include <deal.II/base/tensor.h>
+
+#include <deal.II/dofs/dof_handler.h>
+
+#include <deal.II/fe/mapping.h>
+
+#include <vector>
+
+using namespace dealii;
+
+/**
+ * @brief Cache of the shape functions of the Navier-Stokes equations
+ * evaluated at the quadrature points of the cells, which is built once per
+ * mesh and read by the NavierStokesScratchData instead of extracting the
+ * shape functions from the FEValues on every cell at every assembly.
+ *
+ * Only affine cells are cached. Since the shape functions of an affine cell
+ * only depend on the (constant) jacobian of its mapping, the cells that share
+ * the same jacobian, for example all the cells of a refinement level of a
+ * structured mesh, share the same entry of the cache. The number of entries
+ * is bounded to limit the memory footprint on unstructured meshes. The cells
+ * that are not affine or that do not fit in the cache are evaluated as usual
+ * by the scratch data.
+ *
+ * @tparam dim An integer that denotes the number of spatial dimensions.
+ */
+template <int dim>
+class NavierStokesShapeDataCache
+{
+public:
+  /**
+   * @brief Shape functions of the velocity and the pressure and JxW values at
+   * the quadrature points of a cell. The first index of the arrays is the
+   * quadrature point and the second index is the degree of freedom, as in the
+   * NavierStokesScratchData.
+   */
+  struct ShapeData
+  {
+    std::vector<double>                      JxW;
+    std::vector<std::vector<double>>         div_phi_u;
+    std::vector<std::vector<Tensor<1, dim>>> phi_u;
+    std::vector<std::vector<Tensor<3, dim>>> hess_phi_u;
+    std::vector<std::vector<Tensor<1, dim>>> laplacian_phi_u;
+    std::vector<std::vector<Tensor<2, dim>>> grad_phi_u;
+    std::vector<std::vector<double>>         phi_p;
+    std::vector<std::vector<Tensor<1, dim>>> grad_phi_p;
+  };
+
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] max_n_shapes Maximal number of distinct cell shapes stored in
+   * the cache.
+   */
+  NavierStokesShapeDataCache(const unsigned int max_n_shapes = 128);
+
+  /**
+   * @brief Evaluate and store the shape functions of the locally owned affine
+   * cells. Must be called again every time the mesh or the degrees of freedom
+   * change.
+   *
+   * @param[in] dof_handler DoFHandler of the velocity and the pressure.
+   *
+   * @param[in] mapping Mapping used by the assembly.
+   *
+   * @param[in] quadrature Cell quadrature used by the assembly.
+   */
+  void
+  initialize(const DoFHandler<dim> &dof_handler,
+             const Mapping<dim>    &mapping,
+             const Quadrature<dim> &quadrature);
+
+  /**
+   * @brief Return the shape functions of a cell.
+   *
+   * @param[in] cell Active cell of the triangulation used to initialize the
+   * cache.
+   *
+   * @return Pointer to the shape data of the cell, or nullptr if the cell is
+   * not cached.
+   */
+  const ShapeData *
+  get_shape_data(
+    const typename DoFHandler<dim>::active_cell_iterator &cell) const
+  {
+    const unsigned int index = cell->active_cell_index();
+    if (index >= cell_to_shape.size() ||
+        cell_to_shape[index] == numbers::invalid_unsigned_int)
+      return nullptr;
+    return &shape_data[cell_to_shape[index]];
+  }
+
+  /**
+   * @brief Return the number of distinct cell shapes stored in the cache.
+   */
+  unsigned int
+  n_shapes() const
+  {
+    return shape_data.size();
+  }
+
+  /**
+   * @brief Return the number of cells that read their shape functions from
+   * the cache.
+   */
+  unsigned int
+  n_cached_cells() const
+  {
+    return n_cells_in_cache;
+  }
+
+private:
+  /**
+   * @brief Maximal number of distinct cell shapes stored in the cache.
+   */
+  const unsigned int max_n_shapes;
+
+  /**
+   * @brief Shape functions of every distinct cell shape.
+   */
+  std::vector<ShapeData> shape_data;
+
+  /**
+   * @brief Jacobian of the mapping of every distinct cell shape, used to
+   * identify the cells that share the same shape functions.
+   */
+  std::vector<Tensor<2, dim>> shape_jacobians;
+
+  /**
+   * @brief Index of the shape of every active cell, or
+   * numbers::invalid_unsigned_int if the cell is not cached.
+   */
+  std::vector<unsigned int> cell_to_shape;
+
+  /**
+   * @brief Number of cells that read their shape functions from the cache.
+   */
+  unsigned int n_cells_in_cache;
+};
+
+#endif
@@ -277,7 +277,7 @@ public:
   bool
   field_is_required(const field id) const
   {
-    return required_fields.at(id);
+    return required_fields[id];
   }
 
   bool
@@ -380,7 +380,7 @@ private:
                                        mobility_cahn_hilliard;
   std::vector<Parameters::PhaseChange> phase_change_parameters;
 
-  std::map<field, bool> required_fields;
+  std::array<bool, n_fields> required_fields{};
 
   bool non_newtonian_flow;
   bool constant_density;
@@ -28,6 +28,9 @@
 #include <core/simulation_control.h>
 #include <core/vector.h>
 
+#include <solvers/advection_diffusion_matrix_free_operators.h>
+#include <solvers/advection_diffusion_matrix_free_preconditioner.h>
+#include <solvers/assembly_coloring.h>
 #include <solvers/auxiliary_physics.h>
 #include <solvers/multiphysics_interface.h>
 #include <solvers/tracer_assemblers.h>
@@ -107,6 +110,12 @@ public:
             this->dof_handler));
       }
 
+    // The matrix-free operator replaces the system matrix when the geometric
+    // multigrid preconditioner is selected
+    use_matrix_free =
+      simulation_parameters.linear_solver.at(PhysicsID::tracer)
+        .preconditioner == Parameters::LinearSolver::PreconditionerType::gcmg;
+
     // Change the behavior of the timer for situations when you don't want
     // outputs
     if (simulation_parameters.timer.type == Parameters::Timer::Type::none)
@@ -363,6 +372,34 @@ private:
   virtual void
   copy_local_rhs_to_global_rhs(const StabilizedMethodsCopyData &copy_data);
 
+  /**
+   * @brief Create the matrix-free operator and the geometric multigrid
+   * preconditioner used instead of the system matrix when the gcmg
+   * preconditioner is selected. Only a constant diffusivity and single fluid
+   * simulations are supported.
+   */
+  void
+  setup_matrix_free();
+
+  /**
+   * @brief Store the velocity of the fluid and the DCDD dissipation in the
+   * matrix-free operator and initialize the geometric multigrid
+   * preconditioner. Replaces the assembly of the system matrix when the
+   * matrix-free operator is used.
+   */
+  void
+  update_matrix_free();
+
+  /**
+   * @brief Solve the linear system with GMRES using the matrix-free operator
+   * and the geometric multigrid preconditioner.
+   *
+   * @param initial_step Provides the linear solver with indication if this
+   * solution is the first one for the system of equation or not.
+   */
+  void
+  solve_linear_system_matrix_free(const bool initial_step);
+
   /**
    * @brief Calculate tracer statistics : Max, min, average and standard-deviation
    */
@@ -432,6 +469,15 @@ private:
   AffineConstraints<double>      zero_constraints;
   TrilinosWrappers::SparseMatrix system_matrix;
 
+  // Coloring of the cells used by the assembly, if it is enabled
+  std::shared_ptr<AssemblyColoring<dim>> assembly_coloring;
+
+  // Matrix-free operator and geometric multigrid preconditioner, used instead
+  // of the system matrix when the preconditioner is gcmg
+  bool use_matrix_free;
+  std::shared_ptr<AdvectionDiffusionOperator<dim, double>>  system_operator;
+  std::shared_ptr<MFAdvectionDiffusionPreconditionGMG<dim>> gmg_preconditioner;
+
   // Previous solutions vectors
   std::vector<GlobalVectorType> previous_solutions;
 
@@ -282,8 +282,8 @@ public:
   calculate_physical_properties();
 
   // Physical properties
-  PhysicalPropertiesManager            properties_manager;
-  std::map<field, std::vector<double>> fields;
+  PhysicalPropertiesManager properties_manager;
+  FieldVectors              fields;
   std::vector<double>                  tracer_diffusivity;
   std::vector<double>                  tracer_diffusivity_0;
   std::vector<double>                  tracer_diffusivity_1;
@@ -21,6 +21,8 @@
 #include <core/simulation_control.h>
 #include <core/vector.h>
 
+#include <solvers/advection_diffusion_matrix_free_preconditioner.h>
+#include <solvers/assembly_coloring.h>
 #include <solvers/auxiliary_physics.h>
 #include <solvers/multiphysics_interface.h>
 #include <solvers/vof_assemblers.h>
@@ -40,6 +42,7 @@
 #include <deal.II/fe/mapping_fe.h>
 #include <deal.II/fe/mapping_q.h>
 
+#include <deal.II/lac/diagonal_matrix.h>
 #include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_sparse_matrix.h>
 #include <deal.II/lac/trilinos_vector.h>
@@ -142,6 +145,11 @@ public:
         << "The interface sharpness value should be set between 1 and 2"
         << std::endl;
 
+    // The matrix-free operator replaces the system matrix when the Jacobi
+    // preconditioner is selected
+    use_matrix_free =
+      simulation_parameters.linear_solver.at(PhysicsID::VOF).preconditioner ==
+      Parameters::LinearSolver::PreconditionerType::jacobi;
 
     // Change the behavior of the timer for situations when you don't want
     // outputs
@@ -507,6 +515,32 @@ private:
   virtual void
   copy_local_rhs_to_global_rhs(const StabilizedMethodsCopyData &copy_data);
 
+  /**
+   * @brief Create the matrix-free operator used instead of the system matrix
+   * when the jacobi preconditioner is selected.
+   */
+  void
+  setup_matrix_free();
+
+  /**
+   * @brief Store the velocity of the fluid, its divergence and the DCDD
+   * dissipation in the matrix-free operator and compute its inverse diagonal.
+   * Replaces the assembly of the system matrix when the matrix-free operator
+   * is used.
+   */
+  void
+  update_matrix_free();
+
+  /**
+   * @brief Solve the linear system with GMRES using the matrix-free operator
+   * and a point-Jacobi preconditioner.
+   *
+   * @param initial_step Provides the linear solver with indication if this
+   * solution is the first one for the system of equation or not.
+   */
+  void
+  solve_linear_system_matrix_free(const bool initial_step);
+
   /**
    * @brief Limit the phase fractions between 0 and 1. This is necessary before interface sharpening.
    * More information can be found in step_41 of deal.II tutorials:
@@ -730,6 +764,16 @@ private:
   GlobalVectorType               solution_pw;
   GlobalVectorType               filtered_solution;
 
+  // Coloring of the cells used by the assembly, if it is enabled
+  std::shared_ptr<AssemblyColoring<dim>> assembly_coloring;
+
+  // Matrix-free operator and inverse of its diagonal, used instead of the
+  // system matrix when the preconditioner is jacobi
+  bool use_matrix_free;
+  std::shared_ptr<AdvectionDiffusionOperator<dim, double>> system_operator;
+  DiagonalMatrix<LinearAlgebra::distributed::Vector<double>>
+    jacobi_preconditioner;
+
   // Previous solutions vectors
   std::vector<GlobalVectorType> previous_solutions;
 
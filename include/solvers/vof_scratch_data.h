@@ -287,8 +287,8 @@ public:
   const std::shared_ptr<SimulationControl> simulation_control;
 
   // Physical properties
-  const PhysicalPropertiesManager      properties_manager;
-  std::map<field, std::vector<double>> fields;
+  const PhysicalPropertiesManager properties_manager;
+  FieldVectors                    fields;
 
   // FEValues for the VOF problem
   FEValues<dim> fe_values_vof;
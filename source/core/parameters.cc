@@ -114,6 +114,19 @@ namespace Parameters
                         "1e6",
                         Patterns::Double(),
                         "Maximum time step value");
+      prm.declare_entry("min time step",
+                        "1e-8",
+                        Patterns::Double(),
+                        "Minimum time step value. This is used to bound the "
+                        "adaptative time stepping of the DEM solver.");
+      prm.declare_entry(
+        "max normal overlap growth ratio",
+        "0.001",
+        Patterns::Double(),
+        "Maximum growth of the normal overlap of the particle-particle and "
+        "particle-wall contacts during a time step relative to the diameter "
+        "of the particles. This is used to control the adaptative time "
+        "stepping of the DEM solver.");
       prm.declare_entry("stop tolerance",
                         "1e-10",
                         Patterns::Double(),
@@ -222,12 +235,15 @@ namespace Parameters
         {
           std::runtime_error("Invalid output control scheme");
         }
-      dt             = prm.get_double("time step");
-      timeEnd        = prm.get_double("time end");
-      adapt          = prm.get_bool("adapt");
-      maxCFL         = prm.get_double("max cfl");
-      max_dt         = prm.get_double("max time step");
-      stop_tolerance = prm.get_double("stop tolerance");
+      dt                       = prm.get_double("time step");
+      timeEnd                  = prm.get_double("time end");
+      adapt                    = prm.get_bool("adapt");
+      maxCFL                   = prm.get_double("max cfl");
+      max_dt                   = prm.get_double("max time step");
+      min_dt                   = prm.get_double("min time step");
+      stop_tolerance           = prm.get_double("stop tolerance");
+      max_normal_overlap_growth_ratio =
+        prm.get_double("max normal overlap growth ratio");
       adaptative_time_step_scaling =
         prm.get_double("adaptative time step scaling");
       startup_timestep_scaling = prm.get_double("startup time scaling");
@@ -1476,6 +1492,41 @@ namespace Parameters
         "1",
         Patterns::Integer(),
         "interpolation order chemical potential in the Cahn-Hilliard equations");
+      prm.declare_entry(
+        "enable shape data cache",
+        "false",
+        Patterns::Bool(),
+        "Evaluate the shape functions of the affine cells once per mesh and "
+        "reuse them at every assembly of the matrix-based Navier-Stokes "
+        "solvers. Cells that share the same jacobian share the same data.");
+      prm.declare_entry(
+        "enable matrix-free residual",
+        "false",
+        Patterns::Bool(),
+        "Evaluate the residual of the matrix-based Navier-Stokes solver with "
+        "sum-factorization kernels of the matrix-free operator. The jacobian "
+        "is still assembled as a sparse matrix. Only used for the supported "
+        "problems, otherwise the residual is assembled as usual.");
+      prm.declare_entry(
+        "enable fused assembly",
+        "false",
+        Patterns::Bool(),
+        "Assemble the BDF time derivative and the stabilized core of the "
+        "matrix-based Navier-Stokes solver in a single loop over the "
+        "quadrature points instead of one loop per assembler.");
+      prm.declare_entry(
+        "number of assembly threads",
+        "1",
+        Patterns::Integer(1),
+        "Maximal number of threads used by each MPI process. The assembly of "
+        "the matrix-based physics distributes the cells among the threads.");
+      prm.declare_entry(
+        "enable colored assembly",
+        "false",
+        Patterns::Bool(),
+        "Color the cells of the matrix-based physics such that the local "
+        "contributions of the cells of a color are copied to the global "
+        "system concurrently instead of one after the other.");
     }
     prm.leave_subsection();
   }
@@ -1494,6 +1545,13 @@ namespace Parameters
       phase_cahn_hilliard_order = prm.get_integer("phase cahn hilliard order");
       potential_cahn_hilliard_order =
         prm.get_integer("potential cahn hilliard order");
+      enable_shape_data_cache = prm.get_bool("enable shape data cache");
+      enable_matrix_free_residual =
+        prm.get_bool("enable matrix-free residual");
+      enable_fused_assembly = prm.get_bool("enable fused assembly");
+      number_of_assembly_threads =
+        prm.get_integer("number of assembly threads");
+      enable_colored_assembly = prm.get_bool("enable colored assembly");
     }
     prm.leave_subsection();
   }
@@ -2169,6 +2227,16 @@ namespace Parameters
           Patterns::Bool(),
           "Reuse the last jacobian matrix for the next non-linear problem solution");
 
+        prm.declare_entry(
+          "reuse matrix max steps",
+          "0",
+          Patterns::Integer(0),
+          "Maximal number of consecutive non-linear problems (e.g. time steps)"
+          " that share the same jacobian matrix when reuse matrix is enabled."
+          " Once this number is reached, the matrix is reassembled at the first"
+          " iteration of the next non-linear problem. A value of 0 means that"
+          " there is no limit.");
+
         prm.declare_entry(
           "reuse preconditioner",
           "false",
@@ -2223,14 +2291,15 @@ namespace Parameters
           throw(std::runtime_error(
             "Invalid strategy for kinsol non-linear solver "));
 
-        tolerance             = prm.get_double("tolerance");
-        step_tolerance        = prm.get_double("step tolerance");
-        matrix_tolerance      = prm.get_double("matrix tolerance");
-        max_iterations        = prm.get_integer("max iterations");
-        display_precision     = prm.get_integer("residual precision");
-        force_rhs_calculation = prm.get_bool("force rhs calculation");
-        reuse_matrix          = prm.get_bool("reuse matrix");
-        reuse_preconditioner  = prm.get_bool("reuse preconditioner");
+        tolerance              = prm.get_double("tolerance");
+        step_tolerance         = prm.get_double("step tolerance");
+        matrix_tolerance       = prm.get_double("matrix tolerance");
+        max_iterations         = prm.get_integer("max iterations");
+        display_precision      = prm.get_integer("residual precision");
+        force_rhs_calculation  = prm.get_bool("force rhs calculation");
+        reuse_matrix           = prm.get_bool("reuse matrix");
+        reuse_matrix_max_steps = prm.get_integer("reuse matrix max steps");
+        reuse_preconditioner   = prm.get_bool("reuse preconditioner");
         abort_at_convergence_failure =
           prm.get_bool("abort at convergence failure");
       }
@@ -2479,11 +2548,12 @@ namespace Parameters
           Patterns::Bool(),
           "Turns off the terms involving the hessian in the rhs");
 
-        prm.declare_entry("preconditioner",
-                          "ilu",
-                          Patterns::Selection("amg|ilu|lsmg|gcmg"),
-                          "The preconditioner for the linear solver."
-                          "Choices are <amg|ilu|lsmg|gcmg>.");
+        prm.declare_entry(
+          "preconditioner",
+          "ilu",
+          Patterns::Selection("amg|ilu|lsmg|gcmg|jacobi|schur"),
+          "The preconditioner for the linear solver."
+          "Choices are <amg|ilu|lsmg|gcmg|jacobi|schur>.");
 
 
         prm.declare_entry("ilu preconditioner fill",
@@ -2537,12 +2607,38 @@ namespace Parameters
                           "1",
                           Patterns::Integer(),
                           "amg smoother overlap");
+        prm.declare_entry(
+          "amg reuse hierarchy",
+          "false",
+          Patterns::Bool(),
+          "Keep the aggregation hierarchy of the amg preconditioner as long as "
+          "the sparsity pattern of the matrix does not change and only "
+          "recompute the level matrices and the smoothers from the new values "
+          "of the matrix");
         prm.declare_entry(
           "force linear solver continuation",
           "false",
           Patterns::Bool(),
           "A boolean that will force the linear solver to continue even if it fails");
 
+        prm.declare_entry(
+          "block preconditioner reuse",
+          "false",
+          Patterns::Bool(),
+          "Keep the preconditioners of the block solver between the linear "
+          "solves. The preconditioner of the pressure mass matrix is only "
+          "rebuilt when the degrees of freedom change and the preconditioner "
+          "of the velocity block is rebuilt when the linearization velocity "
+          "or the time step change significantly.");
+
+        prm.declare_entry(
+          "block velocity preconditioner tolerance",
+          "0.1",
+          Patterns::Double(0.),
+          "Relative change of the linearization velocity or of the time step "
+          "since the last set up of the preconditioner of the velocity block "
+          "above which it is rebuilt when the block preconditioner is reused.");
+
         prm.declare_entry("mg min level",
                           "-1",
                           Patterns::Integer(),
@@ -2564,6 +2660,51 @@ namespace Parameters
           Patterns::Bool(),
           "Turns off the terms involving the hessian in the Jacobian of mg operators");
 
+        prm.declare_entry(
+          "mg use single precision",
+          "false",
+          Patterns::Bool(),
+          "Use single precision for the level operators, smoothers and "
+          "transfers of lsmg or gcmg. The outer solver remains in double "
+          "precision.");
+
+        prm.declare_entry(
+          "mg recompute linearization level",
+          "-1",
+          Patterns::Integer(),
+          "Level from which the mg operators recompute the values, gradients "
+          "and stabilization parameters of the linearization point at the "
+          "quadrature points during each Jacobian evaluation instead of "
+          "storing them. This reduces the memory footprint of the finest "
+          "levels at the cost of additional operations. A value of -1 "
+          "stores the linearization data on all levels.");
+
+        prm.declare_entry(
+          "mg reuse eigenvalue estimates",
+          "false",
+          Patterns::Bool(),
+          "Reuse the relaxation parameters obtained from the eigenvalue "
+          "estimates of the previous set up of the mg smoother instead of "
+          "estimating the eigenvalues every time the preconditioner is "
+          "updated.");
+
+        prm.declare_entry(
+          "mg reuse coarse grid solver",
+          "false",
+          Patterns::Bool(),
+          "Reuse the coarse-grid solver (matrix and AMG, ILU or direct "
+          "factorization) of the previous set up instead of rebuilding it "
+          "every time the preconditioner is updated.");
+
+        prm.declare_entry(
+          "mg reuse max iterations ratio",
+          "2.0",
+          Patterns::Double(1.0),
+          "The reused eigenvalue estimates and coarse-grid solver are rebuilt "
+          "when the number of iterations of the outer solver exceeds this "
+          "ratio times the number of iterations of the first solve after the "
+          "last full set up.");
+
         prm.declare_entry("mg smoother iterations",
                           "10",
                           Patterns::Integer(),
@@ -2577,8 +2718,11 @@ namespace Parameters
         prm.declare_entry("mg smoother preconditioner type",
                           "inverse diagonal",
                           Patterns::Selection(
-                            "inverse diagonal|additive schwarz method"),
-                          "Preconditioner of smoother");
+                            "inverse diagonal|additive schwarz method|"
+                            "vertex patch"),
+                          "Preconditioner of smoother. "
+                          "Choices are <inverse diagonal|additive schwarz "
+                          "method|vertex patch>.");
 
         prm.declare_entry("mg smoother eig estimation",
                           "false",
@@ -2715,9 +2859,13 @@ namespace Parameters
           preconditioner = PreconditionerType::lsmg;
         else if (precond == "gcmg")
           preconditioner = PreconditionerType::gcmg;
+        else if (precond == "jacobi")
+          preconditioner = PreconditionerType::jacobi;
+        else if (precond == "schur")
+          preconditioner = PreconditionerType::schur;
         else
           throw std::logic_error(
-            "Error, invalid preconditioner type. Choices are amg, ilu, lsmg or gcmg.");
+            "Error, invalid preconditioner type. Choices are amg, ilu, lsmg, gcmg, jacobi or schur.");
 
 
         ilu_precond_fill = prm.get_double("ilu preconditioner fill");
@@ -2736,10 +2884,15 @@ namespace Parameters
         amg_w_cycles              = prm.get_bool("amg w cycles");
         amg_smoother_sweeps       = prm.get_integer("amg smoother sweeps");
         amg_smoother_overlap      = prm.get_integer("amg smoother overlap");
+        amg_reuse_hierarchy       = prm.get_bool("amg reuse hierarchy");
 
         force_linear_solver_continuation =
           prm.get_bool("force linear solver continuation");
 
+        block_preconditioner_reuse = prm.get_bool("block preconditioner reuse");
+        block_velocity_preconditioner_tolerance =
+          prm.get_double("block velocity preconditioner tolerance");
+
         mg_min_level       = prm.get_integer("mg min level");
         mg_level_min_cells = prm.get_integer("mg level min cells");
         mg_int_level       = prm.get_integer("mg int level");
@@ -2748,6 +2901,16 @@ namespace Parameters
         Assert(enable_hessians_jacobian || !mg_enable_hessians_jacobian,
                ExcNotImplemented());
 
+        mg_use_single_precision = prm.get_bool("mg use single precision");
+        mg_recompute_linearization_level =
+          prm.get_integer("mg recompute linearization level");
+        mg_reuse_eigenvalue_estimates =
+          prm.get_bool("mg reuse eigenvalue estimates");
+        mg_reuse_coarse_grid_solver =
+          prm.get_bool("mg reuse coarse grid solver");
+        mg_reuse_max_iterations_ratio =
+          prm.get_double("mg reuse max iterations ratio");
+
         mg_smoother_iterations = prm.get_integer("mg smoother iterations");
         mg_smoother_relaxation = prm.get_double("mg smoother relaxation");
 
@@ -2759,6 +2922,9 @@ namespace Parameters
         else if (mg_smoother_preconditioner_type == "additive schwarz method")
           this->mg_smoother_preconditioner_type =
             MultigridSmootherPreconditionerType::AdditiveSchwarzMethod;
+        else if (mg_smoother_preconditioner_type == "vertex patch")
+          this->mg_smoother_preconditioner_type =
+            MultigridSmootherPreconditionerType::VertexPatch;
         else
           AssertThrow(false, ExcNotImplemented());
 
@@ -2934,6 +3100,15 @@ namespace Parameters
         Patterns::Bool(),
         "Fraction of refined elements"
         "Enable a controller that will target a specific number of elements in the mesh equal to the maximum number of elements");
+
+      prm.declare_entry(
+        "verbosity",
+        "quiet",
+        Patterns::Selection("quiet|verbose|extra verbose"),
+        "State whether the reuse of the matrix structure after each mesh "
+        "adaptation should be printed. With extra verbose, the time spent in "
+        "the setup of the degrees of freedom is also printed. "
+        "Choices are <quiet|verbose|extra verbose>.");
     }
     prm.leave_subsection();
   }
@@ -3011,6 +3186,14 @@ namespace Parameters
       frequency                  = prm.get_integer("frequency");
       refinement_at_frequency    = frequency != 0;
       mesh_controller_is_enabled = prm.get_bool("mesh refinement controller");
+
+      const std::string verbosity_op = prm.get("verbosity");
+      if (verbosity_op == "verbose")
+        verbosity = Verbosity::verbose;
+      if (verbosity_op == "quiet")
+        verbosity = Verbosity::quiet;
+      if (verbosity_op == "extra verbose")
+        verbosity = Verbosity::extra_verbose;
     }
     prm.leave_subsection();
   }
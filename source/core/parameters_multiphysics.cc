@@ -65,6 +65,8 @@ Parameters::Multiphysics::declare_parameters(ParameterHandler &prm)
                       "false",
                       Patterns::Bool(),
                       "Buoyant force calculation <true|false>");
+
+    coupling_parameters.declare_parameters(prm);
   }
   prm.leave_subsection();
 
@@ -87,12 +89,73 @@ Parameters::Multiphysics::parse_parameters(ParameterHandler    &prm,
     // subparameter for heat_transfer
     viscous_dissipation = prm.get_bool("viscous dissipation");
     buoyancy_force      = prm.get_bool("buoyancy force");
+
+    coupling_parameters.parse_parameters(prm);
   }
   prm.leave_subsection();
   vof_parameters.parse_parameters(prm);
   cahn_hilliard_parameters.parse_parameters(prm, dimensions);
 }
 
+void
+Parameters::MultiphysicsCoupling::declare_parameters(ParameterHandler &prm)
+{
+  prm.enter_subsection("coupling");
+  {
+    prm.declare_entry(
+      "max iterations",
+      "1",
+      Patterns::Integer(1),
+      "Maximal number of fixed-point iterations between the fluid dynamics "
+      "and the auxiliary physics solved after it within a time step. The "
+      "default value of 1 solves each physics once.");
+
+    prm.declare_entry(
+      "tolerance",
+      "1e-6",
+      Patterns::Double(0.),
+      "Relative change of the solutions of the coupled auxiliary physics "
+      "between two coupling iterations below which the coupling has "
+      "converged");
+
+    prm.declare_entry(
+      "anderson depth",
+      "3",
+      Patterns::Integer(0),
+      "Number of previous coupling iterations used by the Anderson "
+      "acceleration. The coupling iterations are Picard iterations if it is "
+      "0.");
+
+    prm.declare_entry(
+      "verbosity",
+      "quiet",
+      Patterns::Selection("quiet|verbose"),
+      "States whether the residual of the coupling iterations should be "
+      "printed. Choices are <quiet|verbose>.");
+  }
+  prm.leave_subsection();
+}
+
+void
+Parameters::MultiphysicsCoupling::parse_parameters(ParameterHandler &prm)
+{
+  prm.enter_subsection("coupling");
+  {
+    max_iterations = prm.get_integer("max iterations");
+    tolerance      = prm.get_double("tolerance");
+    anderson_depth = prm.get_integer("anderson depth");
+
+    const std::string op = prm.get("verbosity");
+    if (op == "verbose")
+      verbosity = Parameters::Verbosity::verbose;
+    else if (op == "quiet")
+      verbosity = Parameters::Verbosity::quiet;
+    else
+      throw(std::runtime_error("Invalid verbosity level"));
+  }
+  prm.leave_subsection();
+}
+
 void
 Parameters::VOF::declare_parameters(ParameterHandler &prm)
 {
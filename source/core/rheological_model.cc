@@ -47,11 +47,10 @@ PowerLaw::value(const std::map<field, double> &field_values)
 }
 
 void
-PowerLaw::vector_value(
-  const std::map<field, std::vector<double>> &field_vectors,
-  std::vector<double>                        &property_vector)
+PowerLaw::vector_value(const FieldVectors  &field_vectors,
+                       std::vector<double> &property_vector)
 {
-  AssertThrow(field_vectors.find(field::shear_rate) != field_vectors.end(),
+  AssertThrow(field_vectors.is_defined(field::shear_rate),
               PhysicialPropertyModelFieldUndefined("PowerLaw", "shear_rate"));
   const auto shear_rate_magnitude = field_vectors.at(field::shear_rate);
 
@@ -75,12 +74,11 @@ PowerLaw::jacobian(const std::map<field, double> &field_values, const field id)
 }
 
 void
-PowerLaw::vector_jacobian(
-  const std::map<field, std::vector<double>> &field_vectors,
-  const field                                 id,
-  std::vector<double>                        &jacobian_vector)
+PowerLaw::vector_jacobian(const FieldVectors  &field_vectors,
+                          const field          id,
+                          std::vector<double> &jacobian_vector)
 {
-  AssertThrow(field_vectors.find(field::shear_rate) != field_vectors.end(),
+  AssertThrow(field_vectors.is_defined(field::shear_rate),
               PhysicialPropertyModelFieldUndefined("PowerLaw", "shear_rate"));
   const auto shear_rate_magnitude = field_vectors.at(field::shear_rate);
 
@@ -102,10 +100,10 @@ Carreau::value(const std::map<field, double> &field_values)
 }
 
 void
-Carreau::vector_value(const std::map<field, std::vector<double>> &field_vectors,
+Carreau::vector_value(const FieldVectors  &field_vectors,
                       std::vector<double> &property_vector)
 {
-  AssertThrow(field_vectors.find(field::shear_rate) != field_vectors.end(),
+  AssertThrow(field_vectors.is_defined(field::shear_rate),
               PhysicialPropertyModelFieldUndefined("Carreau", "shear_rate"));
   const auto shear_rate_magnitude = field_vectors.at(field::shear_rate);
 
@@ -124,26 +122,27 @@ Carreau::jacobian(const std::map<field, double> &field_values, const field id)
       AssertThrow(field_values.find(field::shear_rate) != field_values.end(),
                   PhysicialPropertyModelFieldUndefined("Carreau",
                                                        "shear_rate"));
-      return this->numerical_jacobian(field_values, field::shear_rate);
+      return calculate_derivative(field_values.at(field::shear_rate));
     }
   else
     return 0;
 }
 
 void
-Carreau::vector_jacobian(
-  const std::map<field, std::vector<double>> &field_vectors,
-  const field                                 id,
-  std::vector<double>                        &jacobian_vector)
+Carreau::vector_jacobian(const FieldVectors  &field_vectors,
+                         const field          id,
+                         std::vector<double> &jacobian_vector)
 {
   if (id == field::shear_rate)
     {
-      AssertThrow(field_vectors.find(field::shear_rate) != field_vectors.end(),
+      AssertThrow(field_vectors.is_defined(field::shear_rate),
                   PhysicialPropertyModelFieldUndefined("Carreau",
                                                        "shear_rate"));
-      this->vector_numerical_jacobian(field_vectors,
-                                      field::shear_rate,
-                                      jacobian_vector);
+      const ArrayView<const double> &shear_rate_magnitude =
+        field_vectors.at(field::shear_rate);
+
+      for (unsigned int i = 0; i < jacobian_vector.size(); ++i)
+        jacobian_vector[i] = calculate_derivative(shear_rate_magnitude[i]);
     }
   else
     std::fill(jacobian_vector.begin(), jacobian_vector.end(), 0);
@@ -163,14 +162,13 @@ PhaseChangeRheology::value(const std::map<field, double> &field_values)
 }
 
 void
-PhaseChangeRheology::vector_value(
-  const std::map<field, std::vector<double>> &field_vectors,
-  std::vector<double>                        &property_vector)
+PhaseChangeRheology::vector_value(const FieldVectors  &field_vectors,
+                                  std::vector<double> &property_vector)
 {
-  AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+  AssertThrow(field_vectors.is_defined(field::temperature),
               PhysicialPropertyModelFieldUndefined("PhaseChangeRheology",
                                                    "temperature"));
-  const std::vector<double> &temperature_vec =
+  const ArrayView<const double> &temperature_vec =
     field_vectors.at(field::temperature);
 
   for (unsigned int i = 0; i < temperature_vec.size(); ++i)
@@ -195,12 +193,11 @@ PhaseChangeRheology::jacobian(const std::map<field, double> &field_values,
 }
 
 void
-PhaseChangeRheology::vector_jacobian(
-  const std::map<field, std::vector<double>> &field_vectors,
-  const field                                 id,
-  std::vector<double>                        &jacobian_vector)
+PhaseChangeRheology::vector_jacobian(const FieldVectors  &field_vectors,
+                                     const field          id,
+                                     std::vector<double> &jacobian_vector)
 {
-  AssertThrow(field_vectors.find(field::temperature) != field_vectors.end(),
+  AssertThrow(field_vectors.is_defined(field::temperature),
               PhysicialPropertyModelFieldUndefined("PhaseChangeRheology",
                                                    "temperature"));
   vector_numerical_jacobian(field_vectors, id, jacobian_vector);
@@ -226,7 +223,7 @@ PhaseChangeRheology::get_kinematic_viscosity_for_stabilization(
  */
 void
 PhaseChangeRheology::get_kinematic_viscosity_for_stabilization_vector(
-  const std::map<field, std::vector<double>> & /*field_vectors*/,
+  const FieldVectors & /*field_vectors*/,
   std::vector<double> &property_vector)
 {
   std::fill(property_vector.begin(),
@@ -258,7 +255,7 @@ PhaseChangeRheology::get_dynamic_viscosity_for_stabilization(
 void
 PhaseChangeRheology::get_dynamic_viscosity_for_stabilization_vector(
   const double &p_density_ref,
-  const std::map<field, std::vector<double>> & /*field_vectors*/,
+  const FieldVectors & /*field_vectors*/,
   std::vector<double> &property_vector)
 {
   std::fill(property_vector.begin(),
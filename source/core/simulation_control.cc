@@ -290,8 +290,49 @@ SimulationControlTransient::calculate_time_step()
 SimulationControlTransientDEM::SimulationControlTransientDEM(
   const Parameters::SimulationControl &param)
   : SimulationControlTransient(param)
+  , min_dt(param.min_dt)
+  , max_normal_overlap_growth_ratio(param.max_normal_overlap_growth_ratio)
+  , normal_overlap_growth_ratio(0)
+  , rayleigh_time_step(0)
 {}
 
+double
+SimulationControlTransientDEM::calculate_time_step()
+{
+  double new_time_step = time_step;
+
+  if (adapt && iteration_number > 1)
+    {
+      new_time_step = time_step * adaptative_time_step_scaling;
+
+      // Particle CFL condition
+      if (CFL > 0 && max_CFL / CFL < adaptative_time_step_scaling)
+        new_time_step = time_step * max_CFL / CFL;
+
+      // Normal overlap growth condition. The growth of the overlaps during a
+      // time step is proportional to the time step, contrary to the overlaps
+      // themselves, which do not vanish when the time step is reduced.
+      if (normal_overlap_growth_ratio > 0 &&
+          max_normal_overlap_growth_ratio / normal_overlap_growth_ratio <
+            adaptative_time_step_scaling)
+        new_time_step = std::min(new_time_step,
+                                 time_step * max_normal_overlap_growth_ratio /
+                                   normal_overlap_growth_ratio);
+
+      new_time_step = std::max(std::min(new_time_step, max_dt), min_dt);
+
+      // The Rayleigh time step bound prevails over the minimal time step
+      if (rayleigh_time_step > 0)
+        new_time_step =
+          std::min(new_time_step,
+                   max_rayleigh_time_step_fraction * rayleigh_time_step);
+    }
+  if (current_time + new_time_step > end_time)
+    new_time_step = end_time - current_time;
+
+  return new_time_step;
+}
+
 void
 SimulationControlTransientDEM::print_progression(
   const ConditionalOStream &pcout)
@@ -307,6 +348,9 @@ SimulationControlTransientDEM::print_progression(
      << " Time: " << std::setw(8) << std::left << current_time
      << " Time step: " << std::setw(8) << std::left << time_step;
 
+  if (adapt)
+    ss << " CFL: " << std::setw(8) << std::left << CFL;
+
   // Announce string
   announce_string(pcout, ss.str(), '*');
 }
@@ -0,0 +1,52 @@
+#include <dem/cell_particle_table.h>
+
+#include <algorithm>
+
+template <int dim>
+void
+CellParticleTable<dim>::build(
+  const Particles::ParticleHandler<dim> &particle_handler)
+{
+  cell_index_and_particle_id.clear();
+  cell_index_and_particle_id.reserve(
+    particle_handler.n_locally_owned_particles());
+
+  // Gather the active cell index of the locally owned and ghost particles
+  unsigned int n_cells = 0;
+  auto         gather_particle = [&](const auto &particle) {
+    const unsigned int cell_index =
+      particle.get_surrounding_cell()->active_cell_index();
+    n_cells = std::max(n_cells, cell_index + 1);
+    cell_index_and_particle_id.emplace_back(cell_index, particle.get_id());
+  };
+
+  for (const auto &particle : particle_handler)
+    gather_particle(particle);
+
+  for (auto particle = particle_handler.begin_ghost();
+       particle != particle_handler.end_ghost();
+       ++particle)
+    gather_particle(*particle);
+
+  // Count the particles in each cell and compute the offsets with a prefix
+  // sum
+  cell_offsets.assign(n_cells + 1, 0);
+  for (const auto &[cell_index, particle_id] : cell_index_and_particle_id)
+    ++cell_offsets[cell_index + 1];
+
+  for (unsigned int i = 0; i < n_cells; ++i)
+    cell_offsets[i + 1] += cell_offsets[i];
+
+  // Scatter the particle ids in their cell range. The offsets are shifted
+  // while the ids are stored and restored afterwards.
+  particle_ids.resize(cell_index_and_particle_id.size());
+  for (const auto &[cell_index, particle_id] : cell_index_and_particle_id)
+    particle_ids[cell_offsets[cell_index]++] = particle_id;
+
+  for (unsigned int i = n_cells; i > 0; --i)
+    cell_offsets[i] = cell_offsets[i - 1];
+  cell_offsets[0] = 0;
+}
+
+template class CellParticleTable<2>;
+template class CellParticleTable<3>;
@@ -79,9 +79,12 @@ DEMSolver<dim>::setup_parameters()
   if (parameters.timer.type == Parameters::Timer::Type::none)
     computing_timer.disable_output();
 
-  // Set the simulation control as transient DEM
-  simulation_control = std::make_shared<SimulationControlTransientDEM>(
-    parameters.simulation_control);
+  // Set the simulation control as transient DEM. The typed pointer is kept to
+  // give the adaptative time stepping criteria to the simulation control.
+  transient_dem_simulation_control =
+    std::make_shared<SimulationControlTransientDEM>(
+      parameters.simulation_control);
+  simulation_control = transient_dem_simulation_control;
 
   // Setup load balancing parameters and attach the correct functions to the
   // signals inside the triangulation
@@ -104,6 +107,11 @@ DEMSolver<dim>::setup_parameters()
   // Set the distribution type and initialize the neighborhood threshold
   setup_distribution_type();
 
+  // The adaptative time step is bound by a fraction of the Rayleigh time step
+  transient_dem_simulation_control->set_rayleigh_time_step(
+    calculate_rayleigh_time_step(parameters.lagrangian_physical_properties,
+                                 size_distribution_object_container));
+
   if (this_mpi_process == 0)
     input_parameter_inspection(parameters,
                                pcout,
@@ -231,6 +239,12 @@ DEMSolver<dim>::setup_functions_and_pointers()
 
   // Setting chosen contact force, insertion and integration methods
   integrator_object = set_integrator_type();
+
+  // The displacement of the particles for the dynamic contact detection is
+  // updated by the integrator
+  if (parameters.model_parameters.contact_detection_method ==
+      Parameters::Lagrangian::ModelParameters::ContactDetectionMethod::dynamic)
+    integrator_object->set_displacement_container(displacement);
   particle_particle_contact_force_object =
     set_particle_particle_contact_force_model(parameters);
   particle_wall_contact_force_object =
@@ -348,12 +362,10 @@ DEMSolver<dim>::setup_triangulation_dependent_parameters()
   periodic_boundaries_object.map_periodic_cells(
     triangulation, periodic_boundaries_cells_information);
 
-  // Set the periodic offset to contact managers and particles contact forces
-  // for periodic contact detection (if PBC enabled)
+  // Set the periodic offset to the contact manager for periodic contact
+  // detection (if PBC enabled)
   contact_manager.set_periodic_offset(
     periodic_boundaries_object.get_periodic_offset_distance());
-  particle_particle_contact_force_object->set_periodic_offset(
-    periodic_boundaries_object.get_periodic_offset_distance());
 
   // Set up the local and ghost cells (if ASC enabled)
   sparse_contacts_object.update_local_and_ghost_cell_set(background_dh);
@@ -466,12 +478,53 @@ DEMSolver<dim>::check_contact_search_iteration_dynamic()
   const bool parallel_update =
     (simulation_control->get_step_number() %
      parameters.model_parameters.contact_detection_frequency) == 0;
-  find_particle_contact_detection_step<dim>(particle_handler,
-                                            simulation_control->get_time_step(),
-                                            smallest_contact_search_criterion,
-                                            mpi_communicator,
-                                            displacement,
-                                            parallel_update);
+  find_particle_contact_detection_step(
+    integrator_object->get_maximum_displacement(),
+    smallest_contact_search_criterion,
+    mpi_communicator,
+    parallel_update);
+}
+
+template <int dim>
+void
+DEMSolver<dim>::update_adaptative_time_step_criteria()
+{
+  const double dt = simulation_control->get_time_step();
+
+  double max_particle_cfl = 0.;
+  for (auto &particle : particle_handler)
+    {
+      auto particle_properties = particle.get_properties();
+
+      const double velocity_norm =
+        sqrt(particle_properties[DEM::PropertiesIndex::v_x] *
+               particle_properties[DEM::PropertiesIndex::v_x] +
+             particle_properties[DEM::PropertiesIndex::v_y] *
+               particle_properties[DEM::PropertiesIndex::v_y] +
+             particle_properties[DEM::PropertiesIndex::v_z] *
+               particle_properties[DEM::PropertiesIndex::v_z]);
+
+      max_particle_cfl =
+        std::max(max_particle_cfl,
+                 velocity_norm * dt /
+                   particle_properties[DEM::PropertiesIndex::dp]);
+    }
+
+  // The overlap growth criterion is the largest of the particle-particle and
+  // the particle-wall contacts. Both criteria are reduced with a single
+  // communication.
+  const std::vector<double> local_criteria = {
+    max_particle_cfl,
+    std::max(particle_particle_contact_force_object
+               ->get_max_normal_overlap_growth_ratio(),
+             particle_wall_contact_force_object
+               ->get_max_normal_overlap_growth_ratio())};
+  std::vector<double> global_criteria(local_criteria.size());
+  Utilities::MPI::max(local_criteria, mpi_communicator, global_criteria);
+
+  transient_dem_simulation_control->set_CFL(global_criteria[0]);
+  transient_dem_simulation_control->set_normal_overlap_growth_ratio(
+    global_criteria[1]);
 }
 
 template <int dim>
@@ -500,6 +553,10 @@ template <int dim>
 void
 DEMSolver<dim>::particle_wall_contact_force()
 {
+  // The largest overlap growth is tracked over the walls, the floating walls
+  // and the floating meshes
+  particle_wall_contact_force_object->reset_max_normal_overlap_growth_ratio();
+
   // Particle-wall contact force
   particle_wall_contact_force_object->calculate_particle_wall_contact_force(
     contact_manager.get_particle_wall_in_contact(),
@@ -823,7 +880,7 @@ DEMSolver<dim>::sort_particles_into_subdomains_and_cells()
     }
 
   // Always reset the displacement values since we are doing a search detection
-  std::fill(displacement.begin(), displacement.end(), 0.);
+  integrator_object->reset_displacement();
 
   // Exchange ghost particles
   particle_handler.exchange_ghost_particles(true);
@@ -986,9 +1043,6 @@ DEMSolver<dim>::solve()
         ->calculate_particle_particle_contact_force(
           contact_manager.get_local_adjacent_particles(),
           contact_manager.get_ghost_adjacent_particles(),
-          contact_manager.get_local_local_periodic_adjacent_particles(),
-          contact_manager.get_local_ghost_periodic_adjacent_particles(),
-          contact_manager.get_ghost_local_periodic_adjacent_particles(),
           simulation_control->get_time_step(),
           torque,
           force);
@@ -1035,6 +1089,11 @@ DEMSolver<dim>::solve()
                                        sparse_contacts_object);
         }
 
+      // Compute the criteria of the next time step (if adaptative time
+      // stepping)
+      if (parameters.simulation_control.adapt)
+        update_adaptative_time_step_criteria();
+
       // Visualization
       if (simulation_control->is_output_iteration())
         write_output_results();
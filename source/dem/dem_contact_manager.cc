@@ -58,43 +58,6 @@ DEMContactManager<dim>::update_contacts()
     ContactType::ghost_particle_particle>(ghost_adjacent_particles,
                                           ghost_contact_pair_candidates);
 
-  if (DEMActionManager::get_action_manager()
-        ->check_periodic_boundaries_enabled())
-    {
-      // Update periodic particle-particle contacts in
-      // local_local_periodic_adjacent_particles of fine search step with
-      // local_contact_pair_periodic_candidates
-      update_fine_search_candidates<
-        dim,
-        typename dem_data_structures<dim>::adjacent_particle_pairs,
-        typename dem_data_structures<dim>::particle_particle_candidates,
-        ContactType::local_periodic_particle_particle>(
-        local_local_periodic_adjacent_particles,
-        local_contact_pair_periodic_candidates);
-
-      // Update periodic particle-particle contacts in
-      // local_ghost_periodic_adjacent_particles of fine search step with
-      // ghost_contact_pair_periodic_candidates
-      update_fine_search_candidates<
-        dim,
-        typename dem_data_structures<dim>::adjacent_particle_pairs,
-        typename dem_data_structures<dim>::particle_particle_candidates,
-        ContactType::ghost_periodic_particle_particle>(
-        local_ghost_periodic_adjacent_particles,
-        ghost_contact_pair_periodic_candidates);
-
-      // Update periodic particle-particle contacts in
-      // ghost_local_periodic_adjacent_particles of fine search step with
-      // ghost_local_contact_pair_periodic_candidates
-      update_fine_search_candidates<
-        dim,
-        typename dem_data_structures<dim>::adjacent_particle_pairs,
-        typename dem_data_structures<dim>::particle_particle_candidates,
-        ContactType::ghost_local_periodic_particle_particle>(
-        ghost_local_periodic_adjacent_particles,
-        ghost_local_contact_pair_periodic_candidates);
-    }
-
   // Update particle-wall contacts in particle_wall_pairs_in_contact of fine
   // search step with particle_wall_contact_candidates
   update_fine_search_candidates<
@@ -153,34 +116,6 @@ DEMContactManager<dim>::update_local_particles_in_cells(
     ContactType::ghost_particle_particle>(ghost_adjacent_particles,
                                           particle_container);
 
-  if (DEMActionManager::get_action_manager()
-        ->check_periodic_boundaries_enabled())
-    {
-      // Update contact containers for local-local periodic particle-particle
-      // pairs in contact
-      update_contact_container_iterators<
-        dim,
-        typename dem_data_structures<dim>::adjacent_particle_pairs,
-        ContactType::local_periodic_particle_particle>(
-        local_local_periodic_adjacent_particles, particle_container);
-
-      // Update contact containers for local-ghost periodic particle-particle
-      // pairs in contact
-      update_contact_container_iterators<
-        dim,
-        typename dem_data_structures<dim>::adjacent_particle_pairs,
-        ContactType::ghost_periodic_particle_particle>(
-        local_ghost_periodic_adjacent_particles, particle_container);
-
-      // Update contact containers for ghost-local periodic particle-particle
-      // pairs in contact
-      update_contact_container_iterators<
-        dim,
-        typename dem_data_structures<dim>::adjacent_particle_pairs,
-        ContactType::ghost_local_periodic_particle_particle>(
-        ghost_local_periodic_adjacent_particles, particle_container);
-    }
-
   // Update contact containers for particle-wall pairs in contact
   update_contact_container_iterators<
     dim,
@@ -230,11 +165,15 @@ DEMContactManager<dim>::execute_particle_particle_broad_search(
 {
   auto *action_manager = DEMActionManager::get_action_manager();
 
+  // Build the table of the particles in each cell once for all the broad
+  // searches
+  cell_particle_table.build(particle_handler);
+
   // Check if sparse contacts are enabled to use proper broad search functions
   // The first broad search is the default one for sparse contacts
   if (action_manager->use_default_broad_search_functions())
     {
-      find_particle_particle_contact_pairs<dim>(particle_handler,
+      find_particle_particle_contact_pairs<dim>(cell_particle_table,
                                                 cells_local_neighbor_list,
                                                 cells_ghost_neighbor_list,
                                                 local_contact_pair_candidates,
@@ -243,18 +182,17 @@ DEMContactManager<dim>::execute_particle_particle_broad_search(
       if (action_manager->check_periodic_boundaries_enabled())
         {
           find_particle_particle_periodic_contact_pairs<dim>(
-            particle_handler,
+            cell_particle_table,
             cells_local_periodic_neighbor_list,
             cells_ghost_periodic_neighbor_list,
             cells_ghost_local_periodic_neighbor_list,
-            local_contact_pair_periodic_candidates,
-            ghost_contact_pair_periodic_candidates,
-            ghost_local_contact_pair_periodic_candidates);
+            local_contact_pair_candidates,
+            ghost_contact_pair_candidates);
         }
     }
   else
     {
-      find_particle_particle_contact_pairs<dim>(particle_handler,
+      find_particle_particle_contact_pairs<dim>(cell_particle_table,
                                                 cells_local_neighbor_list,
                                                 cells_ghost_neighbor_list,
                                                 local_contact_pair_candidates,
@@ -264,13 +202,12 @@ DEMContactManager<dim>::execute_particle_particle_broad_search(
       if (action_manager->check_periodic_boundaries_enabled())
         {
           find_particle_particle_periodic_contact_pairs<dim>(
-            particle_handler,
+            cell_particle_table,
             cells_local_periodic_neighbor_list,
             cells_ghost_periodic_neighbor_list,
             cells_ghost_local_periodic_neighbor_list,
-            local_contact_pair_periodic_candidates,
-            ghost_contact_pair_periodic_candidates,
-            ghost_local_contact_pair_periodic_candidates,
+            local_contact_pair_candidates,
+            ghost_contact_pair_candidates,
             sparse_contacts_object);
         }
     }
@@ -385,45 +322,23 @@ void
 DEMContactManager<dim>::execute_particle_particle_fine_search(
   const double neighborhood_threshold)
 {
+  // Periodic contacts are stored in the same containers as the regular
+  // contacts. The fine search resolves the periodic image of the new pairs
+  // when the periodic offset is not zero (periodic boundaries enabled).
+
   // Fine search for local particle-particle
   particle_particle_fine_search<dim>(particle_container,
                                      local_adjacent_particles,
                                      local_contact_pair_candidates,
-                                     neighborhood_threshold);
+                                     neighborhood_threshold,
+                                     periodic_offset);
 
   // Fine search for ghost particle-particle
   particle_particle_fine_search<dim>(particle_container,
                                      ghost_adjacent_particles,
                                      ghost_contact_pair_candidates,
-                                     neighborhood_threshold);
-
-  if (DEMActionManager::get_action_manager()
-        ->check_periodic_boundaries_enabled())
-    {
-      // Fine search for local-local periodic particle-particle
-      particle_particle_fine_search<dim>(
-        particle_container,
-        local_local_periodic_adjacent_particles,
-        local_contact_pair_periodic_candidates,
-        neighborhood_threshold,
-        periodic_offset);
-
-      // Fine search for local-ghost periodic particle-particle
-      particle_particle_fine_search<dim>(
-        particle_container,
-        local_ghost_periodic_adjacent_particles,
-        ghost_contact_pair_periodic_candidates,
-        neighborhood_threshold,
-        periodic_offset);
-
-      // Fine search for ghost-local periodic particle-particle
-      particle_particle_fine_search<dim>(
-        particle_container,
-        ghost_local_periodic_adjacent_particles,
-        ghost_local_contact_pair_periodic_candidates,
-        neighborhood_threshold,
-        periodic_offset);
-    }
+                                     neighborhood_threshold,
+                                     periodic_offset);
 }
 
 template <int dim>
@@ -27,6 +27,8 @@ ExplicitEulerIntegrator<dim>::integrate(
   std::vector<Tensor<1, 3>>       &force,
   const std::vector<double>       &MOI)
 {
+  const bool track_displacement = this->displacement != nullptr;
+
   for (auto particle = particle_handler.begin();
        particle != particle_handler.end();
        ++particle)
@@ -50,6 +52,7 @@ ExplicitEulerIntegrator<dim>::integrate(
         particle_position = point_nd_to_3d(particle->get_location());
 
       Tensor<1, 3> acceleration;
+      double       velocity_norm_square = 0.;
       for (int d = 0; d < 3; ++d)
         {
           acceleration[d] = g[d] + (particle_force[d]) * mass_inverse;
@@ -60,6 +63,8 @@ ExplicitEulerIntegrator<dim>::integrate(
           // Position integration
           particle_position[d] +=
             dt * particle_properties[PropertiesIndex::v_x + d];
+          velocity_norm_square += particle_properties[PropertiesIndex::v_x + d] *
+                                  particle_properties[PropertiesIndex::v_x + d];
 
           particle_properties[PropertiesIndex::omega_x + d] +=
             dt * (particle_torque[d] * MOI_inverse);
@@ -71,6 +76,12 @@ ExplicitEulerIntegrator<dim>::integrate(
       // Reinitialize torque
       particle_torque = 0;
 
+      // Update the displacement of the particle for the dynamic contact
+      // detection
+      if (track_displacement)
+        this->update_displacement(particle_id,
+                                  dt * std::sqrt(velocity_norm_square));
+
       if constexpr (dim == 3)
         particle->set_location(particle_position);
 
@@ -3,15 +3,12 @@
 
 using namespace dealii;
 
-template <int dim>
 void
 find_particle_contact_detection_step(
-  Particles::ParticleHandler<dim> &particle_handler,
-  const double                     dt,
-  const double                     smallest_contact_search_criterion,
-  MPI_Comm                        &mpi_communicator,
-  std::vector<double>             &displacement,
-  const bool                       parallel_update)
+  const double max_displacement,
+  const double smallest_contact_search_criterion,
+  MPI_Comm    &mpi_communicator,
+  const bool   parallel_update)
 {
   // Get the action manager
   auto *action_manager = DEMActionManager::get_action_manager();
@@ -20,61 +17,21 @@ find_particle_contact_detection_step(
   if (action_manager->check_contact_search())
     return;
 
-  double max_displacement       = 0.;
-  bool   contact_detection_step = false;
-
-  // Updating displacement
-  for (auto &particle : particle_handler)
-    {
-      auto  particle_properties   = particle.get_properties();
-      auto &particle_displacement = displacement[particle.get_local_index()];
-
-      // Finding displacement of each particle during last step
-      particle_displacement +=
-        dt * sqrt(particle_properties[DEM::PropertiesIndex::v_x] *
-                    particle_properties[DEM::PropertiesIndex::v_x] +
-                  particle_properties[DEM::PropertiesIndex::v_y] *
-                    particle_properties[DEM::PropertiesIndex::v_y] +
-                  particle_properties[DEM::PropertiesIndex::v_z] *
-                    particle_properties[DEM::PropertiesIndex::v_z]);
-
-      // Updating maximum displacement of particles
-      max_displacement = std::max(max_displacement, particle_displacement);
-    }
+  if (!parallel_update)
+    return;
 
   // If the maximum displacement of particles exceeds criterion, this step
   // is a contact detection step
-  contact_detection_step = max_displacement > smallest_contact_search_criterion;
+  bool contact_detection_step =
+    max_displacement > smallest_contact_search_criterion;
 
   // Broadcasting contact detection step value to other processors
-  if (parallel_update)
-    {
-      contact_detection_step =
-        Utilities::MPI::logical_or(contact_detection_step, mpi_communicator);
-      if (contact_detection_step)
-        action_manager->contact_detection_step();
-    }
+  contact_detection_step =
+    Utilities::MPI::logical_or(contact_detection_step, mpi_communicator);
+  if (contact_detection_step)
+    action_manager->contact_detection_step();
 }
 
-template void
-find_particle_contact_detection_step(
-  Particles::ParticleHandler<2> &particle_handler,
-  const double                   dt,
-  const double                   smallest_contact_search_criterion,
-  MPI_Comm                      &mpi_communicator,
-  std::vector<double>           &displacement,
-  const bool                     parallel_update);
-
-template void
-find_particle_contact_detection_step(
-  Particles::ParticleHandler<3> &particle_handler,
-  const double                   dt,
-  const double                   smallest_contact_search_criterion,
-  MPI_Comm                      &mpi_communicator,
-  std::vector<double>           &displacement,
-  const bool                     parallel_update);
-
-
 template <int dim>
 void
 find_floating_mesh_mapping_step(
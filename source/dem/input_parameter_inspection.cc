@@ -1,18 +1,17 @@
+#include <core/simulation_control.h>
+
 #include <dem/input_parameter_inspection.h>
 
 using namespace dealii;
 
-template <int dim>
-void
-input_parameter_inspection(const DEMSolverParameters<dim> &dem_parameters,
-                           const ConditionalOStream       &pcout,
-                           const std::vector<std::shared_ptr<Distribution>>
-                             &size_distribution_object_container)
+double
+calculate_rayleigh_time_step(
+  const Parameters::Lagrangian::LagrangianPhysicalProperties
+    &physical_properties,
+  const std::vector<std::shared_ptr<Distribution>>
+    &size_distribution_object_container)
 {
-  // Getting the input parameters as local variable
-  auto   parameters          = dem_parameters;
-  auto   physical_properties = dem_parameters.lagrangian_physical_properties;
-  double rayleigh_time_step  = DBL_MAX;
+  double rayleigh_time_step = DBL_MAX;
   for (unsigned int i = 0; i < physical_properties.particle_type_number; ++i)
     {
       double shear_modulus =
@@ -29,6 +28,24 @@ input_parameter_inspection(const DEMSolverParameters<dim> &dem_parameters,
         rayleigh_time_step);
     }
 
+  return rayleigh_time_step;
+}
+
+template <int dim>
+void
+input_parameter_inspection(const DEMSolverParameters<dim> &dem_parameters,
+                           const ConditionalOStream       &pcout,
+                           const std::vector<std::shared_ptr<Distribution>>
+                             &size_distribution_object_container)
+{
+  // Getting the input parameters as local variable
+  auto parameters          = dem_parameters;
+  auto physical_properties = dem_parameters.lagrangian_physical_properties;
+
+  const double rayleigh_time_step =
+    calculate_rayleigh_time_step(physical_properties,
+                                 size_distribution_object_container);
+
   const double time_step_rayleigh_ratio =
     parameters.simulation_control.dt / rayleigh_time_step;
   pcout << "DEM time-step is " << time_step_rayleigh_ratio * 100
@@ -45,6 +62,50 @@ input_parameter_inspection(const DEMSolverParameters<dim> &dem_parameters,
             << std::endl;
     }
 
+  // Adaptative time stepping check. The time step given in the parameter file
+  // is the initial value of the adaptative time step, which remains between
+  // the min and the max time step.
+  if (parameters.simulation_control.adapt)
+    {
+      if (parameters.simulation_control.min_dt >
+          parameters.simulation_control.max_dt)
+        throw std::runtime_error(
+          "The min time step must be smaller than the max time step.");
+
+      // The adaptative time step never exceeds a fraction of the Rayleigh
+      // time step, whatever the max time step
+      const double max_rayleigh_time_step_fraction =
+        SimulationControlTransientDEM::max_rayleigh_time_step_fraction;
+      const double max_time_step_rayleigh_ratio =
+        std::min(parameters.simulation_control.max_dt / rayleigh_time_step,
+                 max_rayleigh_time_step_fraction);
+      pcout << "Maximum adaptative DEM time-step is "
+            << max_time_step_rayleigh_ratio * 100 << "% of Rayleigh time step"
+            << std::endl;
+
+      if (parameters.simulation_control.min_dt / rayleigh_time_step >
+          max_rayleigh_time_step_fraction)
+        {
+          pcout << "Warning: The min time step exceeds "
+                << max_rayleigh_time_step_fraction * 100
+                << "% of Rayleigh time step, which bounds the time step instead"
+                << std::endl;
+        }
+
+      if (parameters.grid_motion.motion_type !=
+          Parameters::Lagrangian::GridMotion<dim>::MotionType::none)
+        throw std::runtime_error(
+          "Adaptative time stepping is not supported with grid motion, disable "
+          "adapt in the simulation control subsection.");
+
+      if (parameters.model_parameters.contact_detection_method !=
+          Parameters::Lagrangian::ModelParameters::ContactDetectionMethod::
+            dynamic)
+        throw std::runtime_error(
+          "Adaptative time stepping requires the dynamic contact detection "
+          "method.");
+    }
+
   // Checking particle size range
   for (unsigned int i = 0; i < physical_properties.particle_type_number; ++i)
     {
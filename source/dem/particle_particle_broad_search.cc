@@ -6,7 +6,7 @@ using namespace DEM;
 template <int dim>
 void
 find_particle_particle_contact_pairs(
-  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const CellParticleTable<dim> &cell_particle_table,
   const typename dem_data_structures<dim>::cells_neighbor_list
     &cells_local_neighbor_list,
   const typename dem_data_structures<dim>::cells_neighbor_list
@@ -33,9 +33,8 @@ find_particle_particle_contact_pairs(
       auto cell_neighbor_iterator = cell_neighbor_list_iterator->begin();
 
       // Particles in the main cell
-      typename Particles::ParticleHandler<dim>::particle_iterator_range
-        particles_in_main_cell =
-          particle_handler.particles_in_cell(*cell_neighbor_iterator);
+      const ArrayView<const types::particle_index> particles_in_main_cell =
+        cell_particle_table.particles_in_cell(*cell_neighbor_iterator);
 
       const bool particles_exist_in_main_cell = !particles_in_main_cell.empty();
 
@@ -49,7 +48,7 @@ find_particle_particle_contact_pairs(
                particle_in_main_cell != particles_in_main_cell.end();
                ++particle_in_main_cell)
             {
-              store_candidates<dim>(particle_in_main_cell->get_id(),
+              store_candidates<dim>(*particle_in_main_cell,
                                     std::next(particle_in_main_cell, 1),
                                     particles_in_main_cell,
                                     local_contact_pair_candidates);
@@ -60,10 +59,11 @@ find_particle_particle_contact_pairs(
           for (; cell_neighbor_iterator != cell_neighbor_list_iterator->end();
                ++cell_neighbor_iterator)
             {
-              // Defining iterator on local particles in the neighbor cell
-              typename Particles::ParticleHandler<dim>::particle_iterator_range
+              // Ids of the local particles in the neighbor cell
+              const ArrayView<const types::particle_index>
                 particles_in_neighbor_cell =
-                  particle_handler.particles_in_cell(*cell_neighbor_iterator);
+                  cell_particle_table.particles_in_cell(
+                    *cell_neighbor_iterator);
 
               // Capturing particle pairs, the first particle in the main
               // cell and the second particle in the neighbor cells
@@ -71,7 +71,7 @@ find_particle_particle_contact_pairs(
                    particle_in_main_cell != particles_in_main_cell.end();
                    ++particle_in_main_cell)
                 {
-                  store_candidates<dim>(particle_in_main_cell->get_id(),
+                  store_candidates<dim>(*particle_in_main_cell,
                                         particles_in_neighbor_cell.begin(),
                                         particles_in_neighbor_cell,
                                         local_contact_pair_candidates);
@@ -92,9 +92,8 @@ find_particle_particle_contact_pairs(
       auto cell_neighbor_iterator = cell_neighbor_list_iterator->begin();
 
       // Particles in the main cell
-      typename Particles::ParticleHandler<dim>::particle_iterator_range
-        particles_in_main_cell =
-          particle_handler.particles_in_cell(*cell_neighbor_iterator);
+      const ArrayView<const types::particle_index> particles_in_main_cell =
+        cell_particle_table.particles_in_cell(*cell_neighbor_iterator);
 
       const bool particles_exist_in_main_cell = !particles_in_main_cell.empty();
 
@@ -106,10 +105,11 @@ find_particle_particle_contact_pairs(
           for (; cell_neighbor_iterator != cell_neighbor_list_iterator->end();
                ++cell_neighbor_iterator)
             {
-              // Defining iterator on ghost particles in the neighbor cells
-              typename Particles::ParticleHandler<dim>::particle_iterator_range
+              // Ids of the ghost particles in the neighbor cells
+              const ArrayView<const types::particle_index>
                 particles_in_neighbor_cell =
-                  particle_handler.particles_in_cell(*cell_neighbor_iterator);
+                  cell_particle_table.particles_in_cell(
+                    *cell_neighbor_iterator);
 
               // Capturing particle pairs, the first particle (local) in
               // the main cell and the second particle (ghost) in the
@@ -118,7 +118,7 @@ find_particle_particle_contact_pairs(
                    particle_in_main_cell != particles_in_main_cell.end();
                    ++particle_in_main_cell)
                 {
-                  store_candidates<dim>(particle_in_main_cell->get_id(),
+                  store_candidates<dim>(*particle_in_main_cell,
                                         particles_in_neighbor_cell.begin(),
                                         particles_in_neighbor_cell,
                                         ghost_contact_pair_candidates);
@@ -131,7 +131,7 @@ find_particle_particle_contact_pairs(
 template <int dim>
 void
 find_particle_particle_contact_pairs(
-  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const CellParticleTable<dim> &cell_particle_table,
   const typename dem_data_structures<dim>::cells_neighbor_list
     &cells_local_neighbor_list,
   const typename dem_data_structures<dim>::cells_neighbor_list
@@ -170,9 +170,8 @@ find_particle_particle_contact_pairs(
         continue;
 
       // Get particles in the main cell
-      typename Particles::ParticleHandler<dim>::particle_iterator_range
-        particles_in_main_cell =
-          particle_handler.particles_in_cell(*cell_neighbor_iterator);
+      const ArrayView<const types::particle_index> particles_in_main_cell =
+        cell_particle_table.particles_in_cell(*cell_neighbor_iterator);
 
       // Store other particles in the main cell as contact candidates if
       // main cell is mobile only (this is equivalent to when adaptive sparse
@@ -186,7 +185,7 @@ find_particle_particle_contact_pairs(
                particle_in_main_cell != particles_in_main_cell.end();
                ++particle_in_main_cell)
             {
-              store_candidates<dim>(particle_in_main_cell->get_id(),
+              store_candidates<dim>(*particle_in_main_cell,
                                     std::next(particle_in_main_cell, 1),
                                     particles_in_main_cell,
                                     local_contact_pair_candidates);
@@ -219,14 +218,14 @@ find_particle_particle_contact_pairs(
             }
 
           // Store particles in the neighbor cell as contact candidates
-          typename Particles::ParticleHandler<dim>::particle_iterator_range
+          const ArrayView<const types::particle_index>
             particles_in_neighbor_cell =
-              particle_handler.particles_in_cell(*cell_neighbor_iterator);
+              cell_particle_table.particles_in_cell(*cell_neighbor_iterator);
           for (auto particle_in_main_cell = particles_in_main_cell.begin();
                particle_in_main_cell != particles_in_main_cell.end();
                ++particle_in_main_cell)
             {
-              store_candidates<dim>(particle_in_main_cell->get_id(),
+              store_candidates<dim>(*particle_in_main_cell,
                                     particles_in_neighbor_cell.begin(),
                                     particles_in_neighbor_cell,
                                     local_contact_pair_candidates);
@@ -256,9 +255,8 @@ find_particle_particle_contact_pairs(
         continue;
 
       // Particles in the main cell
-      typename Particles::ParticleHandler<dim>::particle_iterator_range
-        particles_in_main_cell =
-          particle_handler.particles_in_cell(*cell_neighbor_iterator);
+      const ArrayView<const types::particle_index> particles_in_main_cell =
+        cell_particle_table.particles_in_cell(*cell_neighbor_iterator);
 
 
       // Going through ghost neighbor cells of the main cell
@@ -283,10 +281,10 @@ find_particle_particle_contact_pairs(
             }
 
 
-          // Defining iterator on ghost particles in the neighbor cells
-          typename Particles::ParticleHandler<dim>::particle_iterator_range
+          // Ids of the ghost particles in the neighbor cells
+          const ArrayView<const types::particle_index>
             particles_in_neighbor_cell =
-              particle_handler.particles_in_cell(*cell_neighbor_iterator);
+              cell_particle_table.particles_in_cell(*cell_neighbor_iterator);
 
           // Capturing particle pairs, the first particle (local) in
           // the main cell and the second particle (ghost) in the
@@ -295,7 +293,7 @@ find_particle_particle_contact_pairs(
                particle_in_main_cell != particles_in_main_cell.end();
                ++particle_in_main_cell)
             {
-              store_candidates<dim>(particle_in_main_cell->get_id(),
+              store_candidates<dim>(*particle_in_main_cell,
                                     particles_in_neighbor_cell.begin(),
                                     particles_in_neighbor_cell,
                                     ghost_contact_pair_candidates);
@@ -308,7 +306,7 @@ find_particle_particle_contact_pairs(
 template <int dim>
 void
 find_particle_particle_periodic_contact_pairs(
-  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const CellParticleTable<dim> &cell_particle_table,
   const typename dem_data_structures<dim>::cells_neighbor_list
     &cells_local_periodic_neighbor_list,
   const typename dem_data_structures<dim>::cells_neighbor_list
@@ -316,16 +314,13 @@ find_particle_particle_periodic_contact_pairs(
   const typename dem_data_structures<dim>::cells_neighbor_list
     &cells_ghost_local_periodic_neighbor_list,
   typename dem_data_structures<dim>::particle_particle_candidates
-    &local_contact_pair_periodic_candidates,
-  typename dem_data_structures<dim>::particle_particle_candidates
-    &ghost_contact_pair_periodic_candidates,
+    &local_contact_pair_candidates,
   typename dem_data_structures<dim>::particle_particle_candidates
-    &ghost_local_contact_pair_periodic_candidates)
+    &ghost_contact_pair_candidates)
 {
-  // Clear containers
-  local_contact_pair_periodic_candidates.clear();
-  ghost_contact_pair_periodic_candidates.clear();
-  ghost_local_contact_pair_periodic_candidates.clear();
+  // The candidate containers are not cleared since the periodic candidates
+  // are appended to the candidates of the regular broad search. The periodic
+  // image of each pair is resolved in the fine search.
 
   // Looping over the potential periodic cells which may contain particles.
   for (auto cell_periodic_neighbor_list_iterator =
@@ -339,9 +334,8 @@ find_particle_particle_periodic_contact_pairs(
         cell_periodic_neighbor_list_iterator->begin();
 
       // Particles in the main cell
-      typename Particles::ParticleHandler<dim>::particle_iterator_range
-        particles_in_main_cell =
-          particle_handler.particles_in_cell(*cell_periodic_neighbor_iterator);
+      const ArrayView<const types::particle_index> particles_in_main_cell =
+        cell_particle_table.particles_in_cell(*cell_periodic_neighbor_iterator);
 
       const bool particles_exist_in_main_cell = !particles_in_main_cell.empty();
 
@@ -356,11 +350,11 @@ find_particle_particle_periodic_contact_pairs(
                  cell_periodic_neighbor_list_iterator->end();
                ++cell_periodic_neighbor_iterator)
             {
-              // Defining iterator on particles in the local periodic neighbor
+              // Ids of the particles in the local periodic neighbor
               // cell
-              typename Particles::ParticleHandler<dim>::particle_iterator_range
+              const ArrayView<const types::particle_index>
                 particles_in_periodic_neighbor_cell =
-                  particle_handler.particles_in_cell(
+                  cell_particle_table.particles_in_cell(
                     *cell_periodic_neighbor_iterator);
 
               // Capturing particle pairs, the first particle in the main
@@ -371,10 +365,10 @@ find_particle_particle_periodic_contact_pairs(
                    ++particle_in_main_cell)
                 {
                   store_candidates<dim>(
-                    particle_in_main_cell->get_id(),
+                    *particle_in_main_cell,
                     particles_in_periodic_neighbor_cell.begin(),
                     particles_in_periodic_neighbor_cell,
-                    local_contact_pair_periodic_candidates);
+                    local_contact_pair_candidates);
                 }
             }
         }
@@ -395,9 +389,8 @@ find_particle_particle_periodic_contact_pairs(
         cell_periodic_neighbor_list_iterator->begin();
 
       // Particles in the main cell
-      typename Particles::ParticleHandler<dim>::particle_iterator_range
-        particles_in_main_cell =
-          particle_handler.particles_in_cell(*cell_periodic_neighbor_iterator);
+      const ArrayView<const types::particle_index> particles_in_main_cell =
+        cell_particle_table.particles_in_cell(*cell_periodic_neighbor_iterator);
 
       const bool particles_exist_in_main_cell = !particles_in_main_cell.empty();
 
@@ -410,10 +403,10 @@ find_particle_particle_periodic_contact_pairs(
                  cell_periodic_neighbor_list_iterator->end();
                ++cell_periodic_neighbor_iterator)
             {
-              // Defining iterator on ghost particles in the neighbor cells
-              typename Particles::ParticleHandler<dim>::particle_iterator_range
+              // Ids of the ghost particles in the neighbor cells
+              const ArrayView<const types::particle_index>
                 particles_in_periodic_neighbor_cell =
-                  particle_handler.particles_in_cell(
+                  cell_particle_table.particles_in_cell(
                     *cell_periodic_neighbor_iterator);
 
               // Capturing particle pairs, the first particle (local) in
@@ -424,10 +417,10 @@ find_particle_particle_periodic_contact_pairs(
                    ++particle_in_main_cell)
                 {
                   store_candidates<dim>(
-                    particle_in_main_cell->get_id(),
+                    *particle_in_main_cell,
                     particles_in_periodic_neighbor_cell.begin(),
                     particles_in_periodic_neighbor_cell,
-                    ghost_contact_pair_periodic_candidates);
+                    ghost_contact_pair_candidates);
                 }
             }
         }
@@ -445,9 +438,8 @@ find_particle_particle_periodic_contact_pairs(
         cell_periodic_neighbor_list_iterator->begin();
 
       // Particles in the main cell
-      typename Particles::ParticleHandler<dim>::particle_iterator_range
-        particles_in_main_cell =
-          particle_handler.particles_in_cell(*cell_periodic_neighbor_iterator);
+      const ArrayView<const types::particle_index> particles_in_main_cell =
+        cell_particle_table.particles_in_cell(*cell_periodic_neighbor_iterator);
 
       const bool particles_exist_in_main_cell = !particles_in_main_cell.empty();
 
@@ -460,24 +452,26 @@ find_particle_particle_periodic_contact_pairs(
                  cell_periodic_neighbor_list_iterator->end();
                ++cell_periodic_neighbor_iterator)
             {
-              // Defining iterator on local particles in the neighbor cells
-              typename Particles::ParticleHandler<dim>::particle_iterator_range
+              // Ids of the local particles in the neighbor cells
+              const ArrayView<const types::particle_index>
                 particles_in_periodic_neighbor_cell =
-                  particle_handler.particles_in_cell(
+                  cell_particle_table.particles_in_cell(
                     *cell_periodic_neighbor_iterator);
 
-              // Capturing particle pairs, the first particle (ghost) in
-              // the main cell and the second particles (local) in the
-              // neighbor cells
-              for (auto particle_in_main_cell = particles_in_main_cell.begin();
-                   particle_in_main_cell != particles_in_main_cell.end();
-                   ++particle_in_main_cell)
+              // Capturing particle pairs, the first particle (local) in
+              // the neighbor cell and the second particles (ghost) in the
+              // main cell. The pair is stored from the local particle so it
+              // is handled as any other local-ghost pair.
+              for (auto particle_in_neighbor_cell =
+                     particles_in_periodic_neighbor_cell.begin();
+                   particle_in_neighbor_cell !=
+                   particles_in_periodic_neighbor_cell.end();
+                   ++particle_in_neighbor_cell)
                 {
-                  store_candidates<dim>(
-                    particle_in_main_cell->get_id(),
-                    particles_in_periodic_neighbor_cell.begin(),
-                    particles_in_periodic_neighbor_cell,
-                    ghost_local_contact_pair_periodic_candidates);
+                  store_candidates<dim>(*particle_in_neighbor_cell,
+                                        particles_in_main_cell.begin(),
+                                        particles_in_main_cell,
+                                        ghost_contact_pair_candidates);
                 }
             }
         }
@@ -487,7 +481,7 @@ find_particle_particle_periodic_contact_pairs(
 template <int dim>
 void
 find_particle_particle_periodic_contact_pairs(
-  dealii::Particles::ParticleHandler<dim> &particle_handler,
+  const CellParticleTable<dim> &cell_particle_table,
   const typename dem_data_structures<dim>::cells_neighbor_list
     &cells_local_periodic_neighbor_list,
   const typename dem_data_structures<dim>::cells_neighbor_list
@@ -495,17 +489,14 @@ find_particle_particle_periodic_contact_pairs(
   const typename dem_data_structures<dim>::cells_neighbor_list
     &cells_ghost_local_periodic_neighbor_list,
   typename dem_data_structures<dim>::particle_particle_candidates
-    &local_contact_pair_periodic_candidates,
+                                    &local_contact_pair_candidates,
   typename dem_data_structures<dim>::particle_particle_candidates
-    &ghost_contact_pair_periodic_candidates,
-  typename dem_data_structures<dim>::particle_particle_candidates
-    &ghost_local_contact_pair_periodic_candidates,
+                                    &ghost_contact_pair_candidates,
   const AdaptiveSparseContacts<dim> &sparse_contacts_object)
 {
-  // Clear containers
-  local_contact_pair_periodic_candidates.clear();
-  ghost_contact_pair_periodic_candidates.clear();
-  ghost_local_contact_pair_periodic_candidates.clear();
+  // The candidate containers are not cleared since the periodic candidates
+  // are appended to the candidates of the regular broad search. The periodic
+  // image of each pair is resolved in the fine search.
 
   // Looping over the potential periodic cells which may contain particles.
   for (auto cell_periodic_neighbor_list_iterator =
@@ -530,9 +521,8 @@ find_particle_particle_periodic_contact_pairs(
         continue;
 
       // Particles in the main cell
-      typename Particles::ParticleHandler<dim>::particle_iterator_range
-        particles_in_main_cell =
-          particle_handler.particles_in_cell(*cell_periodic_neighbor_iterator);
+      const ArrayView<const types::particle_index> particles_in_main_cell =
+        cell_particle_table.particles_in_cell(*cell_periodic_neighbor_iterator);
 
       // Going through periodic neighbor cells on the periodic boundary 1
       // of the main cell
@@ -555,11 +545,11 @@ find_particle_particle_periodic_contact_pairs(
                 AdaptiveSparseContacts<dim>::mobile)
             continue;
 
-          // Defining iterator on local particles in the periodic neighbor
+          // Ids of the local particles in the periodic neighbor
           // cell
-          typename Particles::ParticleHandler<dim>::particle_iterator_range
+          const ArrayView<const types::particle_index>
             particles_in_periodic_neighbor_cell =
-              particle_handler.particles_in_cell(
+              cell_particle_table.particles_in_cell(
                 *cell_periodic_neighbor_iterator);
 
           // Capturing particle pairs, the first particle in the main
@@ -568,10 +558,10 @@ find_particle_particle_periodic_contact_pairs(
                particle_in_main_cell != particles_in_main_cell.end();
                ++particle_in_main_cell)
             {
-              store_candidates<dim>(particle_in_main_cell->get_id(),
+              store_candidates<dim>(*particle_in_main_cell,
                                     particles_in_periodic_neighbor_cell.begin(),
                                     particles_in_periodic_neighbor_cell,
-                                    local_contact_pair_periodic_candidates);
+                                    local_contact_pair_candidates);
             }
         }
     }
@@ -600,9 +590,8 @@ find_particle_particle_periodic_contact_pairs(
         continue;
 
       // Particles in the main cell
-      typename Particles::ParticleHandler<dim>::particle_iterator_range
-        particles_in_main_cell =
-          particle_handler.particles_in_cell(*cell_periodic_neighbor_iterator);
+      const ArrayView<const types::particle_index> particles_in_main_cell =
+        cell_particle_table.particles_in_cell(*cell_periodic_neighbor_iterator);
 
       // Going through ghost neighbor cells of the main cell
       ++cell_periodic_neighbor_iterator;
@@ -624,10 +613,10 @@ find_particle_particle_periodic_contact_pairs(
                 AdaptiveSparseContacts<dim>::mobile)
             continue;
 
-          // Defining iterator on ghost particles in the neighbor cells
-          typename Particles::ParticleHandler<dim>::particle_iterator_range
+          // Ids of the ghost particles in the neighbor cells
+          const ArrayView<const types::particle_index>
             particles_in_periodic_neighbor_cell =
-              particle_handler.particles_in_cell(
+              cell_particle_table.particles_in_cell(
                 *cell_periodic_neighbor_iterator);
 
           // Capturing particle pairs, the first particle (local) in
@@ -637,10 +626,10 @@ find_particle_particle_periodic_contact_pairs(
                particle_in_main_cell != particles_in_main_cell.end();
                ++particle_in_main_cell)
             {
-              store_candidates<dim>(particle_in_main_cell->get_id(),
+              store_candidates<dim>(*particle_in_main_cell,
                                     particles_in_periodic_neighbor_cell.begin(),
                                     particles_in_periodic_neighbor_cell,
-                                    ghost_contact_pair_periodic_candidates);
+                                    ghost_contact_pair_candidates);
             }
         }
     }
@@ -668,9 +657,8 @@ find_particle_particle_periodic_contact_pairs(
         continue;
 
       // Particles in the main cell
-      typename Particles::ParticleHandler<dim>::particle_iterator_range
-        particles_in_main_cell =
-          particle_handler.particles_in_cell(*cell_periodic_neighbor_iterator);
+      const ArrayView<const types::particle_index> particles_in_main_cell =
+        cell_particle_table.particles_in_cell(*cell_periodic_neighbor_iterator);
 
       // Going through ghost neighbor cells of the main cell
       ++cell_periodic_neighbor_iterator;
@@ -692,24 +680,26 @@ find_particle_particle_periodic_contact_pairs(
                 AdaptiveSparseContacts<dim>::mobile)
             continue;
 
-          // Defining iterator on local particles in the neighbor cells
-          typename Particles::ParticleHandler<dim>::particle_iterator_range
+          // Ids of the local particles in the neighbor cells
+          const ArrayView<const types::particle_index>
             particles_in_periodic_neighbor_cell =
-              particle_handler.particles_in_cell(
+              cell_particle_table.particles_in_cell(
                 *cell_periodic_neighbor_iterator);
 
-          // Capturing particle pairs, the first particle (ghost) in
-          // the main cell and the second particles (local) in the
-          // neighbor cells
-          for (auto particle_in_main_cell = particles_in_main_cell.begin();
-               particle_in_main_cell != particles_in_main_cell.end();
-               ++particle_in_main_cell)
+          // Capturing particle pairs, the first particle (local) in
+          // the neighbor cell and the second particles (ghost) in the
+          // main cell. The pair is stored from the local particle so it
+          // is handled as any other local-ghost pair.
+          for (auto particle_in_neighbor_cell =
+                 particles_in_periodic_neighbor_cell.begin();
+               particle_in_neighbor_cell !=
+               particles_in_periodic_neighbor_cell.end();
+               ++particle_in_neighbor_cell)
             {
-              store_candidates<dim>(
-                particle_in_main_cell->get_id(),
-                particles_in_periodic_neighbor_cell.begin(),
-                particles_in_periodic_neighbor_cell,
-                ghost_local_contact_pair_periodic_candidates);
+              store_candidates<dim>(*particle_in_neighbor_cell,
+                                    particles_in_main_cell.begin(),
+                                    particles_in_main_cell,
+                                    ghost_contact_pair_candidates);
             }
         }
     }
@@ -718,11 +708,9 @@ find_particle_particle_periodic_contact_pairs(
 template <int dim>
 void
 store_candidates(
-  const types::particle_index &main_particle_id,
-  const typename Particles::ParticleHandler<
-    dim>::particle_iterator_range::iterator &particle_begin,
-  const typename Particles::ParticleHandler<dim>::particle_iterator_range
-    &particles_to_evaluate,
+  const types::particle_index                            &main_particle_id,
+  const ArrayView<const types::particle_index>::iterator &particle_begin,
+  const ArrayView<const types::particle_index>           &particles_to_evaluate,
   typename dem_data_structures<dim>::particle_particle_candidates
     &contact_pair_candidates)
 {
@@ -743,18 +731,16 @@ store_candidates(
       candidates_container_it = pair_it_bool.first;
     }
 
-  // Store particle ids from the selected particle iterator
-  for (auto particle_iterator = particle_begin;
-       particle_iterator != particles_to_evaluate.end();
-       ++particle_iterator)
-    {
-      candidates_container_it->second.emplace_back(particle_iterator->get_id());
-    }
+  // Store the contiguous range of particle ids starting at the selected
+  // particle
+  candidates_container_it->second.insert(candidates_container_it->second.end(),
+                                         particle_begin,
+                                         particles_to_evaluate.end());
 }
 
 template void
 find_particle_particle_contact_pairs<2>(
-  dealii::Particles::ParticleHandler<2> &particle_handler,
+  const CellParticleTable<2> &cell_particle_table,
   const typename dem_data_structures<2>::cells_neighbor_list
     &cells_local_neighbor_list,
   const typename dem_data_structures<2>::cells_neighbor_list
@@ -766,7 +752,7 @@ find_particle_particle_contact_pairs<2>(
 
 template void
 find_particle_particle_contact_pairs<3>(
-  dealii::Particles::ParticleHandler<3> &particle_handler,
+  const CellParticleTable<3> &cell_particle_table,
   const typename dem_data_structures<3>::cells_neighbor_list
     &cells_local_neighbor_list,
   const typename dem_data_structures<3>::cells_neighbor_list
@@ -778,7 +764,7 @@ find_particle_particle_contact_pairs<3>(
 
 template void
 find_particle_particle_contact_pairs<2>(
-  dealii::Particles::ParticleHandler<2> &particle_handler,
+  const CellParticleTable<2> &cell_particle_table,
   const typename dem_data_structures<2>::cells_neighbor_list
     &cells_local_neighbor_list,
   const typename dem_data_structures<2>::cells_neighbor_list
@@ -791,7 +777,7 @@ find_particle_particle_contact_pairs<2>(
 
 template void
 find_particle_particle_contact_pairs<3>(
-  dealii::Particles::ParticleHandler<3> &particle_handler,
+  const CellParticleTable<3> &cell_particle_table,
   const typename dem_data_structures<3>::cells_neighbor_list
     &cells_local_neighbor_list,
   const typename dem_data_structures<3>::cells_neighbor_list
@@ -804,7 +790,7 @@ find_particle_particle_contact_pairs<3>(
 
 template void
 find_particle_particle_periodic_contact_pairs<2>(
-  dealii::Particles::ParticleHandler<2> &particle_handler,
+  const CellParticleTable<2> &cell_particle_table,
   const typename dem_data_structures<2>::cells_neighbor_list
     &cells_local_periodic_neighbor_list,
   const typename dem_data_structures<2>::cells_neighbor_list
@@ -812,15 +798,13 @@ find_particle_particle_periodic_contact_pairs<2>(
   const typename dem_data_structures<2>::cells_neighbor_list
     &cells_ghost_local_neighbor_list,
   typename dem_data_structures<2>::particle_particle_candidates
-    &local_contact_pair_periodic_candidates,
-  typename dem_data_structures<2>::particle_particle_candidates
-    &ghost_contact_pair_periodic_candidates,
+    &local_contact_pair_candidates,
   typename dem_data_structures<2>::particle_particle_candidates
-    &ghost_local_contact_pair_periodic_candidates);
+    &ghost_contact_pair_candidates);
 
 template void
 find_particle_particle_periodic_contact_pairs<3>(
-  dealii::Particles::ParticleHandler<3> &particle_handler,
+  const CellParticleTable<3> &cell_particle_table,
   const typename dem_data_structures<3>::cells_neighbor_list
     &cells_local_periodic_neighbor_list,
   const typename dem_data_structures<3>::cells_neighbor_list
@@ -828,15 +812,13 @@ find_particle_particle_periodic_contact_pairs<3>(
   const typename dem_data_structures<3>::cells_neighbor_list
     &cells_ghost_local_neighbor_list,
   typename dem_data_structures<3>::particle_particle_candidates
-    &local_contact_pair_periodic_candidates,
-  typename dem_data_structures<3>::particle_particle_candidates
-    &ghost_contact_pair_periodic_candidates,
+    &local_contact_pair_candidates,
   typename dem_data_structures<3>::particle_particle_candidates
-    &ghost_local_contact_pair_periodic_candidates);
+    &ghost_contact_pair_candidates);
 
 template void
 find_particle_particle_periodic_contact_pairs<2>(
-  dealii::Particles::ParticleHandler<2> &particle_handler,
+  const CellParticleTable<2> &cell_particle_table,
   const typename dem_data_structures<2>::cells_neighbor_list
     &cells_local_periodic_neighbor_list,
   const typename dem_data_structures<2>::cells_neighbor_list
@@ -844,16 +826,14 @@ find_particle_particle_periodic_contact_pairs<2>(
   const typename dem_data_structures<2>::cells_neighbor_list
     &cells_ghost_local_neighbor_list,
   typename dem_data_structures<2>::particle_particle_candidates
-    &local_contact_pair_periodic_candidates,
+                                  &local_contact_pair_candidates,
   typename dem_data_structures<2>::particle_particle_candidates
-    &ghost_contact_pair_periodic_candidates,
-  typename dem_data_structures<2>::particle_particle_candidates
-                                  &ghost_local_contact_pair_periodic_candidates,
+                                  &ghost_contact_pair_candidates,
   const AdaptiveSparseContacts<2> &sparse_contacts_object);
 
 template void
 find_particle_particle_periodic_contact_pairs<3>(
-  dealii::Particles::ParticleHandler<3> &particle_handler,
+  const CellParticleTable<3> &cell_particle_table,
   const typename dem_data_structures<3>::cells_neighbor_list
     &cells_local_periodic_neighbor_list,
   const typename dem_data_structures<3>::cells_neighbor_list
@@ -861,9 +841,7 @@ find_particle_particle_periodic_contact_pairs<3>(
   const typename dem_data_structures<3>::cells_neighbor_list
     &cells_ghost_local_neighbor_list,
   typename dem_data_structures<3>::particle_particle_candidates
-    &local_contact_pair_periodic_candidates,
+                                  &local_contact_pair_candidates,
   typename dem_data_structures<3>::particle_particle_candidates
-    &ghost_contact_pair_periodic_candidates,
-  typename dem_data_structures<3>::particle_particle_candidates
-                                  &ghost_local_contact_pair_periodic_candidates,
+                                  &ghost_contact_pair_candidates,
   const AdaptiveSparseContacts<3> &sparse_contacts_object);
@@ -24,18 +24,15 @@ ParticleParticleContactForce<dim, contact_model, rolling_friction_model>::
     typename dem_data_structures<dim>::adjacent_particle_pairs
       &local_adjacent_particles,
     typename dem_data_structures<dim>::adjacent_particle_pairs
-      &ghost_adjacent_particles,
-    typename dem_data_structures<dim>::adjacent_particle_pairs
-      &local_local_periodic_adjacent_particles,
-    typename dem_data_structures<dim>::adjacent_particle_pairs
-      &local_ghost_periodic_adjacent_particles,
-    typename dem_data_structures<dim>::adjacent_particle_pairs
-                              &ghost_local_periodic_adjacent_particles,
+                              &ghost_adjacent_particles,
     const double               dt,
     std::vector<Tensor<1, 3>> &torque,
     std::vector<Tensor<1, 3>> &force)
 {
-  // Calculating the contact forces the local-local adjacent particles.
+  this->max_normal_overlap_growth_ratio = 0.;
+
+  // Calculating the contact forces the local-local adjacent particles,
+  // including the periodic ones.
   for (auto &&adjacent_particles_list :
        local_adjacent_particles | boost::adaptors::map_values)
     {
@@ -43,40 +40,14 @@ ParticleParticleContactForce<dim, contact_model, rolling_friction_model>::
         adjacent_particles_list, torque, force, dt);
     }
 
-  // Calculating the contact forces the local-ghost adjacent particles.
+  // Calculating the contact forces the local-ghost adjacent particles,
+  // including the periodic ones.
   for (auto &&adjacent_particles_list :
        ghost_adjacent_particles | boost::adaptors::map_values)
     {
       execute_contact_calculation<ContactType::ghost_particle_particle>(
         adjacent_particles_list, torque, force, dt);
     }
-
-  // Calculating the contact forces the local-local periodic adjacent particles.
-  for (auto &&periodic_adjacent_particles_list :
-       local_local_periodic_adjacent_particles | boost::adaptors::map_values)
-    {
-      execute_contact_calculation<
-        ContactType::local_periodic_particle_particle>(
-        periodic_adjacent_particles_list, torque, force, dt);
-    }
-
-  // Calculating the contact forces the local-ghost periodic adjacent particles.
-  for (auto &&periodic_adjacent_particles_list :
-       local_ghost_periodic_adjacent_particles | boost::adaptors::map_values)
-    {
-      execute_contact_calculation<
-        ContactType::ghost_periodic_particle_particle>(
-        periodic_adjacent_particles_list, torque, force, dt);
-    }
-
-  // Calculating the contact forces the ghost-local periodic adjacent particles.
-  for (auto &&periodic_adjacent_particles_list :
-       ghost_local_periodic_adjacent_particles | boost::adaptors::map_values)
-    {
-      execute_contact_calculation<
-        ContactType::ghost_local_periodic_particle_particle>(
-        periodic_adjacent_particles_list, torque, force, dt);
-    }
 }
 
 // No resistance
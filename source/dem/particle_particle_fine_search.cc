@@ -10,6 +10,46 @@
 
 using namespace dealii;
 
+/**
+ * @brief Find the nearest image of particle 2 among its location and its two
+ * periodic images.
+ *
+ * @param[in] particle_one_location Location of particle 1.
+ * @param[in] particle_two_location Location of particle 2.
+ * @param[in] periodic_offset Offset between the periodic boundaries 0 and 1.
+ * @param[out] pair_periodic_offset Offset to subtract from the location of
+ * particle 2 to obtain its nearest image.
+ *
+ * @return Square distance between particle 1 and the nearest image of
+ * particle 2.
+ */
+template <int dim>
+inline double
+find_nearest_periodic_image(const Point<dim>     &particle_one_location,
+                            const Point<dim>     &particle_two_location,
+                            const Tensor<1, dim> &periodic_offset,
+                            Tensor<1, dim>       &pair_periodic_offset)
+{
+  pair_periodic_offset.clear();
+  double square_distance =
+    particle_one_location.distance_square(particle_two_location);
+
+  for (const double direction : {1., -1.})
+    {
+      const double periodic_square_distance =
+        particle_one_location.distance_square(particle_two_location -
+                                              direction * periodic_offset);
+
+      if (periodic_square_distance < square_distance)
+        {
+          square_distance      = periodic_square_distance;
+          pair_periodic_offset = direction * periodic_offset;
+        }
+    }
+
+  return square_distance;
+}
+
 template <int dim>
 void
 particle_particle_fine_search(
@@ -22,6 +62,19 @@ particle_particle_fine_search(
   const double         neighborhood_threshold,
   const Tensor<1, dim> periodic_offset)
 {
+  // Periodic contacts are stored with the regular contacts, so the periodic
+  // images of particle 2 are only checked if the periodic boundaries are
+  // enabled (non-zero offset)
+  const bool check_periodic_images = periodic_offset.norm_square() > 0.;
+
+  // A pair can only be in contact through a single image of particle 2 if the
+  // periodic length is at least twice the neighborhood distance
+  AssertThrow(!check_periodic_images ||
+                periodic_offset.norm_square() >= 4. * neighborhood_threshold,
+              ExcMessage(
+                "The periodic length must be at least twice the neighborhood "
+                "threshold distance of the particle-particle contacts."));
+
   // First iterating over adjacent_particles
   for (auto &&adjacent_particles_list :
        adjacent_particles | boost::adaptors::map_values)
@@ -44,13 +97,26 @@ particle_particle_fine_search(
             adjacent_particles_list_iterator->second;
           auto &particle_two = adjacent_pair_information.particle_two;
 
-          // Finding the properties of the particles in contact
+          // Finding the location of particle 2 or of its periodic image
           Point<dim, double> particle_two_location =
-            particle_two->get_location() - periodic_offset;
+            particle_two->get_location();
 
           // Finding distance
-          const double square_distance =
-            particle_one_location.distance_square(particle_two_location);
+          double square_distance = particle_one_location.distance_square(
+            particle_two_location - adjacent_pair_information.periodic_offset);
+
+          // A particle of the pair may have been moved through the periodic
+          // boundaries since the last search, the nearest image is then found
+          // again to keep the contact history
+          if (check_periodic_images && square_distance > neighborhood_threshold)
+            {
+              square_distance = find_nearest_periodic_image(
+                particle_one_location,
+                particle_two_location,
+                periodic_offset,
+                adjacent_pair_information.periodic_offset);
+            }
+
           if (square_distance > neighborhood_threshold)
             {
               adjacent_particles_list_iterator =
@@ -80,24 +146,52 @@ particle_particle_fine_search(
         {
           auto particle_two = particle_container.at(particle_two_id);
           Point<dim, double> particle_two_location =
-            particle_two->get_location() - periodic_offset;
+            particle_two->get_location();
 
           // Finding distance
-          const double square_distance =
+          double square_distance =
             particle_one_location.distance_square(particle_two_location);
 
+          // If the pair is not in vicinity, particle 2 may be a periodic
+          // neighbor. The nearest periodic image of particle 2 is kept along
+          // with the offset to reach it.
+          Tensor<1, dim> pair_periodic_offset;
+          if (check_periodic_images && square_distance > neighborhood_threshold)
+            {
+              square_distance =
+                find_nearest_periodic_image(particle_one_location,
+                                            particle_two_location,
+                                            periodic_offset,
+                                            pair_periodic_offset);
+            }
+
           // If the particles distance is less than the threshold
           if (square_distance < neighborhood_threshold)
             {
+              // In small periodic domains, the regular and the periodic broad
+              // searches can both capture a local-local pair, once in each
+              // order. The pair is only stored once to avoid counting the
+              // contact twice.
+              if (check_periodic_images)
+                {
+                  auto reversed_pair_list =
+                    adjacent_particles.find(particle_two_id);
+                  if (reversed_pair_list != adjacent_particles.end() &&
+                      reversed_pair_list->second.count(particle_one_id) > 0)
+                    continue;
+                }
+
               // Getting the particle one contact list and particle two id
               auto &particle_one_contact_list =
                 adjacent_particles[particle_one_id];
 
               particle_one_contact_list.emplace(
                 particle_two_id,
-                particle_particle_contact_info<dim>{particle_one,
-                                                    particle_two,
-                                                    Tensor<1, 3>()});
+                particle_particle_contact_info<dim>{
+                  particle_one,
+                  particle_two,
+                  Tensor<1, 3, DEM::contact_history_number>(),
+                  pair_periodic_offset});
             }
         }
     }
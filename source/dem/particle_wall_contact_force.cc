@@ -81,6 +81,14 @@ ParticleWallContactForce<dim>::update_contact_information(
   Tensor<1, 3> modified_tangential_overlap =
     contact_info.tangential_overlap + tangential_relative_velocity * dt;
 
+  // Track the largest growth of the overlap during a time step relative to the
+  // diameter of the particle. With the (i -> j) convention, the normal relative
+  // velocity is negative when the particle approaches the wall.
+  this->max_normal_overlap_growth_ratio =
+    std::max(this->max_normal_overlap_growth_ratio,
+             -normal_relative_velocity_value * dt /
+               particle_properties[DEM::PropertiesIndex::dp]);
+
   // Updating the contact_info container based on the new calculated values
   contact_info.normal_relative_velocity     = normal_relative_velocity_value;
   contact_info.tangential_overlap           = modified_tangential_overlap;
@@ -144,6 +152,14 @@ ParticleWallContactForce<dim>::
   Tensor<1, 3> modified_tangential_overlap =
     contact_info.tangential_overlap + tangential_relative_velocity * dt;
 
+  // Track the largest growth of the overlap during a time step relative to the
+  // diameter of the particle. With the (i -> j) convention, the normal relative
+  // velocity is negative when the particle approaches the wall.
+  this->max_normal_overlap_growth_ratio =
+    std::max(this->max_normal_overlap_growth_ratio,
+             -normal_relative_velocity_value * dt /
+               particle_properties[DEM::PropertiesIndex::dp]);
+
   // Updating the contact_info container based on the new calculated values
   contact_info.normal_relative_velocity     = normal_relative_velocity_value;
   contact_info.tangential_overlap           = modified_tangential_overlap;
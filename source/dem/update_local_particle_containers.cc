@@ -53,12 +53,6 @@ update_contact_container_iterators(
 
       if constexpr (contact_type == ContactType::local_particle_particle ||
                     contact_type == ContactType::ghost_particle_particle ||
-                    contact_type ==
-                      ContactType::local_periodic_particle_particle ||
-                    contact_type ==
-                      ContactType::ghost_periodic_particle_particle ||
-                    contact_type ==
-                      ContactType::ghost_local_periodic_particle_particle ||
                     contact_type == ContactType::particle_wall ||
                     contact_type == ContactType::particle_floating_wall)
         {
@@ -84,14 +78,7 @@ update_contact_container_iterators(
               if constexpr (contact_type ==
                               ContactType::local_particle_particle ||
                             contact_type ==
-                              ContactType::ghost_particle_particle ||
-                            contact_type ==
-                              ContactType::local_periodic_particle_particle ||
-                            contact_type ==
-                              ContactType::ghost_periodic_particle_particle ||
-                            contact_type ==
-                              ContactType::
-                                ghost_local_periodic_particle_particle)
+                              ContactType::ghost_particle_particle)
                 {
                   unsigned int particle_two_id = adjacent_map_iterator->first;
 
@@ -235,69 +222,6 @@ update_contact_container_iterators<
   const typename DEM::dem_data_structures<3>::particle_index_iterator_map
     &particle_container);
 
-// Local-local particle-particle periodic contact container
-template void
-update_contact_container_iterators<
-  2,
-  typename DEM::dem_data_structures<2>::adjacent_particle_pairs,
-  ContactType::local_periodic_particle_particle>(
-  typename DEM::dem_data_structures<2>::adjacent_particle_pairs
-    &pairs_in_contact,
-  const typename DEM::dem_data_structures<2>::particle_index_iterator_map
-    &particle_container);
-
-template void
-update_contact_container_iterators<
-  3,
-  typename DEM::dem_data_structures<3>::adjacent_particle_pairs,
-  ContactType::local_periodic_particle_particle>(
-  typename DEM::dem_data_structures<3>::adjacent_particle_pairs
-    &pairs_in_contact,
-  const typename DEM::dem_data_structures<3>::particle_index_iterator_map
-    &particle_container);
-
-// Local-ghost particle-particle periodic contact container
-template void
-update_contact_container_iterators<
-  2,
-  typename DEM::dem_data_structures<2>::adjacent_particle_pairs,
-  ContactType::ghost_periodic_particle_particle>(
-  typename DEM::dem_data_structures<2>::adjacent_particle_pairs
-    &pairs_in_contact,
-  const typename DEM::dem_data_structures<2>::particle_index_iterator_map
-    &particle_container);
-
-template void
-update_contact_container_iterators<
-  3,
-  typename DEM::dem_data_structures<3>::adjacent_particle_pairs,
-  ContactType::ghost_periodic_particle_particle>(
-  typename DEM::dem_data_structures<3>::adjacent_particle_pairs
-    &pairs_in_contact,
-  const typename DEM::dem_data_structures<3>::particle_index_iterator_map
-    &particle_container);
-
-// Ghost-local particle-particle periodic contact container
-template void
-update_contact_container_iterators<
-  2,
-  typename DEM::dem_data_structures<2>::adjacent_particle_pairs,
-  ContactType::ghost_local_periodic_particle_particle>(
-  typename DEM::dem_data_structures<2>::adjacent_particle_pairs
-    &pairs_in_contact,
-  const typename DEM::dem_data_structures<2>::particle_index_iterator_map
-    &particle_container);
-
-template void
-update_contact_container_iterators<
-  3,
-  typename DEM::dem_data_structures<3>::adjacent_particle_pairs,
-  ContactType::ghost_local_periodic_particle_particle>(
-  typename DEM::dem_data_structures<3>::adjacent_particle_pairs
-    &pairs_in_contact,
-  const typename DEM::dem_data_structures<3>::particle_index_iterator_map
-    &particle_container);
-
 // Particle-wall contact container
 template void
 update_contact_container_iterators<
@@ -17,6 +17,7 @@ VelocityVerletIntegrator<dim>::integrate_half_step_location(
   const std::vector<double>       &MOI)
 {
   Tensor<1, dim> particle_acceleration;
+  const bool     track_displacement = this->displacement != nullptr;
 
   for (auto particle = particle_handler.begin();
        particle != particle_handler.end();
@@ -48,6 +49,18 @@ VelocityVerletIntegrator<dim>::integrate_half_step_location(
             particle_properties[PropertiesIndex::v_x + d] * dt;
         }
       particle->set_location(particle_position);
+
+      // Update the displacement of the particle for the dynamic contact
+      // detection
+      if (track_displacement)
+        this->update_displacement(
+          particle_id,
+          dt * std::sqrt(particle_properties[PropertiesIndex::v_x] *
+                           particle_properties[PropertiesIndex::v_x] +
+                         particle_properties[PropertiesIndex::v_y] *
+                           particle_properties[PropertiesIndex::v_y] +
+                         particle_properties[PropertiesIndex::v_z] *
+                           particle_properties[PropertiesIndex::v_z]));
     }
 }
 
@@ -63,7 +76,10 @@ VelocityVerletIntegrator<dim>::integrate(
 {
   Point<3>           particle_position;
   const Tensor<1, 3> dt_g = g * dt;
+  const bool         track_displacement = this->displacement != nullptr;
 
+  // Velocity, location, displacement and the reinitialization of force and
+  // torque are all carried out in a single pass over the particles
   for (auto &particle : particle_handler)
     {
       // Get the total array view to the particle properties once to improve
@@ -114,6 +130,18 @@ VelocityVerletIntegrator<dim>::integrate(
           particle_torque[2] * dt_MOI_inverse;
       }
 
+      // Update the displacement of the particle for the dynamic contact
+      // detection
+      if (track_displacement)
+        this->update_displacement(
+          particle_id,
+          dt * std::sqrt(particle_properties[PropertiesIndex::v_x] *
+                           particle_properties[PropertiesIndex::v_x] +
+                         particle_properties[PropertiesIndex::v_y] *
+                           particle_properties[PropertiesIndex::v_y] +
+                         particle_properties[PropertiesIndex::v_z] *
+                           particle_properties[PropertiesIndex::v_z]));
+
       // Reinitialize force and torque of particle
       particle_force  = 0;
       particle_torque = 0;
@@ -174,6 +202,7 @@ VelocityVerletIntegrator<dim>::integrate(
     {
       Point<3>           particle_position;
       const Tensor<1, 3> dt_g = g * dt;
+      const bool         track_displacement = this->displacement != nullptr;
 
       // Get the map of mobility status of cells
       auto &cell_mobility_status_map =
@@ -210,6 +239,7 @@ VelocityVerletIntegrator<dim>::integrate(
                           double dt_mass_inverse =
                             dt / particle_properties[PropertiesIndex::mass];
                           double dt_MOI_inverse = dt / MOI[particle_id];
+                          double velocity_norm_square = 0.;
 
                           particle_position = [&] {
                             if constexpr (dim == 3)
@@ -233,6 +263,9 @@ VelocityVerletIntegrator<dim>::integrate(
                               particle_position[d] +=
                                 particle_properties[PropertiesIndex::v_x + d] *
                                 dt;
+                              velocity_norm_square +=
+                                particle_properties[PropertiesIndex::v_x + d] *
+                                particle_properties[PropertiesIndex::v_x + d];
 
                               // Updating angular velocity
                               particle_properties[PropertiesIndex::omega_x +
@@ -244,6 +277,13 @@ VelocityVerletIntegrator<dim>::integrate(
                           particle_force  = 0.0;
                           particle_torque = 0.0;
 
+                          // Update the displacement of the particle for the
+                          // dynamic contact detection
+                          if (track_displacement)
+                            this->update_displacement(
+                              particle_id,
+                              dt * std::sqrt(velocity_norm_square));
+
                           // Update particle location
                           if constexpr (dim == 3)
                             particle.set_location(particle_position);
@@ -289,6 +329,7 @@ VelocityVerletIntegrator<dim>::integrate_with_advected_particles(
 {
   Point<3>           particle_position;
   const Tensor<1, 3> dt_g = g * dt;
+  const bool         track_displacement = this->displacement != nullptr;
 
   // Get the map of average velocities and accelerations of cells
   auto cell_velocities_accelerations_map =
@@ -336,7 +377,8 @@ VelocityVerletIntegrator<dim>::integrate_with_advected_particles(
 
                       double dt_mass_inverse =
                         dt / particle_properties[PropertiesIndex::mass];
-                      double dt_MOI_inverse = dt / MOI[particle_id];
+                      double dt_MOI_inverse       = dt / MOI[particle_id];
+                      double velocity_norm_square = 0.;
 
                       particle_position = [&] {
                         if constexpr (dim == 3)
@@ -368,6 +410,9 @@ VelocityVerletIntegrator<dim>::integrate_with_advected_particles(
                           // Particle location integration
                           particle_position[d] +=
                             particle_properties[PropertiesIndex::v_x + d] * dt;
+                          velocity_norm_square +=
+                            particle_properties[PropertiesIndex::v_x + d] *
+                            particle_properties[PropertiesIndex::v_x + d];
 
                           // Updating angular velocity
                           particle_properties[PropertiesIndex::omega_x + d] +=
@@ -378,6 +423,12 @@ VelocityVerletIntegrator<dim>::integrate_with_advected_particles(
                       particle_force  = 0.0;
                       particle_torque = 0.0;
 
+                      // Update the displacement of the particle for the
+                      // dynamic contact detection
+                      if (track_displacement)
+                        this->update_displacement(
+                          particle_id, dt * std::sqrt(velocity_norm_square));
+
                       // Update particle location
                       if constexpr (dim == 3)
                         particle.set_location(particle_position);
@@ -429,6 +480,12 @@ VelocityVerletIntegrator<dim>::integrate_with_advected_particles(
                       force[particle_id]  = 0.0;
                       torque[particle_id] = 0.0;
 
+                      // Update the displacement of the particle for the
+                      // dynamic contact detection
+                      if (track_displacement)
+                        this->update_displacement(
+                          particle_id, dt * velocity_cell_average.norm());
+
                       // Update particle location
                       if constexpr (dim == 3)
                         particle.set_location(particle_position);
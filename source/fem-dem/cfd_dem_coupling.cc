@@ -129,6 +129,13 @@ CFDDEMSolver<dim>::dem_setup_parameters()
 
   // Initialize the total contact list counter
   integrator_object = set_integrator_type();
+
+  // The displacement of the particles for the dynamic contact detection is
+  // updated by the integrator
+  if (this->cfd_dem_simulation_parameters.dem_parameters.model_parameters
+        .contact_detection_method ==
+      Parameters::Lagrangian::ModelParameters::ContactDetectionMethod::dynamic)
+    integrator_object->set_displacement_container(displacement);
   particle_particle_contact_force_object =
     set_particle_particle_contact_force_model(
       this->cfd_dem_simulation_parameters.dem_parameters);
@@ -236,12 +243,10 @@ CFDDEMSolver<dim>::initialize_dem_parameters()
   periodic_boundaries_object.map_periodic_cells(
     *parallel_triangulation, periodic_boundaries_cells_information);
 
-  // Set the periodic offset to contact managers and particles contact forces
-  // for periodic contact detection (if PBC enabled)
+  // Set the periodic offset to the contact manager for periodic contact
+  // detection (if PBC enabled)
   contact_manager.set_periodic_offset(
     periodic_boundaries_object.get_periodic_offset_distance());
-  particle_particle_contact_force_object->set_periodic_offset(
-    periodic_boundaries_object.get_periodic_offset_distance());
 
   // Find cell neighbors
   contact_manager.execute_cell_neighbors_search(
@@ -583,16 +588,10 @@ CFDDEMSolver<dim>::check_contact_detection_method(unsigned int counter)
         }
       case ModelParameters::ContactDetectionMethod::dynamic:
         {
-          double dt =
-            this->simulation_control->get_time_step() /
-            this->cfd_dem_simulation_parameters.cfd_dem.coupling_frequency;
-
-          find_particle_contact_detection_step<dim>(
-            this->particle_handler,
-            dt,
+          find_particle_contact_detection_step(
+            integrator_object->get_maximum_displacement(),
             smallest_contact_search_criterion,
-            this->mpi_communicator,
-            displacement);
+            this->mpi_communicator);
           break;
         }
       default:
@@ -1193,7 +1192,7 @@ CFDDEMSolver<dim>::sort_particles_into_subdomains_and_cells()
     }
 
   // Always reset the displacement values since we are doing a search detection
-  std::fill(displacement.begin(), displacement.end(), 0.);
+  integrator_object->reset_displacement();
 
   this->particle_handler.exchange_ghost_particles(true);
 }
@@ -1212,9 +1211,6 @@ CFDDEMSolver<dim>::dem_iterator(unsigned int counter)
     ->calculate_particle_particle_contact_force(
       contact_manager.get_local_adjacent_particles(),
       contact_manager.get_ghost_adjacent_particles(),
-      contact_manager.get_local_local_periodic_adjacent_particles(),
-      contact_manager.get_local_ghost_periodic_adjacent_particles(),
-      contact_manager.get_ghost_local_periodic_adjacent_particles(),
       dem_time_step,
       torque,
       force);
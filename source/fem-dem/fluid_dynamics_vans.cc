@@ -6,8 +6,32 @@
 
 #include <deal.II/dofs/dof_tools.h>
 
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+
+#include <deal.II/lac/read_write_vector.h>
+#include <deal.II/lac/solver_gmres.h>
+
 #include <deal.II/numerics/vector_tools.h>
 
+namespace
+{
+  /**
+   * @brief Copy the locally owned values of a Trilinos vector, which may hold
+   * ghost values, into a deal.II vector with the same locally owned DoFs.
+   *
+   * @param[in] src Source Trilinos vector.
+   * @param[out] dst Destination deal.II vector.
+   */
+  void
+  copy_locally_owned_values(const GlobalVectorType                     &src,
+                            LinearAlgebra::distributed::Vector<double> &dst)
+  {
+    for (const auto index : dst.locally_owned_elements())
+      dst(index) = src(index);
+  }
+} // namespace
+
 // Constructor for class FluidDynamicsVANS
 template <int dim>
 FluidDynamicsVANS<dim>::FluidDynamicsVANS(
@@ -17,6 +41,10 @@ FluidDynamicsVANS<dim>::FluidDynamicsVANS(
   , void_fraction_dof_handler(*this->triangulation)
   , fe_void_fraction(nsparam.cfd_parameters.fem_parameters.void_fraction_order)
   , particle_mapping(1)
+  , use_matrix_free(nsparam.cfd_parameters.linear_solver
+                      .at(PhysicsID::fluid_dynamics)
+                      .preconditioner ==
+                    Parameters::LinearSolver::PreconditionerType::gcmg)
   , particle_handler(*this->triangulation,
                      particle_mapping,
                      DEM::get_number_properties())
@@ -43,6 +71,57 @@ FluidDynamicsVANS<dim>::FluidDynamicsVANS(
             }
         }
     }
+
+  if (use_matrix_free)
+    {
+      const auto &fem_parameters = nsparam.cfd_parameters.fem_parameters;
+      const auto &linear_solver_parameters =
+        nsparam.cfd_parameters.linear_solver.at(PhysicsID::fluid_dynamics);
+
+      // The void fraction is interpolated with the FE of the pressure, which
+      // requires the same order for all the fields
+      AssertThrow(fem_parameters.velocity_order ==
+                      fem_parameters.pressure_order &&
+                    fem_parameters.velocity_order ==
+                      fem_parameters.void_fraction_order,
+                  ExcMessage("The matrix-free VANS solver requires the same "
+                             "order for the velocity, the pressure and the "
+                             "void fraction."));
+      AssertThrow(!nsparam.cfd_parameters.mesh.simplex,
+                  ExcMessage("The matrix-free VANS solver does not support "
+                             "simplex meshes."));
+      AssertThrow(!nsparam.cfd_parameters.physical_properties_manager
+                     .is_non_newtonian(),
+                  ExcMessage("The matrix-free VANS solver does not support "
+                             "non Newtonian fluids."));
+      AssertThrow(std::abs(nsparam.cfd_parameters.stabilization
+                             .pressure_scaling_factor -
+                           1.) < 1e-8,
+                  ExcMessage("The matrix-free VANS solver does not support "
+                             "pressure scaling."));
+      AssertThrow(!linear_solver_parameters.mg_use_fe_q_iso_q1 &&
+                    linear_solver_parameters.mg_recompute_linearization_level ==
+                      -1,
+                  ExcMessage("The matrix-free VANS solver does not support "
+                             "FE_Q_iso_Q1 levels nor the recomputation of "
+                             "the linearization in the multigrid levels."));
+
+      const auto initial_condition_type =
+        nsparam.cfd_parameters.initial_condition->type;
+      AssertThrow(initial_condition_type !=
+                      Parameters::InitialConditionType::L2projection &&
+                    initial_condition_type !=
+                      Parameters::InitialConditionType::viscous,
+                  ExcMessage("The matrix-free VANS solver does not support "
+                             "initial conditions that require a matrix."));
+
+      // Same FE system as the matrix-free Navier-Stokes solver
+      this->fe = std::make_shared<FESystem<dim>>(
+        FE_Q<dim>(fem_parameters.velocity_order), dim + 1);
+
+      system_operator = std::make_shared<VANSStabilizedOperator<dim, double>>(
+        nsparam.cfd_dem);
+    }
 }
 
 template <int dim>
@@ -50,6 +129,7 @@ FluidDynamicsVANS<dim>::~FluidDynamicsVANS()
 {
   this->dof_handler.clear();
   void_fraction_dof_handler.clear();
+  dof_handler_fe_q_iso_q1.clear();
 }
 
 template <int dim>
@@ -150,6 +230,9 @@ FluidDynamicsVANS<dim>::setup_dofs()
                      this->mpi_communicator);
 
   assemble_mass_matrix_diagonal(mass_matrix);
+
+  if (use_matrix_free)
+    setup_matrix_free();
 }
 
 template <int dim>
@@ -1578,6 +1661,13 @@ template <int dim>
 void
 FluidDynamicsVANS<dim>::assemble_system_matrix()
 {
+  if (use_matrix_free)
+    {
+      update_matrix_free_operator();
+      this->register_system_matrix_assembly();
+      return;
+    }
+
   {
     TimerOutput::Scope t(this->computing_timer, "Assemble matrix");
     this->system_matrix = 0;
@@ -1611,6 +1701,7 @@ FluidDynamicsVANS<dim>::assemble_system_matrix()
                                            this->cell_quadrature->size()));
     this->system_matrix.compress(VectorOperation::add);
   }
+  this->register_system_matrix_assembly();
 }
 
 template <int dim>
@@ -2028,6 +2119,455 @@ FluidDynamicsVANS<dim>::solve()
   this->finish_simulation();
 }
 
+template <int dim>
+void
+FluidDynamicsVANS<dim>::setup_matrix_free()
+{
+  TimerOutput::Scope t(this->computing_timer, "Setup matrix-free operator");
+
+  // The preconditioner refers to the DoFHandler and is created again
+  gmg_preconditioner.reset();
+  system_operator->clear();
+
+  // The operator only evaluates the source term if it is enabled
+  std::shared_ptr<Function<dim>> forcing_function;
+  if (this->simulation_parameters.source_term.enable)
+    forcing_function = this->forcing_function;
+
+  system_operator->reinit(
+    *this->mapping,
+    this->dof_handler,
+    this->zero_constraints,
+    *this->cell_quadrature,
+    forcing_function,
+    this->simulation_parameters.physical_properties_manager
+      .get_kinematic_viscosity_scale(),
+    this->simulation_parameters.stabilization.stabilization,
+    numbers::invalid_unsigned_int,
+    this->simulation_control,
+    this->simulation_parameters.boundary_conditions,
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+      .enable_hessians_jacobian,
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+      .enable_hessians_residual);
+
+  system_operator->initialize_dof_vector(mf_present_solution);
+  system_operator->initialize_dof_vector(mf_stabilization_solution);
+  system_operator->initialize_dof_vector(mf_time_derivative_previous_solutions);
+  system_operator->initialize_dof_vector(mf_void_fraction);
+  system_operator->initialize_dof_vector(mf_drag_coefficient);
+}
+
+template <int dim>
+void
+FluidDynamicsVANS<dim>::update_matrix_free_operator()
+{
+  TimerOutput::Scope t(this->computing_timer, "Evaluate matrix-free operator");
+
+  setup_assemblers();
+
+  // 1. Particle-fluid interactions of each locally owned cell, calculated
+  // with the scratch data of the matrix-based assemblers
+  const unsigned int n_active_cells = this->triangulation->n_active_cells();
+  cell_drag_coefficient.assign(n_active_cells, 0.);
+  cell_particle_velocity.assign(n_active_cells, Tensor<1, dim>());
+  cell_undisturbed_flow_force.assign(n_active_cells, Tensor<1, dim>());
+
+  auto scratch_data = NavierStokesScratchData<dim>(
+    this->simulation_control,
+    this->simulation_parameters.physical_properties_manager,
+    *this->fe,
+    *this->cell_quadrature,
+    *this->mapping,
+    *this->face_quadrature);
+
+  scratch_data.enable_void_fraction(fe_void_fraction,
+                                    *this->cell_quadrature,
+                                    *this->mapping);
+
+  scratch_data.enable_particle_fluid_interactions(
+    particle_handler.n_global_max_particles_per_cell(),
+    this->cfd_dem_simulation_parameters.cfd_dem.interpolated_void_fraction);
+
+  // The void fraction is stored in the pressure component and the nodal drag
+  // coefficient, averaged over the neighboring cells, in the first velocity
+  // component. The void fraction and the fluid dynamics FEs have the same
+  // order, so the base index of a DoF matches the void fraction DoF.
+  const unsigned int dofs_per_cell = this->fe->n_dofs_per_cell();
+  std::vector<types::global_dof_index> dof_indices(dofs_per_cell);
+  std::vector<types::global_dof_index> void_fraction_dof_indices(
+    fe_void_fraction.n_dofs_per_cell());
+
+  MFVectorType drag_coefficient_count;
+  system_operator->initialize_dof_vector(drag_coefficient_count);
+  mf_void_fraction    = 0;
+  mf_drag_coefficient = 0;
+
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (!cell->is_locally_owned())
+        continue;
+
+      scratch_data.reinit(
+        cell,
+        this->evaluation_point,
+        this->previous_solutions,
+        this->forcing_function,
+        this->flow_control.get_beta(),
+        this->simulation_parameters.stabilization.pressure_scaling_factor);
+
+      typename DoFHandler<dim>::active_cell_iterator void_fraction_cell(
+        &(*(this->triangulation)),
+        cell->level(),
+        cell->index(),
+        &this->void_fraction_dof_handler);
+
+      scratch_data.reinit_void_fraction(void_fraction_cell,
+                                        nodal_void_fraction_relevant,
+                                        previous_void_fraction);
+
+      scratch_data.reinit_particle_fluid_interactions(
+        cell,
+        this->evaluation_point,
+        this->previous_solutions[0],
+        nodal_void_fraction_relevant,
+        particle_handler,
+        this->dof_handler,
+        void_fraction_dof_handler);
+
+      scratch_data.calculate_physical_properties();
+
+      for (auto &pf_assembler : particle_fluid_assemblers)
+        pf_assembler->calculate_particle_fluid_interactions(scratch_data);
+
+      // The drag coefficient is only calculated if the drag force is enabled
+      const unsigned int index = cell->active_cell_index();
+      if (this->cfd_dem_simulation_parameters.cfd_dem.drag_force)
+        cell_drag_coefficient[index] = scratch_data.beta_drag;
+      cell_particle_velocity[index] = scratch_data.average_particle_velocity;
+      cell_undisturbed_flow_force[index] = scratch_data.undisturbed_flow_force;
+
+      cell->get_dof_indices(dof_indices);
+      void_fraction_cell->get_dof_indices(void_fraction_dof_indices);
+
+      for (unsigned int i = 0; i < dofs_per_cell; ++i)
+        {
+          const auto [component, base_index] =
+            this->fe->system_to_component_index(i);
+
+          if (component == dim &&
+              this->locally_owned_dofs.is_element(dof_indices[i]))
+            mf_void_fraction(dof_indices[i]) =
+              nodal_void_fraction_relevant(
+                void_fraction_dof_indices[base_index]);
+          else if (component == 0)
+            {
+              mf_drag_coefficient(dof_indices[i]) +=
+                cell_drag_coefficient[index];
+              drag_coefficient_count(dof_indices[i]) += 1.;
+            }
+        }
+    }
+
+  mf_drag_coefficient.compress(VectorOperation::add);
+  drag_coefficient_count.compress(VectorOperation::add);
+
+  for (const auto index : this->locally_owned_dofs)
+    if (drag_coefficient_count(index) > 0.)
+      mf_drag_coefficient(index) /= drag_coefficient_count(index);
+
+  mf_drag_coefficient.update_ghost_values();
+
+  system_operator->set_particle_fluid_interactions(
+    cell_drag_coefficient, cell_particle_velocity, cell_undisturbed_flow_force);
+
+  // 2. Void fraction
+  mf_void_fraction.update_ghost_values();
+  system_operator->evaluate_void_fraction(mf_void_fraction);
+
+  // 3. Linearization point
+  copy_locally_owned_values(this->evaluation_point, mf_present_solution);
+  mf_present_solution.update_ghost_values();
+  system_operator->evaluate_non_linear_term_and_calculate_tau(
+    mf_present_solution);
+
+  // 4. Stabilization parameters, with the same velocity as the matrix-based
+  // VANS assemblers
+  const bool implicit_stabilization =
+    this->cfd_dem_simulation_parameters.cfd_dem.implicit_stabilization ||
+    this->simulation_control->get_current_time() ==
+      this->simulation_control->get_time_step();
+
+  copy_locally_owned_values(implicit_stabilization ?
+                              this->evaluation_point :
+                              this->previous_solutions[0],
+                            mf_stabilization_solution);
+  mf_stabilization_solution.update_ghost_values();
+  system_operator->evaluate_stabilization_parameters(
+    mf_stabilization_solution);
+
+  // 5. Time derivatives of the previous solutions
+  const auto method = this->simulation_control->get_assembly_method();
+  if (is_bdf(method))
+    {
+      const Vector<double> &bdf_coefs =
+        this->simulation_control->get_bdf_coefficients();
+
+      MFVectorType previous_solution;
+      system_operator->initialize_dof_vector(previous_solution);
+
+      mf_time_derivative_previous_solutions = 0;
+      for (unsigned int p = 0; p < number_of_previous_solutions(method); ++p)
+        {
+          copy_locally_owned_values(this->previous_solutions[p],
+                                    previous_solution);
+          mf_time_derivative_previous_solutions.add(bdf_coefs[p + 1],
+                                                    previous_solution);
+        }
+
+      mf_time_derivative_previous_solutions.update_ghost_values();
+      system_operator->evaluate_time_derivative_previous_solutions(
+        mf_time_derivative_previous_solutions);
+
+      if (this->simulation_parameters.flow_control.enable_flow_control)
+        system_operator->update_beta_force(this->flow_control.get_beta());
+    }
+}
+
+template <int dim>
+void
+FluidDynamicsVANS<dim>::setup_preconditioner()
+{
+  if (use_matrix_free)
+    setup_GMG();
+  else
+    FluidDynamicsMatrixBased<dim>::setup_preconditioner();
+}
+
+template <int dim>
+void
+FluidDynamicsVANS<dim>::setup_GMG()
+{
+  TimerOutput::Scope t(this->computing_timer, "Setup GMG");
+
+  const bool mg_use_single_precision =
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+      .mg_use_single_precision;
+
+  if (!gmg_preconditioner)
+    {
+      // The operator only evaluates the source term if it is enabled
+      std::shared_ptr<Function<dim>> forcing_function;
+      if (this->simulation_parameters.source_term.enable)
+        forcing_function = this->forcing_function;
+
+      const Parameters::CFDDEM cfd_dem =
+        this->cfd_dem_simulation_parameters.cfd_dem;
+
+      if (mg_use_single_precision)
+        gmg_preconditioner =
+          std::make_shared<MFNavierStokesPreconditionGMG<dim, float>>(
+            this->simulation_parameters,
+            this->dof_handler,
+            dof_handler_fe_q_iso_q1,
+            this->mapping,
+            this->cell_quadrature,
+            forcing_function,
+            this->simulation_control,
+            this->fe,
+            [cfd_dem]() {
+              return std::make_shared<VANSStabilizedOperator<dim, float>>(
+                cfd_dem);
+            });
+      else
+        gmg_preconditioner =
+          std::make_shared<MFNavierStokesPreconditionGMG<dim, double>>(
+            this->simulation_parameters,
+            this->dof_handler,
+            dof_handler_fe_q_iso_q1,
+            this->mapping,
+            this->cell_quadrature,
+            forcing_function,
+            this->simulation_control,
+            this->fe,
+            [cfd_dem]() {
+              return std::make_shared<VANSStabilizedOperator<dim, double>>(
+                cfd_dem);
+            });
+    }
+
+  // The VANS coefficients are provided before the initialization, which
+  // computes the diagonals of the level operators for the smoothers
+  if (mg_use_single_precision)
+    update_level_coefficients<float>();
+  else
+    update_level_coefficients<double>();
+
+  gmg_preconditioner->initialize(this->simulation_control,
+                                 this->flow_control,
+                                 mf_present_solution,
+                                 mf_time_derivative_previous_solutions);
+}
+
+template <int dim>
+template <typename MGNumber>
+void
+FluidDynamicsVANS<dim>::update_level_coefficients()
+{
+  using MGVectorType = LinearAlgebra::distributed::Vector<MGNumber>;
+
+  const auto gmg =
+    std::dynamic_pointer_cast<MFNavierStokesPreconditionGMG<dim, MGNumber>>(
+      gmg_preconditioner);
+  Assert(gmg, ExcInternalError());
+
+  MGLevelObject<MGVectorType> mg_void_fraction;
+  MGLevelObject<MGVectorType> mg_stabilization_solution;
+  MGLevelObject<MGVectorType> mg_drag_coefficient;
+
+  gmg->interpolate_to_levels(mf_void_fraction, mg_void_fraction);
+  gmg->interpolate_to_levels(mf_stabilization_solution,
+                             mg_stabilization_solution);
+  gmg->interpolate_to_levels(mf_drag_coefficient, mg_drag_coefficient);
+
+  const auto &mg_operators = gmg->get_mg_operators();
+
+  for (unsigned int level = mg_operators.min_level();
+       level <= mg_operators.max_level();
+       ++level)
+    {
+      const auto level_operator =
+        std::dynamic_pointer_cast<VANSStabilizedOperator<dim, MGNumber>>(
+          mg_operators[level]);
+      Assert(level_operator, ExcInternalError());
+
+      mg_void_fraction[level].update_ghost_values();
+      level_operator->evaluate_void_fraction(mg_void_fraction[level]);
+
+      mg_stabilization_solution[level].update_ghost_values();
+      level_operator->evaluate_stabilization_parameters(
+        mg_stabilization_solution[level]);
+
+      // The finest level shares the active cells of the particles, the
+      // coarser levels use the averaged nodal drag coefficient
+      if (level == mg_operators.max_level())
+        level_operator->set_particle_fluid_interactions(
+          cell_drag_coefficient,
+          cell_particle_velocity,
+          cell_undisturbed_flow_force);
+      else
+        {
+          mg_drag_coefficient[level].update_ghost_values();
+          level_operator->evaluate_drag_coefficient(
+            mg_drag_coefficient[level]);
+        }
+    }
+}
+
+template <int dim>
+void
+FluidDynamicsVANS<dim>::solve_linear_system(const bool initial_step,
+                                            const bool renewed_matrix)
+{
+  if (!use_matrix_free)
+    {
+      FluidDynamicsMatrixBased<dim>::solve_linear_system(initial_step,
+                                                         renewed_matrix);
+      return;
+    }
+
+  AssertThrow(
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+        .solver == Parameters::LinearSolver::SolverType::gmres,
+    ExcMessage("The matrix-free VANS solver only supports the GMRES linear "
+               "solver."));
+
+  solve_system_matrix_free(initial_step);
+}
+
+template <int dim>
+void
+FluidDynamicsVANS<dim>::solve_system_matrix_free(const bool initial_step)
+{
+  const auto &linear_solver_parameters =
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics);
+
+  const AffineConstraints<double> &constraints_used =
+    initial_step ? this->nonzero_constraints : this->zero_constraints;
+
+  const double linear_solver_tolerance =
+    std::max(linear_solver_parameters.relative_residual *
+               this->system_rhs.l2_norm(),
+             linear_solver_parameters.minimum_residual);
+
+  if (linear_solver_parameters.verbosity != Parameters::Verbosity::quiet)
+    {
+      this->pcout << "  -Tolerance of iterative solver is : "
+                  << linear_solver_tolerance << std::endl;
+    }
+
+  // The right-hand side assembled in the global vector is copied into a
+  // vector compatible with the matrix-free operator
+  MFVectorType rhs;
+  MFVectorType solution;
+  system_operator->initialize_dof_vector(rhs);
+  system_operator->initialize_dof_vector(solution);
+
+  {
+    LinearAlgebra::ReadWriteVector<double> rwv(rhs.locally_owned_elements());
+    rwv.import_elements(this->system_rhs, VectorOperation::insert);
+    rhs.import_elements(rwv, VectorOperation::insert);
+  }
+
+  SolverControl solver_control(linear_solver_parameters.max_iterations,
+                               linear_solver_tolerance,
+                               true,
+                               true);
+
+  typename SolverGMRES<MFVectorType>::AdditionalData solver_parameters;
+  solver_parameters.max_n_tmp_vectors =
+    linear_solver_parameters.max_krylov_vectors;
+  solver_parameters.right_preconditioning = true;
+
+  SolverGMRES<MFVectorType> solver(solver_control, solver_parameters);
+
+  {
+    TimerOutput::Scope t(this->computing_timer, "Solve linear system");
+
+    solver.solve(*system_operator, solution, rhs, *gmg_preconditioner);
+  }
+
+  gmg_preconditioner->monitor_outer_iterations(solver_control.last_step());
+
+  if (linear_solver_parameters.mg_verbosity != Parameters::Verbosity::quiet)
+    gmg_preconditioner->print_relevant_info();
+
+  if (linear_solver_parameters.verbosity != Parameters::Verbosity::quiet)
+    {
+      this->pcout << "  -Iterative solver took : " << solver_control.last_step()
+                  << " steps to reach a residual norm of "
+                  << solver_control.last_value() << std::endl;
+    }
+
+  GlobalVectorType completely_distributed_solution(this->locally_owned_dofs,
+                                                   this->mpi_communicator);
+  {
+    LinearAlgebra::ReadWriteVector<double> rwv(this->locally_owned_dofs);
+    rwv.import_elements(solution, VectorOperation::insert);
+    completely_distributed_solution.import_elements(rwv,
+                                                    VectorOperation::insert);
+  }
+
+  {
+    TimerOutput::Scope t(this->computing_timer,
+                         "Distribute constraints after linear solve");
+
+    constraints_used.distribute(completely_distributed_solution);
+  }
+
+  this->newton_update = completely_distributed_solution;
+}
+
 // Pre-compile the 2D and 3D Navier-Stokes solver to ensure that the
 // library is valid before we actually compile the solver This greatly
 // helps with debugging
@@ -0,0 +1,555 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------*/
+
+#include <core/bdf.h>
+
+#include <fem-dem/vans_matrix_free_operators.h>
+
+template <int dim, typename number>
+VANSStabilizedOperator<dim, number>::VANSStabilizedOperator(
+  const Parameters::CFDDEM &cfd_dem)
+  : cfd_dem(cfd_dem)
+{}
+
+template <int dim, typename number>
+void
+VANSStabilizedOperator<dim, number>::evaluate_void_fraction(
+  const VectorType &void_fraction_solution)
+{
+  // The void fraction is only stored at the quadrature points
+  AssertThrow(!this->recompute_linearization,
+              ExcMessage("The matrix-free VANS operator does not support the "
+                         "recomputation of the linearization on the fly."));
+
+  this->timer.enter_subsection("operator::evaluate_void_fraction");
+
+  const unsigned int n_cells = this->matrix_free.n_cell_batches();
+  FECellIntegrator   integrator(this->matrix_free);
+
+  void_fraction.reinit(n_cells, integrator.n_q_points);
+  void_fraction_gradient.reinit(n_cells, integrator.n_q_points);
+
+  for (unsigned int cell = 0; cell < n_cells; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values_plain(void_fraction_solution);
+      integrator.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+
+      // The void fraction is stored in the pressure component
+      for (const auto q : integrator.quadrature_point_indices())
+        {
+          void_fraction(cell, q)          = integrator.get_value(q)[dim];
+          void_fraction_gradient(cell, q) = integrator.get_gradient(q)[dim];
+        }
+    }
+
+  this->timer.leave_subsection("operator::evaluate_void_fraction");
+}
+
+template <int dim, typename number>
+void
+VANSStabilizedOperator<dim, number>::evaluate_stabilization_parameters(
+  const VectorType &stabilization_solution)
+{
+  this->timer.enter_subsection("operator::evaluate_stabilization_parameters");
+
+  const unsigned int n_cells = this->matrix_free.n_cell_batches();
+  FECellIntegrator   integrator(this->matrix_free);
+
+  vans_stabilization_parameter.reinit(n_cells, integrator.n_q_points);
+  grad_div_parameter.reinit(n_cells, integrator.n_q_points);
+
+  // Define 1/dt if the simulation is transient
+  double sdt = 0.0;
+  if (is_bdf(this->simulation_control->get_assembly_method()))
+    sdt = 1. / this->simulation_control->get_time_steps_vector()[0];
+
+  for (unsigned int cell = 0; cell < n_cells; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values_plain(stabilization_solution);
+      integrator.evaluate(EvaluationFlags::values);
+
+      const auto h = integrator.read_cell_data(this->element_size);
+
+      for (const auto q : integrator.quadrature_point_indices())
+        {
+          const auto value = integrator.get_value(q);
+
+          VectorizedArray<number> u_mag_squared = 0.;
+          for (unsigned int k = 0; k < dim; ++k)
+            u_mag_squared += Utilities::fixed_power<2>(value[k]);
+
+          const VectorizedArray<number> u_mag =
+            std::max(std::sqrt(u_mag_squared), VectorizedArray<number>(1e-12));
+
+          vans_stabilization_parameter(cell, q) =
+            1. / std::sqrt(Utilities::fixed_power<2>(sdt) +
+                           Utilities::fixed_power<2>(2. * u_mag / h) +
+                           9. * Utilities::fixed_power<2>(
+                                  4. * this->kinematic_viscosity / (h * h)));
+
+          // Same weight as the one of the matrix-based VANS assemblers
+          grad_div_parameter(cell, q) =
+            this->kinematic_viscosity + cfd_dem.cstar * u_mag;
+        }
+    }
+
+  this->timer.leave_subsection("operator::evaluate_stabilization_parameters");
+}
+
+template <int dim, typename number>
+void
+VANSStabilizedOperator<dim, number>::evaluate_drag_coefficient(
+  const VectorType &drag_coefficient_solution)
+{
+  reset_particle_fluid_interactions();
+
+  const unsigned int n_cells = this->matrix_free.n_cell_batches();
+  FECellIntegrator   integrator(this->matrix_free);
+
+  for (unsigned int cell = 0; cell < n_cells; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values_plain(drag_coefficient_solution);
+      integrator.evaluate(EvaluationFlags::values);
+
+      for (const auto q : integrator.quadrature_point_indices())
+        drag_coefficient[cell] += integrator.get_value(q)[0];
+
+      drag_coefficient[cell] /= static_cast<number>(integrator.n_q_points);
+    }
+}
+
+template <int dim, typename number>
+void
+VANSStabilizedOperator<dim, number>::set_particle_fluid_interactions(
+  const std::vector<double>         &beta_drag,
+  const std::vector<Tensor<1, dim>> &average_particle_velocity,
+  const std::vector<Tensor<1, dim>> &undisturbed_force)
+{
+  reset_particle_fluid_interactions();
+
+  const unsigned int n_cells = this->matrix_free.n_cell_batches();
+
+  for (unsigned int cell = 0; cell < n_cells; ++cell)
+    {
+      for (auto lane = 0u;
+           lane < this->matrix_free.n_active_entries_per_cell_batch(cell);
+           ++lane)
+        {
+          const unsigned int index =
+            this->matrix_free.get_cell_iterator(cell, lane)
+              ->active_cell_index();
+
+          AssertIndexRange(index, beta_drag.size());
+
+          drag_coefficient[cell][lane] = beta_drag[index];
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              particle_velocity[cell][d][lane] =
+                average_particle_velocity[index][d];
+              undisturbed_flow_force[cell][d][lane] =
+                undisturbed_force[index][d];
+            }
+        }
+    }
+}
+
+template <int dim, typename number>
+void
+VANSStabilizedOperator<dim, number>::reset_particle_fluid_interactions()
+{
+  const unsigned int n_cells = this->matrix_free.n_cell_batches();
+
+  drag_coefficient.clear();
+  particle_velocity.clear();
+  undisturbed_flow_force.clear();
+
+  drag_coefficient.resize(n_cells, VectorizedArray<number>(0.));
+  particle_velocity.resize(n_cells, Tensor<1, dim, VectorizedArray<number>>());
+  undisturbed_flow_force.resize(n_cells,
+                                Tensor<1, dim, VectorizedArray<number>>());
+}
+
+/**
+ * The expressions calculated in this cell integral are, with ε the void
+ * fraction, β the drag coefficient and ε_m equal to ε for the model A and
+ * to 1 for the model B:
+ * (q,ε∇·δu + δu·∇ε) + (v,ε∂t δu) + (v,ε(u·∇)δu + ε(δu·∇)u) + (v,βδu)
+ * \+ εν(∇v,∇δu) + ν(v,∇δu·∇ε) - (∇·v,εδp) - (v,δp∇ε) (Model A)
+ * \+ ν(∇v,∇δu) - (∇·v,δp) (Model B),
+ * plus the SUPG-PSPG stabilization terms:
+ * \+ (ε∂t δu + ε(u·∇)δu + ε(δu·∇)u + βδu + ε_m∇δp - ε_mν∆δu)τ·∇q (PSPG)
+ * \+ (ε∂t δu + ε(u·∇)δu + ε(δu·∇)u + βδu + ε_m∇δp - ε_mν∆δu)τu·∇v (SUPG 1)
+ * \+ (R_VANS)τδu·∇v (SUPG 2),
+ * and the optional grad-div stabilization:
+ * \+ (ε∇·δu + δu·∇ε)γ(∇·v) (grad-div).
+ */
+template <int dim, typename number>
+void
+VANSStabilizedOperator<dim, number>::do_cell_integral_local(
+  FECellIntegrator &integrator) const
+{
+  if (this->enable_hessians_jacobian)
+    integrator.evaluate(EvaluationFlags::values | EvaluationFlags::gradients |
+                        EvaluationFlags::hessians);
+  else
+    integrator.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+
+  const unsigned int cell = integrator.get_current_cell_index();
+
+  // To identify whether the problem is transient or steady
+  const bool transient =
+    is_bdf(this->simulation_control->get_assembly_method());
+
+  // Vector for BDF coefficients
+  const Vector<double> *bdf_coefs;
+  if (transient)
+    bdf_coefs = &this->simulation_control->get_bdf_coefficients();
+
+  const bool model_a = cfd_dem.vans_model == Parameters::VANSModel::modelA;
+
+  // Particle-fluid interactions of the cell batch
+  const auto beta            = drag_coefficient[cell];
+  const auto particles_speed = particle_velocity[cell];
+  const auto flow_force      = undisturbed_flow_force[cell];
+
+  for (const auto q : integrator.quadrature_point_indices())
+    {
+      Tensor<1, dim, VectorizedArray<number>> source_value;
+
+      // Evaluate source term function if enabled
+      if (this->forcing_function)
+        source_value = this->forcing_terms(cell, q);
+
+      // Add to source term the dynamic flow control force (zero if not
+      // enabled)
+      source_value += this->beta_force;
+
+      // Gather the original value/gradient
+      typename FECellIntegrator::value_type    value = integrator.get_value(q);
+      typename FECellIntegrator::gradient_type gradient =
+        integrator.get_gradient(q);
+      typename FECellIntegrator::gradient_type hessian_diagonal;
+
+      if (this->enable_hessians_jacobian)
+        hessian_diagonal = integrator.get_hessian_diagonal(q);
+
+      // Result value/gradient we will use
+      typename FECellIntegrator::value_type    value_result;
+      typename FECellIntegrator::gradient_type gradient_result;
+
+      // Gather previous values of the velocity and the pressure
+      const auto &previous_values = this->nonlinear_previous_values(cell, q);
+      const auto &previous_gradient =
+        this->nonlinear_previous_gradient(cell, q);
+      const auto &previous_hessian_diagonal =
+        this->nonlinear_previous_hessian_diagonal(cell, q);
+
+      Tensor<1, dim + 1, VectorizedArray<number>> previous_time_derivatives;
+      if (transient)
+        previous_time_derivatives =
+          this->time_derivatives_previous_solutions(cell, q);
+
+      // Void fraction and stabilization parameters
+      const auto eps      = void_fraction(cell, q);
+      const auto grad_eps = void_fraction_gradient(cell, q);
+      const auto eps_m    = model_a ? eps : VectorizedArray<number>(1.);
+      const auto tau      = vans_stabilization_parameter(cell, q);
+
+      // Strong Jacobian and strong residual of the momentum equation
+      Tensor<1, dim, VectorizedArray<number>> strong_jacobian;
+      Tensor<1, dim, VectorizedArray<number>> strong_residual;
+
+      for (unsigned int i = 0; i < dim; ++i)
+        {
+          strong_jacobian[i] = eps_m * gradient[dim][i] + beta * value[i];
+          strong_residual[i] =
+            eps_m * previous_gradient[dim][i] - eps * source_value[i] +
+            beta * (previous_values[i] - particles_speed[i]);
+
+          if (!model_a)
+            strong_residual[i] += flow_force[i];
+
+          for (unsigned int k = 0; k < dim; ++k)
+            {
+              strong_jacobian[i] +=
+                eps * (gradient[i][k] * previous_values[k] +
+                       previous_gradient[i][k] * value[k]) -
+                eps_m * this->kinematic_viscosity * hessian_diagonal[i][k];
+              strong_residual[i] +=
+                eps * previous_gradient[i][k] * previous_values[k] -
+                eps_m * this->kinematic_viscosity *
+                  previous_hessian_diagonal[i][k];
+            }
+
+          if (transient)
+            {
+              strong_jacobian[i] += eps * (*bdf_coefs)[0] * value[i];
+              strong_residual[i] +=
+                eps * ((*bdf_coefs)[0] * previous_values[i] +
+                       previous_time_derivatives[i]);
+            }
+        }
+
+      // Weak form Jacobian
+      for (unsigned int i = 0; i < dim; ++i)
+        {
+          if (model_a)
+            {
+              // εν(∇v,∇δu) - (∇·v,εδp)
+              gradient_result[i] =
+                eps * this->kinematic_viscosity * gradient[i];
+              gradient_result[i][i] += -eps * value[dim];
+              // +ν(v,∇δu·∇ε) - (v,δp∇ε)
+              value_result[i] +=
+                this->kinematic_viscosity * (gradient[i] * grad_eps) -
+                value[dim] * grad_eps[i];
+            }
+          else
+            {
+              // ν(∇v,∇δu) - (∇·v,δp)
+              gradient_result[i] = this->kinematic_viscosity * gradient[i];
+              gradient_result[i][i] += -value[dim];
+            }
+
+          // +(q,ε∇·δu + δu·∇ε)
+          value_result[dim] += eps * gradient[i][i] + value[i] * grad_eps[i];
+
+          for (unsigned int k = 0; k < dim; ++k)
+            {
+              // +(v,ε(u·∇)δu + ε(δu·∇)u)
+              value_result[i] += eps * (gradient[i][k] * previous_values[k] +
+                                        previous_gradient[i][k] * value[k]);
+            }
+
+          // +(v,βδu)
+          value_result[i] += beta * value[i];
+
+          // +(v,ε∂t δu)
+          if (transient)
+            value_result[i] += eps * (*bdf_coefs)[0] * value[i];
+        }
+
+      // PSPG and SUPG Jacobian
+      for (unsigned int i = 0; i < dim; ++i)
+        {
+          gradient_result[dim][i] += tau * strong_jacobian[i];
+
+          for (unsigned int k = 0; k < dim; ++k)
+            gradient_result[i][k] += tau * (strong_jacobian[i] *
+                                              previous_values[k] +
+                                            strong_residual[i] * value[k]);
+        }
+
+      // Grad-div Jacobian
+      if (cfd_dem.grad_div)
+        {
+          VectorizedArray<number> divergence = 0.;
+          for (unsigned int k = 0; k < dim; ++k)
+            divergence += eps * gradient[k][k] + value[k] * grad_eps[k];
+
+          for (unsigned int i = 0; i < dim; ++i)
+            gradient_result[i][i] += grad_div_parameter(cell, q) * divergence;
+        }
+
+      integrator.submit_gradient(gradient_result, q);
+      integrator.submit_value(value_result, q);
+    }
+
+  integrator.integrate(EvaluationFlags::values | EvaluationFlags::gradients);
+}
+
+/**
+ * The expressions calculated in this cell integral are the ones of the
+ * Jacobian, evaluated with the solution instead of the increment, minus
+ * the source term (v,εf) and with the drag force (v,β(u-u_p)), plus the
+ * undisturbed flow force for the model B. The time derivative of the void
+ * fraction is not included.
+ */
+template <int dim, typename number>
+void
+VANSStabilizedOperator<dim, number>::local_evaluate_residual(
+  const MatrixFree<dim, number>               &matrix_free,
+  VectorType                                  &dst,
+  const VectorType                            &src,
+  const std::pair<unsigned int, unsigned int> &range) const
+{
+  FECellIntegrator integrator(matrix_free);
+
+  // To identify whether the problem is transient or steady
+  const bool transient =
+    is_bdf(this->simulation_control->get_assembly_method());
+
+  // Vector for BDF coefficients
+  const Vector<double> *bdf_coefs;
+  if (transient)
+    bdf_coefs = &this->simulation_control->get_bdf_coefficients();
+
+  const bool model_a = cfd_dem.vans_model == Parameters::VANSModel::modelA;
+
+  for (unsigned int cell = range.first; cell < range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.read_dof_values_plain(src);
+
+      if (this->enable_hessians_residual)
+        integrator.evaluate(EvaluationFlags::values |
+                            EvaluationFlags::gradients |
+                            EvaluationFlags::hessians);
+      else
+        integrator.evaluate(EvaluationFlags::values |
+                            EvaluationFlags::gradients);
+
+      // Particle-fluid interactions of the cell batch
+      const auto beta            = drag_coefficient[cell];
+      const auto particles_speed = particle_velocity[cell];
+      const auto flow_force      = undisturbed_flow_force[cell];
+
+      for (const auto q : integrator.quadrature_point_indices())
+        {
+          Tensor<1, dim, VectorizedArray<number>> source_value;
+
+          // Evaluate source term function if enabled
+          if (this->forcing_function)
+            source_value = this->forcing_terms(cell, q);
+
+          // Add to source term the dynamic flow control force (zero if not
+          // enabled)
+          source_value += this->beta_force;
+
+          // Gather the original value/gradient
+          typename FECellIntegrator::value_type value = integrator.get_value(q);
+          typename FECellIntegrator::gradient_type gradient =
+            integrator.get_gradient(q);
+          typename FECellIntegrator::gradient_type hessian_diagonal;
+
+          if (this->enable_hessians_residual)
+            hessian_diagonal = integrator.get_hessian_diagonal(q);
+
+          // Time derivatives of previous solutions
+          Tensor<1, dim + 1, VectorizedArray<number>> previous_time_derivatives;
+          if (transient)
+            previous_time_derivatives =
+              this->time_derivatives_previous_solutions(cell, q);
+
+          // Void fraction and stabilization parameters
+          const auto eps      = void_fraction(cell, q);
+          const auto grad_eps = void_fraction_gradient(cell, q);
+          const auto eps_m    = model_a ? eps : VectorizedArray<number>(1.);
+          const auto tau      = vans_stabilization_parameter(cell, q);
+
+          // Result value/gradient we will use
+          typename FECellIntegrator::value_type    value_result;
+          typename FECellIntegrator::gradient_type gradient_result;
+
+          // Strong residual of the momentum equation
+          Tensor<1, dim, VectorizedArray<number>> strong_residual;
+
+          for (unsigned int i = 0; i < dim; ++i)
+            {
+              // Drag force and undisturbed flow force
+              VectorizedArray<number> particle_force =
+                beta * (value[i] - particles_speed[i]);
+              if (!model_a)
+                particle_force += flow_force[i];
+
+              strong_residual[i] = eps_m * gradient[dim][i] -
+                                   eps * source_value[i] + particle_force;
+
+              for (unsigned int k = 0; k < dim; ++k)
+                strong_residual[i] +=
+                  eps * gradient[i][k] * value[k] -
+                  eps_m * this->kinematic_viscosity * hessian_diagonal[i][k];
+
+              if (transient)
+                strong_residual[i] +=
+                  eps * ((*bdf_coefs)[0] * value[i] +
+                         previous_time_derivatives[i]);
+
+              // Weak form
+              if (model_a)
+                {
+                  // εν(∇v,∇u) - (∇·v,εp)
+                  gradient_result[i] =
+                    eps * this->kinematic_viscosity * gradient[i];
+                  gradient_result[i][i] += -eps * value[dim];
+                  // +ν(v,∇u·∇ε) - (v,p∇ε)
+                  value_result[i] +=
+                    this->kinematic_viscosity * (gradient[i] * grad_eps) -
+                    value[dim] * grad_eps[i];
+                }
+              else
+                {
+                  // ν(∇v,∇u) - (∇·v,p)
+                  gradient_result[i] = this->kinematic_viscosity * gradient[i];
+                  gradient_result[i][i] += -value[dim];
+                }
+
+              // +(v,-εf) + (v,β(u-u_p))
+              value_result[i] += -eps * source_value[i] + particle_force;
+
+              // +(v,ε∂t u)
+              if (transient)
+                value_result[i] += eps * ((*bdf_coefs)[0] * value[i] +
+                                          previous_time_derivatives[i]);
+
+              // +(q,ε∇·u + u·∇ε)
+              value_result[dim] +=
+                eps * gradient[i][i] + value[i] * grad_eps[i];
+
+              for (unsigned int k = 0; k < dim; ++k)
+                {
+                  // +(v,ε(u·∇)u)
+                  value_result[i] += eps * gradient[i][k] * value[k];
+                }
+            }
+
+          // PSPG and SUPG terms
+          for (unsigned int i = 0; i < dim; ++i)
+            {
+              gradient_result[dim][i] += tau * strong_residual[i];
+
+              for (unsigned int k = 0; k < dim; ++k)
+                gradient_result[i][k] += tau * strong_residual[i] * value[k];
+            }
+
+          // Grad-div term
+          if (cfd_dem.grad_div)
+            {
+              VectorizedArray<number> divergence = 0.;
+              for (unsigned int k = 0; k < dim; ++k)
+                divergence += eps * gradient[k][k] + value[k] * grad_eps[k];
+
+              for (unsigned int i = 0; i < dim; ++i)
+                gradient_result[i][i] +=
+                  grad_div_parameter(cell, q) * divergence;
+            }
+
+          integrator.submit_gradient(gradient_result, q);
+          integrator.submit_value(value_result, q);
+        }
+
+      integrator.integrate_scatter(EvaluationFlags::values |
+                                     EvaluationFlags::gradients,
+                                   dst);
+    }
+}
+
+template class VANSStabilizedOperator<2, double>;
+template class VANSStabilizedOperator<3, double>;
+template class VANSStabilizedOperator<2, float>;
+template class VANSStabilizedOperator<3, float>;
@@ -0,0 +1,676 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------*/
+
+#include <core/time_integration_utilities.h>
+#include <core/utilities.h>
+
+#include <solvers/advection_diffusion_matrix_free_operators.h>
+
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_values.h>
+
+#include <deal.II/lac/sparsity_tools.h>
+
+template <int dim, typename number>
+AdvectionDiffusionOperator<dim, number>::AdvectionDiffusionOperator()
+  : fe_degree(1)
+  , transport_coefficient(1.0)
+  , diffusivity(0.0)
+  , enable_ggls(false)
+  , enable_advection(false)
+  , enable_compressibility(false)
+  , enable_dcdd(false)
+{}
+
+template <int dim, typename number>
+void
+AdvectionDiffusionOperator<dim, number>::reinit(
+  const Mapping<dim>                       &mapping,
+  const DoFHandler<dim>                    &dof_handler,
+  const AffineConstraints<number>          &constraints,
+  const Quadrature<dim>                    &quadrature,
+  const double                              transport_coefficient,
+  const double                              diffusivity,
+  const bool                                enable_ggls,
+  const std::shared_ptr<SimulationControl> &simulation_control)
+{
+  this->system_matrix.clear();
+  this->constraints.copy_from(constraints);
+
+  typename MatrixFree<dim, number>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    (update_values | update_gradients | update_JxW_values |
+     update_quadrature_points | update_hessians);
+
+  matrix_free.reinit(
+    mapping, dof_handler, this->constraints, quadrature, additional_data);
+
+  this->fe_degree             = dof_handler.get_fe().degree;
+  this->transport_coefficient = transport_coefficient;
+  this->diffusivity           = diffusivity;
+  this->enable_ggls           = enable_ggls;
+  this->simulation_control    = simulation_control;
+
+  // The velocity is only available once it has been evaluated
+  this->enable_advection       = false;
+  this->enable_compressibility = false;
+  this->enable_dcdd            = false;
+  velocity.reinit(0, 0);
+  stabilization_parameter.reinit(0, 0);
+  velocity_divergence.reinit(0, 0);
+  dcdd_dissipation.reinit(0, 0);
+
+  this->compute_element_size();
+
+  constrained_indices.clear();
+  for (auto i : this->matrix_free.get_constrained_dofs())
+    constrained_indices.push_back(i);
+}
+
+template <int dim, typename number>
+template <typename FluidVectorType>
+void
+AdvectionDiffusionOperator<dim, number>::evaluate_velocity_and_calculate_tau(
+  const Mapping<dim>    &mapping,
+  const DoFHandler<dim> &fluid_dof_handler,
+  const FluidVectorType &fluid_solution,
+  const Function<dim>   *drift_velocity)
+{
+  fill_velocity_and_tau<FluidVectorType>(mapping,
+                                         fluid_dof_handler,
+                                         {{1.0, &fluid_solution}},
+                                         drift_velocity);
+}
+
+template <int dim, typename number>
+template <typename FluidVectorType>
+void
+AdvectionDiffusionOperator<dim, number>::evaluate_velocity_and_calculate_tau(
+  const Mapping<dim>                 &mapping,
+  const DoFHandler<dim>              &fluid_dof_handler,
+  const std::vector<FluidVectorType> &fluid_solutions,
+  const std::vector<double>          &weights,
+  const Function<dim>                *drift_velocity)
+{
+  AssertIndexRange(weights.size(), fluid_solutions.size() + 1);
+
+  // Only the first weights.size() solutions are used
+  std::vector<std::pair<double, const FluidVectorType *>> weighted_solutions;
+  for (unsigned int i = 0; i < weights.size(); ++i)
+    weighted_solutions.emplace_back(weights[i], &fluid_solutions[i]);
+
+  fill_velocity_and_tau<FluidVectorType>(mapping,
+                                         fluid_dof_handler,
+                                         weighted_solutions,
+                                         drift_velocity);
+}
+
+template <int dim, typename number>
+template <typename FluidVectorType>
+void
+AdvectionDiffusionOperator<dim, number>::fill_velocity_and_tau(
+  const Mapping<dim>    &mapping,
+  const DoFHandler<dim> &fluid_dof_handler,
+  const std::vector<std::pair<double, const FluidVectorType *>>
+                      &fluid_solutions,
+  const Function<dim> *drift_velocity)
+{
+  const unsigned int n_cells    = matrix_free.n_cell_batches();
+  const unsigned int n_q_points = matrix_free.get_quadrature().size();
+
+  velocity.reinit(n_cells, n_q_points);
+  stabilization_parameter.reinit(n_cells, n_q_points);
+
+  // The quadrature points of the matrix-free object follow the ordering of
+  // the tensor-product quadrature, which allows to evaluate the velocity with
+  // a regular FEValues object on the fluid dynamics cells
+  FEValues<dim> fe_values_fd(mapping,
+                             fluid_dof_handler.get_fe(),
+                             matrix_free.get_quadrature(),
+                             update_values | update_quadrature_points);
+
+  const FEValuesExtractors::Vector velocities(0);
+  std::vector<Tensor<1, dim>>      velocity_values(n_q_points);
+  std::vector<Tensor<1, dim>>      solution_velocity_values(n_q_points);
+  Vector<double>                   drift_velocity_vector(dim);
+
+  // Define 1/dt if the simulation is transient
+  double sdt = 0.0;
+  if (is_bdf(this->simulation_control->get_assembly_method()))
+    sdt = 1. / this->simulation_control->get_time_steps_vector()[0];
+
+  const double alpha = diffusivity / (transport_coefficient + DBL_MIN);
+
+  for (unsigned int cell = 0; cell < n_cells; ++cell)
+    {
+      for (auto lane = 0u;
+           lane < matrix_free.n_active_entries_per_cell_batch(cell);
+           lane++)
+        {
+          const auto cell_iterator = matrix_free.get_cell_iterator(cell, lane);
+
+          typename DoFHandler<dim>::active_cell_iterator fluid_cell(
+            &cell_iterator->get_triangulation(),
+            cell_iterator->level(),
+            cell_iterator->index(),
+            &fluid_dof_handler);
+
+          fe_values_fd.reinit(fluid_cell);
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            velocity_values[q] = 0;
+
+          for (const auto &[weight, fluid_solution] : fluid_solutions)
+            {
+              fe_values_fd[velocities].get_function_values(
+                *fluid_solution, solution_velocity_values);
+              for (unsigned int q = 0; q < n_q_points; ++q)
+                velocity_values[q] += weight * solution_velocity_values[q];
+            }
+
+          if (drift_velocity != nullptr)
+            for (unsigned int q = 0; q < n_q_points; ++q)
+              {
+                drift_velocity->vector_value(fe_values_fd.quadrature_point(q),
+                                             drift_velocity_vector);
+                for (unsigned int d = 0; d < dim; ++d)
+                  velocity_values[q][d] += drift_velocity_vector[d];
+              }
+
+          const double h = element_size[cell][lane];
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              for (unsigned int d = 0; d < dim; ++d)
+                velocity(cell, q)[d][lane] = velocity_values[q][d];
+
+              // Calculation of the SUPG stabilization parameter, which is
+              // identical to the one of the matrix-based assemblers
+              const double u_mag = std::max(velocity_values[q].norm(), 1e-12);
+
+              stabilization_parameter(cell, q)[lane] =
+                1. / std::sqrt(Utilities::fixed_power<2>(sdt) +
+                               Utilities::fixed_power<2>(2. * u_mag / h) +
+                               9 * Utilities::fixed_power<2>(4 * alpha /
+                                                             (h * h)));
+            }
+        }
+    }
+
+  this->enable_advection = true;
+}
+
+template <int dim, typename number>
+template <typename FluidVectorType>
+void
+AdvectionDiffusionOperator<dim, number>::evaluate_velocity_divergence(
+  const Mapping<dim>    &mapping,
+  const DoFHandler<dim> &fluid_dof_handler,
+  const FluidVectorType &fluid_solution)
+{
+  const unsigned int n_cells    = matrix_free.n_cell_batches();
+  const unsigned int n_q_points = matrix_free.get_quadrature().size();
+
+  velocity_divergence.reinit(n_cells, n_q_points);
+
+  FEValues<dim> fe_values_fd(mapping,
+                             fluid_dof_handler.get_fe(),
+                             matrix_free.get_quadrature(),
+                             update_gradients);
+
+  const FEValuesExtractors::Vector velocities(0);
+  std::vector<double>              divergence_values(n_q_points);
+
+  for (unsigned int cell = 0; cell < n_cells; ++cell)
+    {
+      for (auto lane = 0u;
+           lane < matrix_free.n_active_entries_per_cell_batch(cell);
+           lane++)
+        {
+          const auto cell_iterator = matrix_free.get_cell_iterator(cell, lane);
+
+          typename DoFHandler<dim>::active_cell_iterator fluid_cell(
+            &cell_iterator->get_triangulation(),
+            cell_iterator->level(),
+            cell_iterator->index(),
+            &fluid_dof_handler);
+
+          fe_values_fd.reinit(fluid_cell);
+          fe_values_fd[velocities].get_function_divergences(fluid_solution,
+                                                            divergence_values);
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            velocity_divergence(cell, q)[lane] = divergence_values[q];
+        }
+    }
+
+  this->enable_compressibility = true;
+}
+
+template <int dim, typename number>
+void
+AdvectionDiffusionOperator<dim, number>::evaluate_dcdd_dissipation(
+  const Mapping<dim>     &mapping,
+  const GlobalVectorType &solution,
+  const std::function<Tensor<2, dim>(const Tensor<1, dim> &velocity,
+                                     const Tensor<1, dim> &gradient,
+                                     const double          h)>
+    &dissipation_model)
+{
+  Assert(this->enable_advection,
+         ExcMessage("The velocity must be evaluated before the DCDD "
+                    "dissipation."));
+
+  const unsigned int n_cells    = matrix_free.n_cell_batches();
+  const unsigned int n_q_points = matrix_free.get_quadrature().size();
+
+  dcdd_dissipation.reinit(n_cells, n_q_points);
+
+  const auto &dof_handler = matrix_free.get_dof_handler();
+
+  FEValues<dim> fe_values(mapping,
+                          dof_handler.get_fe(),
+                          matrix_free.get_quadrature(),
+                          update_gradients);
+
+  std::vector<Tensor<1, dim>> gradients(n_q_points);
+
+  for (unsigned int cell = 0; cell < n_cells; ++cell)
+    {
+      for (auto lane = 0u;
+           lane < matrix_free.n_active_entries_per_cell_batch(cell);
+           lane++)
+        {
+          typename DoFHandler<dim>::active_cell_iterator dof_cell(
+            &dof_handler.get_triangulation(),
+            matrix_free.get_cell_iterator(cell, lane)->level(),
+            matrix_free.get_cell_iterator(cell, lane)->index(),
+            &dof_handler);
+
+          fe_values.reinit(dof_cell);
+          fe_values.get_function_gradients(solution, gradients);
+
+          const double h = element_size[cell][lane];
+
+          for (unsigned int q = 0; q < n_q_points; ++q)
+            {
+              Tensor<1, dim> u;
+              for (unsigned int d = 0; d < dim; ++d)
+                u[d] = velocity(cell, q)[d][lane];
+
+              const Tensor<2, dim> dissipation =
+                dissipation_model(u, gradients[q], h);
+
+              for (unsigned int i = 0; i < dim; ++i)
+                for (unsigned int j = 0; j < dim; ++j)
+                  dcdd_dissipation(cell, q)[i][j][lane] = dissipation[i][j];
+            }
+        }
+    }
+
+  this->enable_dcdd = true;
+}
+
+template <int dim, typename number>
+void
+AdvectionDiffusionOperator<dim, number>::compute_element_size()
+{
+  const unsigned int n_cells =
+    matrix_free.n_cell_batches() + matrix_free.n_ghost_cell_batches();
+  element_size.resize(n_cells);
+
+  for (unsigned int cell = 0; cell < n_cells; ++cell)
+    {
+      for (auto lane = 0u;
+           lane < matrix_free.n_active_entries_per_cell_batch(cell);
+           lane++)
+        {
+          const double h_k =
+            matrix_free.get_cell_iterator(cell, lane)->measure();
+
+          element_size[cell][lane] = compute_cell_diameter<dim>(h_k, fe_degree);
+        }
+    }
+}
+
+template <int dim, typename number>
+types::global_dof_index
+AdvectionDiffusionOperator<dim, number>::m() const
+{
+  return this->matrix_free.get_dof_handler().n_dofs();
+}
+
+template <int dim, typename number>
+number
+AdvectionDiffusionOperator<dim, number>::el(unsigned int, unsigned int) const
+{
+  Assert(false, ExcNotImplemented());
+  return 0;
+}
+
+template <int dim, typename number>
+void
+AdvectionDiffusionOperator<dim, number>::clear()
+{
+  matrix_free.clear();
+  velocity.reinit(0, 0);
+  stabilization_parameter.reinit(0, 0);
+  velocity_divergence.reinit(0, 0);
+  dcdd_dissipation.reinit(0, 0);
+  system_matrix.clear();
+}
+
+template <int dim, typename number>
+void
+AdvectionDiffusionOperator<dim, number>::initialize_dof_vector(
+  VectorType &vec) const
+{
+  matrix_free.initialize_dof_vector(vec);
+}
+
+template <int dim, typename number>
+const std::shared_ptr<const Utilities::MPI::Partitioner> &
+AdvectionDiffusionOperator<dim, number>::get_vector_partitioner() const
+{
+  return matrix_free.get_vector_partitioner();
+}
+
+template <int dim, typename number>
+void
+AdvectionDiffusionOperator<dim, number>::vmult(VectorType       &dst,
+                                               const VectorType &src) const
+{
+  this->matrix_free.cell_loop(
+    &AdvectionDiffusionOperator::do_cell_integral_range, this, dst, src, true);
+
+  // copy constrained dofs from src to dst (corresponding to diagonal
+  // entries with value 1.0)
+  for (const auto &constrained_index : constrained_indices)
+    dst.local_element(constrained_index) = src.local_element(constrained_index);
+}
+
+template <int dim, typename number>
+void
+AdvectionDiffusionOperator<dim, number>::Tvmult(VectorType       &dst,
+                                                const VectorType &src) const
+{
+  this->vmult(dst, src);
+}
+
+template <int dim, typename number>
+const TrilinosWrappers::SparseMatrix &
+AdvectionDiffusionOperator<dim, number>::get_system_matrix() const
+{
+  if (system_matrix.m() == 0 && system_matrix.n() == 0)
+    {
+      const auto &dof_handler = this->matrix_free.get_dof_handler();
+
+      const IndexSet locally_owned_dofs = dof_handler.locally_owned_dofs();
+      const IndexSet locally_relevant_dofs =
+        DoFTools::extract_locally_relevant_dofs(dof_handler);
+
+      DynamicSparsityPattern dsp(locally_relevant_dofs);
+      DoFTools::make_sparsity_pattern(dof_handler, dsp, constraints, false);
+
+      SparsityTools::distribute_sparsity_pattern(
+        dsp,
+        locally_owned_dofs,
+        dof_handler.get_triangulation().get_communicator(),
+        locally_relevant_dofs);
+
+      system_matrix.reinit(locally_owned_dofs,
+                           locally_owned_dofs,
+                           dsp,
+                           dof_handler.get_triangulation().get_communicator());
+    }
+
+  system_matrix = 0.0;
+
+  MatrixFreeTools::compute_matrix<dim, -1, 0, 1, number>(
+    matrix_free, constraints, system_matrix, [&](auto &integrator) {
+      do_cell_integral_local(integrator);
+    });
+
+  // make sure that diagonal entries related to constrained dofs
+  // have a value of 1.0 (note this is consistent to vmult() and
+  // compute_inverse_diagonal())
+  for (const auto &local_row : constrained_indices)
+    {
+      const auto global_row =
+        get_vector_partitioner()->local_to_global(local_row);
+      system_matrix.set(global_row, global_row, 1.0);
+    }
+
+  system_matrix.compress(VectorOperation::insert);
+
+  return this->system_matrix;
+}
+
+template <int dim, typename number>
+const MatrixFree<dim, number> &
+AdvectionDiffusionOperator<dim, number>::get_system_matrix_free() const
+{
+  return this->matrix_free;
+}
+
+template <int dim, typename number>
+void
+AdvectionDiffusionOperator<dim, number>::compute_inverse_diagonal(
+  VectorType &diagonal) const
+{
+  matrix_free.initialize_dof_vector(diagonal);
+  MatrixFreeTools::compute_diagonal<dim, -1, 0, 1, number>(
+    matrix_free, diagonal, [&](auto &integrator) {
+      this->do_cell_integral_local(integrator);
+    });
+
+  for (const auto &i : constrained_indices)
+    diagonal.local_element(i) = 1.0;
+
+  for (auto &i : diagonal)
+    i = (std::abs(i) > 1.0e-10) ? (1.0 / i) : 1.0;
+}
+
+template <int dim, typename number>
+void
+AdvectionDiffusionOperator<dim, number>::do_cell_integral_range(
+  const MatrixFree<dim, number>               &matrix_free,
+  VectorType                                  &dst,
+  const VectorType                            &src,
+  const std::pair<unsigned int, unsigned int> &range) const
+{
+  FECellIntegrator integrator(matrix_free, range);
+
+  for (unsigned int cell = range.first; cell < range.second; ++cell)
+    {
+      integrator.reinit(cell);
+
+      integrator.read_dof_values(src);
+
+      do_cell_integral_local(integrator);
+
+      integrator.distribute_local_to_global(dst);
+    }
+}
+
+template <int dim, typename number>
+void
+AdvectionDiffusionOperator<dim, number>::do_cell_integral_local(
+  FECellIntegrator &integrator) const
+{
+  const unsigned int cell = integrator.get_current_cell_index();
+
+  // To identify whether the problem is transient or steady
+  const bool transient =
+    is_bdf(this->simulation_control->get_assembly_method());
+
+  const double bdf_0 =
+    transient ? this->simulation_control->get_bdf_coefficients()[0] : 0.0;
+
+  // The hessians are only required by the SUPG stabilization
+  if (this->enable_advection)
+    integrator.evaluate(EvaluationFlags::values | EvaluationFlags::gradients |
+                        EvaluationFlags::hessians);
+  else
+    integrator.evaluate(EvaluationFlags::values | EvaluationFlags::gradients);
+
+  // Gradient-Galerkin least-squares stabilization of the time derivative
+  VectorizedArray<number> tau_ggls = 0.0;
+  if (this->enable_ggls && transient)
+    {
+      const VectorizedArray<number> h =
+        integrator.read_cell_data(this->element_size);
+      tau_ggls = this->transport_coefficient *
+                 std::pow(h, static_cast<number>(this->fe_degree + 1)) / 6.;
+    }
+
+  for (const auto q : integrator.quadrature_point_indices())
+    {
+      const auto value    = integrator.get_value(q);
+      const auto gradient = integrator.get_gradient(q);
+
+      // Time derivative and diffusion
+      VectorizedArray<number> value_result =
+        this->transport_coefficient * bdf_0 * value;
+      Tensor<1, dim, VectorizedArray<number>> gradient_result =
+        this->diffusivity * gradient + tau_ggls * bdf_0 * gradient;
+
+      if (this->enable_advection)
+        {
+          const auto &u   = this->velocity(cell, q);
+          const auto  tau = this->stabilization_parameter(cell, q);
+
+          VectorizedArray<number> advection =
+            this->transport_coefficient * (u * gradient);
+
+          // Compressibility term
+          if (this->enable_compressibility)
+            advection += this->transport_coefficient *
+                         this->velocity_divergence(cell, q) * value;
+
+          value_result += advection;
+
+          // SUPG stabilization
+          const VectorizedArray<number> strong_jacobian =
+            this->transport_coefficient * bdf_0 * value + advection -
+            this->diffusivity * integrator.get_laplacian(q);
+
+          gradient_result += tau * strong_jacobian * u;
+        }
+
+      // Discontinuity-capturing directional dissipation
+      if (this->enable_dcdd)
+        gradient_result += this->dcdd_dissipation(cell, q) * gradient;
+
+      integrator.submit_value(value_result, q);
+      integrator.submit_gradient(gradient_result, q);
+    }
+
+  integrator.integrate(EvaluationFlags::values | EvaluationFlags::gradients);
+}
+
+template class AdvectionDiffusionOperator<2, double>;
+template class AdvectionDiffusionOperator<3, double>;
+template void
+AdvectionDiffusionOperator<2, double>::evaluate_velocity_and_calculate_tau<
+  GlobalVectorType>(const Mapping<2>       &mapping,
+                    const DoFHandler<2>    &fluid_dof_handler,
+                    const GlobalVectorType &fluid_solution,
+                    const Function<2>      *drift_velocity);
+template void
+AdvectionDiffusionOperator<3, double>::evaluate_velocity_and_calculate_tau<
+  GlobalVectorType>(const Mapping<3>       &mapping,
+                    const DoFHandler<3>    &fluid_dof_handler,
+                    const GlobalVectorType &fluid_solution,
+                    const Function<3>      *drift_velocity);
+template void
+AdvectionDiffusionOperator<2, double>::evaluate_velocity_and_calculate_tau<
+  GlobalVectorType>(
+  const Mapping<2>                    &mapping,
+  const DoFHandler<2>                 &fluid_dof_handler,
+  const std::vector<GlobalVectorType> &fluid_solutions,
+  const std::vector<double>           &weights,
+  const Function<2>                   *drift_velocity);
+template void
+AdvectionDiffusionOperator<3, double>::evaluate_velocity_and_calculate_tau<
+  GlobalVectorType>(
+  const Mapping<3>                    &mapping,
+  const DoFHandler<3>                 &fluid_dof_handler,
+  const std::vector<GlobalVectorType> &fluid_solutions,
+  const std::vector<double>           &weights,
+  const Function<3>                   *drift_velocity);
+template void
+AdvectionDiffusionOperator<2, double>::evaluate_velocity_divergence<
+  GlobalVectorType>(const Mapping<2>       &mapping,
+                    const DoFHandler<2>    &fluid_dof_handler,
+                    const GlobalVectorType &fluid_solution);
+template void
+AdvectionDiffusionOperator<3, double>::evaluate_velocity_divergence<
+  GlobalVectorType>(const Mapping<3>       &mapping,
+                    const DoFHandler<3>    &fluid_dof_handler,
+                    const GlobalVectorType &fluid_solution);
+template void
+AdvectionDiffusionOperator<2, double>::evaluate_velocity_and_calculate_tau<
+  GlobalBlockVectorType>(const Mapping<2>            &mapping,
+                         const DoFHandler<2>         &fluid_dof_handler,
+                         const GlobalBlockVectorType &fluid_solution,
+                         const Function<2>           *drift_velocity);
+template void
+AdvectionDiffusionOperator<3, double>::evaluate_velocity_and_calculate_tau<
+  GlobalBlockVectorType>(const Mapping<3>            &mapping,
+                         const DoFHandler<3>         &fluid_dof_handler,
+                         const GlobalBlockVectorType &fluid_solution,
+                         const Function<3>           *drift_velocity);
+template void
+AdvectionDiffusionOperator<2, double>::evaluate_velocity_and_calculate_tau<
+  GlobalBlockVectorType>(
+  const Mapping<2>                         &mapping,
+  const DoFHandler<2>                      &fluid_dof_handler,
+  const std::vector<GlobalBlockVectorType> &fluid_solutions,
+  const std::vector<double>                &weights,
+  const Function<2>                        *drift_velocity);
+template void
+AdvectionDiffusionOperator<3, double>::evaluate_velocity_and_calculate_tau<
+  GlobalBlockVectorType>(
+  const Mapping<3>                         &mapping,
+  const DoFHandler<3>                      &fluid_dof_handler,
+  const std::vector<GlobalBlockVectorType> &fluid_solutions,
+  const std::vector<double>                &weights,
+  const Function<3>                        *drift_velocity);
+template void
+AdvectionDiffusionOperator<2, double>::evaluate_velocity_divergence<
+  GlobalBlockVectorType>(const Mapping<2>            &mapping,
+                         const DoFHandler<2>         &fluid_dof_handler,
+                         const GlobalBlockVectorType &fluid_solution);
+template void
+AdvectionDiffusionOperator<3, double>::evaluate_velocity_divergence<
+  GlobalBlockVectorType>(const Mapping<3>            &mapping,
+                         const DoFHandler<3>         &fluid_dof_handler,
+                         const GlobalBlockVectorType &fluid_solution);
+template void
+AdvectionDiffusionOperator<2, double>::evaluate_velocity_and_calculate_tau<
+  LinearAlgebra::distributed::Vector<double>>(
+  const Mapping<2>                                 &mapping,
+  const DoFHandler<2>                              &fluid_dof_handler,
+  const LinearAlgebra::distributed::Vector<double> &fluid_solution,
+  const Function<2>                                *drift_velocity);
+template void
+AdvectionDiffusionOperator<3, double>::evaluate_velocity_and_calculate_tau<
+  LinearAlgebra::distributed::Vector<double>>(
+  const Mapping<3>                                 &mapping,
+  const DoFHandler<3>                              &fluid_dof_handler,
+  const LinearAlgebra::distributed::Vector<double> &fluid_solution,
+  const Function<3>                                *drift_velocity);
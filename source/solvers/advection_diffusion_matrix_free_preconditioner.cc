@@ -0,0 +1,415 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------*/
+
+#include <core/time_integration_utilities.h>
+
+#include <solvers/advection_diffusion_matrix_free_preconditioner.h>
+
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/dofs/dof_tools.h>
+
+#include <deal.II/fe/fe_q.h>
+
+#include <deal.II/lac/read_write_vector.h>
+
+template <int dim>
+MFAdvectionDiffusionPreconditionGMG<dim>::MFAdvectionDiffusionPreconditionGMG(
+  const Parameters::LinearSolver           &linear_solver_parameters,
+  const DoFHandler<dim>                    &dof_handler,
+  const Mapping<dim>                       &mapping,
+  const Quadrature<dim>                    &cell_quadrature,
+  const std::set<types::boundary_id>       &dirichlet_boundary_ids,
+  const double                              transport_coefficient,
+  const double                              diffusivity,
+  const bool                                enable_ggls,
+  const std::shared_ptr<SimulationControl> &simulation_control)
+  : linear_solver_parameters(linear_solver_parameters)
+  , simulation_control(simulation_control)
+  , setup_bdf_coefficient(0.0)
+  , dof_handler(dof_handler)
+  , pcout(std::cout,
+          Utilities::MPI::this_mpi_process(dof_handler.get_communicator()) ==
+            0)
+{
+  const unsigned int fe_degree = dof_handler.get_fe().degree;
+
+  AssertThrow(cell_quadrature == QGauss<dim>(fe_degree + 1),
+              ExcNotImplemented());
+
+  // Create triangulations
+  this->coarse_grid_triangulations =
+    MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
+      dof_handler.get_triangulation());
+
+  // Modify the triangulations if multigrid number of levels or minimum
+  // number of cells in level are specified
+  const int mg_min_level       = linear_solver_parameters.mg_min_level;
+  const int mg_level_min_cells = linear_solver_parameters.mg_level_min_cells;
+
+  AssertThrow(
+    (mg_min_level + 1) <=
+      static_cast<int>(this->coarse_grid_triangulations.size()),
+    ExcMessage(
+      "The mg min level specified is higher than the finest mg level."));
+
+  // find first relevant coarse-grid triangulation
+  auto ptr = std::find_if(
+    this->coarse_grid_triangulations.begin(),
+    this->coarse_grid_triangulations.end() - 1,
+    [&mg_min_level, &mg_level_min_cells](const auto &tria) {
+      if (mg_min_level != -1) // minimum number of levels
+        return (mg_min_level + 1) <= static_cast<int>(tria->n_global_levels());
+      else if (mg_level_min_cells != -1) // minimum number of cells
+        return static_cast<int>(tria->n_global_active_cells()) >=
+               mg_level_min_cells;
+      return true;
+    });
+
+  // consider all triangulations from that one
+  this->coarse_grid_triangulations.erase(
+    this->coarse_grid_triangulations.begin(), ptr);
+
+  this->minlevel = 0;
+  this->maxlevel = this->coarse_grid_triangulations.size() - 1;
+
+  this->dof_handlers.resize(this->minlevel, this->maxlevel);
+  this->constraints.resize(this->minlevel, this->maxlevel);
+  this->mg_operators.resize(this->minlevel, this->maxlevel);
+  this->transfers.resize(this->minlevel, this->maxlevel);
+
+  const QGauss<dim> quadrature(fe_degree + 1);
+
+  for (unsigned int level = this->minlevel; level <= this->maxlevel; ++level)
+    {
+      // Distribute DoFs. The finest level is not renumbered, which ensures
+      // that its numbering matches the one of the DoFHandler of the physics
+      auto &level_dof_handler = this->dof_handlers[level];
+      level_dof_handler.reinit(*this->coarse_grid_triangulations[level]);
+      level_dof_handler.distribute_dofs(FE_Q<dim>(fe_degree));
+
+      // Hanging node and homogeneous Dirichlet constraints
+      auto &level_constraint = this->constraints[level];
+      level_constraint.clear();
+      level_constraint.reinit(
+        DoFTools::extract_locally_relevant_dofs(level_dof_handler));
+
+      DoFTools::make_hanging_node_constraints(level_dof_handler,
+                                              level_constraint);
+
+      for (const auto &id : dirichlet_boundary_ids)
+        DoFTools::make_zero_boundary_constraints(level_dof_handler,
+                                                 id,
+                                                 level_constraint);
+
+      level_constraint.close();
+
+      this->mg_operators[level] = std::make_shared<OperatorType>();
+      this->mg_operators[level]->reinit(mapping,
+                                        level_dof_handler,
+                                        level_constraint,
+                                        quadrature,
+                                        transport_coefficient,
+                                        diffusivity,
+                                        enable_ggls,
+                                        simulation_control);
+    }
+
+  AssertDimension(this->dof_handlers[this->maxlevel].n_dofs(),
+                  dof_handler.n_dofs());
+
+  if (linear_solver_parameters.mg_verbosity != Parameters::Verbosity::quiet)
+    {
+      this->pcout << std::endl;
+      this->pcout << "  -Levels of MG preconditioner:" << std::endl;
+      for (unsigned int level = this->minlevel; level <= this->maxlevel;
+           ++level)
+        this->pcout << "    Level " << level << ": "
+                    << this->dof_handlers[level].n_dofs() << " DoFs, "
+                    << this->coarse_grid_triangulations[level]
+                         ->n_global_active_cells()
+                    << " cells" << std::endl;
+      this->pcout << std::endl;
+    }
+
+  // Create transfer operators
+  for (unsigned int level = this->minlevel; level < this->maxlevel; ++level)
+    this->transfers[level + 1].reinit(this->dof_handlers[level + 1],
+                                      this->dof_handlers[level],
+                                      this->constraints[level + 1],
+                                      this->constraints[level]);
+
+  this->mg_transfer = std::make_shared<GCTransferType>(
+    this->transfers, [this](const auto l, auto &vec) {
+      this->mg_operators[l]->initialize_dof_vector(vec);
+    });
+}
+
+template <int dim>
+void
+MFAdvectionDiffusionPreconditionGMG<dim>::initialize()
+{
+  // The level operators only change with the first BDF coefficient, the
+  // smoother and the coarse-grid solver of the last set up are kept as long
+  // as it is unchanged
+  const double bdf_coefficient =
+    is_bdf(this->simulation_control->get_assembly_method()) ?
+      this->simulation_control->get_bdf_coefficients()[0] :
+      0.0;
+
+  if (this->multigrid_preconditioner &&
+      bdf_coefficient == this->setup_bdf_coefficient)
+    return;
+
+  this->setup_bdf_coefficient = bdf_coefficient;
+
+  // Chebyshev smoother around the inverse diagonal of the level operators
+  MGLevelObject<typename SmootherType::AdditionalData> smoother_data(
+    this->minlevel, this->maxlevel);
+
+  for (unsigned int level = this->minlevel; level <= this->maxlevel; ++level)
+    {
+      smoother_data[level].preconditioner =
+        std::make_shared<SmootherPreconditionerType>();
+      this->mg_operators[level]->compute_inverse_diagonal(
+        smoother_data[level].preconditioner->get_vector());
+
+      smoother_data[level].degree =
+        this->linear_solver_parameters.mg_smoother_iterations;
+      smoother_data[level].smoothing_range =
+        this->linear_solver_parameters.eig_estimation_smoothing_range;
+      smoother_data[level].eig_cg_n_iterations =
+        this->linear_solver_parameters.eig_estimation_cg_n_iterations;
+      smoother_data[level].constraints.copy_from(this->constraints[level]);
+    }
+
+  this->mg_smoother = std::make_shared<
+    MGSmootherPrecondition<OperatorType, SmootherType, VectorType>>();
+  this->mg_smoother->initialize(this->mg_operators, smoother_data);
+
+  // Coarse-grid solver
+  if (this->linear_solver_parameters.mg_coarse_grid_solver ==
+      Parameters::LinearSolver::CoarseGridSolverType::gmres)
+    {
+      setup_AMG();
+
+      this->coarse_grid_solver_control = std::make_shared<ReductionControl>(
+        this->linear_solver_parameters.mg_gmres_max_iterations,
+        this->linear_solver_parameters.mg_gmres_tolerance,
+        this->linear_solver_parameters.mg_gmres_reduce,
+        false,
+        false);
+
+      typename SolverGMRES<VectorType>::AdditionalData solver_parameters;
+      solver_parameters.max_n_tmp_vectors =
+        this->linear_solver_parameters.mg_gmres_max_krylov_vectors;
+
+      this->coarse_grid_solver = std::make_shared<SolverGMRES<VectorType>>(
+        *this->coarse_grid_solver_control, solver_parameters);
+
+      this->mg_coarse = std::make_shared<
+        MGCoarseGridIterativeSolver<VectorType,
+                                    SolverGMRES<VectorType>,
+                                    OperatorType,
+                                    TrilinosWrappers::PreconditionAMG>>(
+        *this->coarse_grid_solver,
+        *this->mg_operators[this->minlevel],
+        *this->precondition_amg);
+    }
+  else if (this->linear_solver_parameters.mg_coarse_grid_solver ==
+           Parameters::LinearSolver::CoarseGridSolverType::amg)
+    {
+      setup_AMG();
+
+      this->mg_coarse = std::make_shared<
+        MGCoarseGridApplyPreconditioner<VectorType,
+                                        TrilinosWrappers::PreconditionAMG>>(
+        *this->precondition_amg);
+    }
+  else
+    AssertThrow(
+      false,
+      ExcMessage(
+        "The matrix-free advection-diffusion multigrid preconditioner only supports <gmres|amg> coarse-grid solvers."));
+
+  // Create main MG object and MG preconditioner
+  this->mg_matrix =
+    std::make_shared<mg::Matrix<VectorType>>(this->mg_operators);
+
+  this->mg = std::make_shared<Multigrid<VectorType>>(*this->mg_matrix,
+                                                     *this->mg_coarse,
+                                                     *this->mg_transfer,
+                                                     *this->mg_smoother,
+                                                     *this->mg_smoother,
+                                                     this->minlevel,
+                                                     this->maxlevel);
+
+  this->multigrid_preconditioner =
+    std::make_shared<PreconditionerType>(this->dof_handler,
+                                         *this->mg,
+                                         *this->mg_transfer);
+}
+
+template <int dim>
+void
+MFAdvectionDiffusionPreconditionGMG<dim>::vmult(VectorType       &dst,
+                                                const VectorType &src) const
+{
+  this->multigrid_preconditioner->vmult(dst, src);
+}
+
+template <int dim>
+void
+MFAdvectionDiffusionPreconditionGMG<dim>::setup_AMG()
+{
+  TrilinosWrappers::PreconditionAMG::AdditionalData amg_data;
+
+  if (!this->linear_solver_parameters.mg_amg_use_default_parameters)
+    {
+      // The level operators are symmetric positive definite
+      amg_data.elliptic = true;
+      if (this->dof_handler.get_fe().degree > 1)
+        amg_data.higher_order_elements = true;
+      amg_data.n_cycles = this->linear_solver_parameters.amg_n_cycles;
+      amg_data.w_cycle  = this->linear_solver_parameters.amg_w_cycles;
+      amg_data.aggregation_threshold =
+        this->linear_solver_parameters.amg_aggregation_threshold;
+      amg_data.smoother_sweeps =
+        this->linear_solver_parameters.amg_smoother_sweeps;
+      amg_data.smoother_overlap =
+        this->linear_solver_parameters.amg_smoother_overlap;
+      amg_data.output_details = false;
+    }
+
+  this->precondition_amg =
+    std::make_shared<TrilinosWrappers::PreconditionAMG>();
+
+  this->precondition_amg->initialize(
+    this->mg_operators[this->minlevel]->get_system_matrix(), amg_data);
+}
+
+template class MFAdvectionDiffusionPreconditionGMG<2>;
+template class MFAdvectionDiffusionPreconditionGMG<3>;
+
+template <int dim, typename PreconditionerType>
+void
+solve_advection_diffusion_matrix_free(
+  const AdvectionDiffusionOperator<dim, double> &system_operator,
+  const PreconditionerType                      &preconditioner,
+  const Parameters::LinearSolver                &linear_solver_parameters,
+  const GlobalVectorType                        &system_rhs,
+  const AffineConstraints<double>               &constraints,
+  GlobalVectorType                              &newton_update,
+  const ConditionalOStream                      &pcout)
+{
+  using VectorType = LinearAlgebra::distributed::Vector<double>;
+
+  const double linear_solver_tolerance =
+    std::max(linear_solver_parameters.relative_residual * system_rhs.l2_norm(),
+             linear_solver_parameters.minimum_residual);
+
+  if (linear_solver_parameters.verbosity != Parameters::Verbosity::quiet)
+    {
+      pcout << "  -Tolerance of iterative solver is : "
+            << linear_solver_tolerance << std::endl;
+    }
+
+  // The right-hand side assembled in the global vector is copied into a
+  // vector compatible with the matrix-free operator
+  VectorType rhs;
+  VectorType solution;
+  system_operator.initialize_dof_vector(rhs);
+  system_operator.initialize_dof_vector(solution);
+
+  {
+    LinearAlgebra::ReadWriteVector<double> rwv(rhs.locally_owned_elements());
+    rwv.import_elements(system_rhs, VectorOperation::insert);
+    rhs.import_elements(rwv, VectorOperation::insert);
+  }
+
+  SolverControl solver_control(linear_solver_parameters.max_iterations,
+                               linear_solver_tolerance,
+                               true,
+                               true);
+
+  typename SolverGMRES<VectorType>::AdditionalData solver_parameters;
+  solver_parameters.max_n_tmp_vectors =
+    linear_solver_parameters.max_krylov_vectors;
+
+  SolverGMRES<VectorType> solver(solver_control, solver_parameters);
+
+  solver.solve(system_operator, solution, rhs, preconditioner);
+
+  if (linear_solver_parameters.verbosity != Parameters::Verbosity::quiet)
+    {
+      pcout << "  -Iterative solver took : " << solver_control.last_step()
+            << " steps to reach a residual norm of "
+            << solver_control.last_value() << std::endl;
+    }
+
+  const IndexSet locally_owned_dofs = system_rhs.locally_owned_elements();
+
+  GlobalVectorType completely_distributed_solution(
+    locally_owned_dofs, system_rhs.get_mpi_communicator());
+  {
+    LinearAlgebra::ReadWriteVector<double> rwv(locally_owned_dofs);
+    rwv.import_elements(solution, VectorOperation::insert);
+    completely_distributed_solution.import_elements(rwv,
+                                                    VectorOperation::insert);
+  }
+
+  constraints.distribute(completely_distributed_solution);
+  newton_update = completely_distributed_solution;
+}
+
+template void
+solve_advection_diffusion_matrix_free(
+  const AdvectionDiffusionOperator<2, double> &,
+  const MFAdvectionDiffusionPreconditionGMG<2> &,
+  const Parameters::LinearSolver &,
+  const GlobalVectorType &,
+  const AffineConstraints<double> &,
+  GlobalVectorType &,
+  const ConditionalOStream &);
+
+template void
+solve_advection_diffusion_matrix_free(
+  const AdvectionDiffusionOperator<3, double> &,
+  const MFAdvectionDiffusionPreconditionGMG<3> &,
+  const Parameters::LinearSolver &,
+  const GlobalVectorType &,
+  const AffineConstraints<double> &,
+  GlobalVectorType &,
+  const ConditionalOStream &);
+
+template void
+solve_advection_diffusion_matrix_free(
+  const AdvectionDiffusionOperator<2, double> &,
+  const DiagonalMatrix<LinearAlgebra::distributed::Vector<double>> &,
+  const Parameters::LinearSolver &,
+  const GlobalVectorType &,
+  const AffineConstraints<double> &,
+  GlobalVectorType &,
+  const ConditionalOStream &);
+
+template void
+solve_advection_diffusion_matrix_free(
+  const AdvectionDiffusionOperator<3, double> &,
+  const DiagonalMatrix<LinearAlgebra::distributed::Vector<double>> &,
+  const Parameters::LinearSolver &,
+  const GlobalVectorType &,
+  const AffineConstraints<double> &,
+  GlobalVectorType &,
+  const ConditionalOStream &);
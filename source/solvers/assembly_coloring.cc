@@ -0,0 +1,79 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------*/
+
+#include <solvers/assembly_coloring.h>
+
+#include <deal.II/base/graph_coloring.h>
+
+#include <deal.II/grid/filtered_iterator.h>
+
+template <int dim>
+void
+AssemblyColoring<dim>::reinit(const DoFHandler<dim>           &dof_handler,
+                              const AffineConstraints<double> &constraints)
+{
+  const IndexSet &locally_owned_dofs = dof_handler.locally_owned_dofs();
+
+  const unsigned int n_dofs_per_cell = dof_handler.get_fe().n_dofs_per_cell();
+
+  const auto locally_owned_cells =
+    filter_iterators(dof_handler.active_cell_iterators(),
+                     IteratorFilters::LocallyOwnedCell());
+  using FilteredCellIterator = decltype(locally_owned_cells.begin());
+
+  // The contributions to a constrained degree of freedom are distributed to
+  // the degrees of freedom that constrain it. They are part of the conflicts
+  // of the cell.
+  const auto get_conflict_indices = [&](const FilteredCellIterator &cell) {
+    std::vector<types::global_dof_index> local_dof_indices(n_dofs_per_cell);
+    cell->get_dof_indices(local_dof_indices);
+    constraints.resolve_indices(local_dof_indices);
+    return local_dof_indices;
+  };
+
+  const std::vector<std::vector<FilteredCellIterator>> colors =
+    GraphColoring::make_graph_coloring(locally_owned_cells.begin(),
+                                       locally_owned_cells.end(),
+                                       get_conflict_indices);
+
+  colored_cells.clear();
+  colored_cells.reserve(colors.size());
+  for (const auto &color : colors)
+    colored_cells.emplace_back(color.begin(), color.end());
+
+  // The locally owned degrees of freedom constrained by degrees of freedom
+  // owned by other processes write to rows owned by other processes
+  lock_free_dofs = locally_owned_dofs;
+  IndexSet nonlocal_constrained_dofs(dof_handler.n_dofs());
+  for (const auto &line : constraints.get_lines())
+    {
+      if (!locally_owned_dofs.is_element(line.index))
+        continue;
+
+      for (const auto &entry : line.entries)
+        if (!locally_owned_dofs.is_element(entry.first))
+          {
+            nonlocal_constrained_dofs.add_index(line.index);
+            break;
+          }
+    }
+  lock_free_dofs.subtract_set(nonlocal_constrained_dofs);
+
+  // The index set is read concurrently by the copiers
+  lock_free_dofs.compress();
+}
+
+template class AssemblyColoring<2>;
+template class AssemblyColoring<3>;
@@ -118,14 +118,14 @@ CahnHilliard<dim>::assemble_system_matrix()
     dof_handler_fluid->get_fe(),
     *this->face_quadrature);
 
-  WorkStream::run(this->dof_handler.begin_active(),
-                  this->dof_handler.end(),
-                  *this,
-                  &CahnHilliard::assemble_local_system_matrix,
-                  &CahnHilliard::copy_local_matrix_to_global_matrix,
-                  scratch_data,
-                  StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
-                                            this->cell_quadrature->size()));
+  run_cell_assembly(this->dof_handler,
+                    assembly_coloring.get(),
+                    *this,
+                    &CahnHilliard::assemble_local_system_matrix,
+                    &CahnHilliard::copy_local_matrix_to_global_matrix,
+                    scratch_data,
+                    StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
+                                              this->cell_quadrature->size()));
 
   system_matrix.compress(VectorOperation::add);
 }
@@ -215,14 +215,14 @@ CahnHilliard<dim>::assemble_system_rhs()
     dof_handler_fluid->get_fe(),
     *this->face_quadrature);
 
-  WorkStream::run(this->dof_handler.begin_active(),
-                  this->dof_handler.end(),
-                  *this,
-                  &CahnHilliard::assemble_local_system_rhs,
-                  &CahnHilliard::copy_local_rhs_to_global_rhs,
-                  scratch_data,
-                  StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
-                                            this->cell_quadrature->size()));
+  run_cell_assembly(this->dof_handler,
+                    assembly_coloring.get(),
+                    *this,
+                    &CahnHilliard::assemble_local_system_rhs,
+                    &CahnHilliard::copy_local_rhs_to_global_rhs,
+                    scratch_data,
+                    StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
+                                              this->cell_quadrature->size()));
 
   this->system_rhs.compress(VectorOperation::add);
 }
@@ -1135,6 +1135,14 @@ CahnHilliard<dim>::setup_dofs()
                        dsp,
                        mpi_communicator);
 
+  // The cells are colored for the new mesh and constraints
+  if (this->simulation_parameters.fem_parameters.enable_colored_assembly)
+    {
+      if (!assembly_coloring)
+        assembly_coloring = std::make_shared<AssemblyColoring<dim>>();
+      assembly_coloring->reinit(this->dof_handler, zero_constraints);
+    }
+
   this->pcout << "   Number of Cahn-Hilliard degrees of freedom: "
               << dof_handler.n_dofs() << std::endl;
 
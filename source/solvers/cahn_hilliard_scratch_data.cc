@@ -86,13 +86,6 @@ CahnHilliardScratchData<dim>::allocate()
   this->surface_tension                 = std::vector<double>(n_q_points);
   this->mobility_cahn_hilliard          = std::vector<double>(n_q_points);
   this->mobility_cahn_hilliard_gradient = std::vector<double>(n_q_points);
-
-  // Physical properties
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::phase_order_cahn_hilliard,
-                                          n_q_points));
-  fields.insert(std::pair<field, std::vector<double>>(
-    field::phase_order_cahn_hilliard_filtered, n_q_points));
 }
 
 template <int dim>
@@ -107,9 +100,8 @@ CahnHilliardScratchData<dim>::calculate_physical_properties()
         }
       case 2:
         {
-          set_field_vector(field::phase_order_cahn_hilliard,
-                           this->phase_order_values,
-                           this->fields);
+          fields.set(field::phase_order_cahn_hilliard,
+                     this->phase_order_values);
 
           // Gather properties from material interactions
           const auto material_interaction_id =
@@ -44,6 +44,7 @@ FluidDynamicsBlock<dim>::FluidDynamicsBlock(
   SimulationParameters<dim> &p_nsparam)
   : NavierStokesBase<dim, GlobalBlockVectorType, std::vector<IndexSet>>(
       p_nsparam)
+  , velocity_preconditioner_inverse_time_step(0)
 {}
 
 template <int dim>
@@ -237,8 +238,10 @@ FluidDynamicsBlock<dim>::assemble_system_matrix()
 
   system_matrix.compress(VectorOperation::add);
 
-  // Finally we move pressure mass matrix into a separate matrix:
-  pressure_mass_matrix.reinit(sparsity_pattern.block(1, 1));
+  // Finally we move pressure mass matrix into a separate matrix. It is
+  // initialized with the sparsity pattern of the block when the DoFs are set
+  // up, such that only its values are copied and that its preconditioner can
+  // be kept.
   pressure_mass_matrix.copy_from(system_matrix.block(1, 1));
 
   // Note that settings this pressure block to zero is not identical to
@@ -557,6 +560,15 @@ FluidDynamicsBlock<dim>::setup_dofs_fd()
 {
   TimerOutput::Scope t(this->computing_timer, "Setup DOFs");
 
+  // Clear the preconditioners before the matrices they are associated with
+  // are cleared
+  system_ilu_preconditioner.reset();
+  system_amg_preconditioner.reset();
+  velocity_ilu_preconditioner.reset();
+  velocity_amg_preconditioner.reset();
+  pressure_ilu_preconditioner.reset();
+  pressure_amg_preconditioner.reset();
+
   system_matrix.clear();
 
   this->dof_handler.distribute_dofs(*this->fe);
@@ -902,7 +914,8 @@ FluidDynamicsBlock<dim>::solve_linear_system(const bool initial_step,
 
 template <int dim>
 void
-FluidDynamicsBlock<dim>::setup_ILU()
+FluidDynamicsBlock<dim>::setup_ILU(const bool setup_velocity,
+                                   const bool setup_pressure)
 {
   TimerOutput::Scope t(this->computing_timer, "setup_ILU");
 
@@ -919,18 +932,28 @@ FluidDynamicsBlock<dim>::setup_ILU()
     this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
       .ilu_precond_rtol;
 
-  velocity_ilu_preconditioner =
-    std::make_shared<TrilinosWrappers::PreconditionILU>();
-  pressure_ilu_preconditioner =
-    std::make_shared<TrilinosWrappers::PreconditionILU>();
-
   TrilinosWrappers::PreconditionILU::AdditionalData preconditionerOptions(
     ilu_fill, ilu_atol, ilu_rtol, 0);
-  velocity_ilu_preconditioner->initialize(system_matrix.block(0, 0),
-                                          preconditionerOptions);
 
-  pressure_ilu_preconditioner->initialize(system_matrix.block(1, 1),
-                                          preconditionerOptions);
+  if (setup_velocity)
+    {
+      velocity_ilu_preconditioner =
+        std::make_shared<TrilinosWrappers::PreconditionILU>();
+      velocity_ilu_preconditioner->initialize(system_matrix.block(0, 0),
+                                              preconditionerOptions);
+    }
+
+  if (setup_pressure)
+    {
+      pressure_ilu_preconditioner =
+        std::make_shared<TrilinosWrappers::PreconditionILU>();
+      // The (1,1) block of the system matrix does not depend on the
+      // linearization point, so its preconditioner can be kept when the
+      // preconditioners are reused
+      pressure_ilu_preconditioner->initialize(system_matrix.block(1, 1),
+                                              preconditionerOptions);
+    }
+
   system_ilu_preconditioner = std::make_shared<
     BlockSchurPreconditioner<TrilinosWrappers::PreconditionILU>>(
     gamma,
@@ -945,7 +968,8 @@ FluidDynamicsBlock<dim>::setup_ILU()
 
 template <int dim>
 void
-FluidDynamicsBlock<dim>::setup_AMG()
+FluidDynamicsBlock<dim>::setup_AMG(const bool setup_velocity,
+                                   const bool setup_pressure)
 {
   TimerOutput::Scope t(this->computing_timer, "setup_AMG");
 
@@ -974,7 +998,6 @@ FluidDynamicsBlock<dim>::setup_AMG()
                                    pressure_components,
                                    pressure_constant_modes);
 
-  this->computing_timer.enter_subsection("AMG_velocity");
   const bool elliptic_velocity     = false;
   bool       higher_order_elements = false;
   if (this->fe->degree > 1)
@@ -998,11 +1021,6 @@ FluidDynamicsBlock<dim>::setup_AMG()
   const char *smoother_type  = "Chebyshev";  //"ILU";
   const char *coarse_type    = "Amesos-KLU"; //"ILU";
 
-  velocity_amg_preconditioner =
-    std::make_shared<TrilinosWrappers::PreconditionAMG>();
-  pressure_amg_preconditioner =
-    std::make_shared<TrilinosWrappers::PreconditionAMG>();
-
   TrilinosWrappers::PreconditionAMG::AdditionalData
     velocity_preconditioner_options(elliptic_velocity,
                                     higher_order_elements,
@@ -1016,17 +1034,23 @@ FluidDynamicsBlock<dim>::setup_AMG()
                                     smoother_type,
                                     coarse_type);
 
-  Teuchos::ParameterList              velocity_parameter_ml;
-  std::unique_ptr<Epetra_MultiVector> velocity_distributed_constant_modes;
-  velocity_preconditioner_options.set_parameters(
-    velocity_parameter_ml,
-    velocity_distributed_constant_modes,
-    system_matrix.block(0, 0));
-  velocity_amg_preconditioner->initialize(system_matrix.block(0, 0),
-                                          velocity_parameter_ml);
-  this->computing_timer.leave_subsection("AMG_velocity");
-
-  this->computing_timer.enter_subsection("AMG_pressure");
+  if (setup_velocity)
+    {
+      this->computing_timer.enter_subsection("AMG_velocity");
+      velocity_amg_preconditioner =
+        std::make_shared<TrilinosWrappers::PreconditionAMG>();
+
+      Teuchos::ParameterList              velocity_parameter_ml;
+      std::unique_ptr<Epetra_MultiVector> velocity_distributed_constant_modes;
+      velocity_preconditioner_options.set_parameters(
+        velocity_parameter_ml,
+        velocity_distributed_constant_modes,
+        system_matrix.block(0, 0));
+      velocity_amg_preconditioner->initialize(system_matrix.block(0, 0),
+                                              velocity_parameter_ml);
+      this->computing_timer.leave_subsection("AMG_velocity");
+    }
+
   const bool elliptic_pressure = true;
   higher_order_elements        = false;
   if (this->pressure_fem_degree > 1)
@@ -1043,15 +1067,22 @@ FluidDynamicsBlock<dim>::setup_AMG()
                                     output_details,
                                     smoother_type,
                                     coarse_type);
-  Teuchos::ParameterList pressure_parameter_ml;
-  std::unique_ptr<Epetra_MultiVector> pressure_distributed_constant_modes;
-  velocity_preconditioner_options.set_parameters(
-    pressure_parameter_ml,
-    pressure_distributed_constant_modes,
-    system_matrix.block(0, 0));
-  pressure_amg_preconditioner->initialize(system_matrix.block(1, 1),
-                                          pressure_parameter_ml);
-  this->computing_timer.leave_subsection("AMG_pressure");
+  if (setup_pressure)
+    {
+      this->computing_timer.enter_subsection("AMG_pressure");
+      pressure_amg_preconditioner =
+        std::make_shared<TrilinosWrappers::PreconditionAMG>();
+
+      Teuchos::ParameterList              pressure_parameter_ml;
+      std::unique_ptr<Epetra_MultiVector> pressure_distributed_constant_modes;
+      velocity_preconditioner_options.set_parameters(
+        pressure_parameter_ml,
+        pressure_distributed_constant_modes,
+        system_matrix.block(0, 0));
+      pressure_amg_preconditioner->initialize(system_matrix.block(1, 1),
+                                              pressure_parameter_ml);
+      this->computing_timer.leave_subsection("AMG_pressure");
+    }
 
 
   GlobalBlockVectorType completely_distributed_solution(
@@ -1072,6 +1103,40 @@ FluidDynamicsBlock<dim>::setup_AMG()
 
 
 
+template <int dim>
+bool
+FluidDynamicsBlock<dim>::velocity_preconditioner_is_outdated() const
+{
+  const double tolerance =
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+      .block_velocity_preconditioner_tolerance;
+
+  // The velocity block contains the mass matrix divided by the time step
+  const double inverse_time_step = get_inverse_time_step();
+  if (std::abs(inverse_time_step - velocity_preconditioner_inverse_time_step) >
+      tolerance * velocity_preconditioner_inverse_time_step)
+    return true;
+
+  // The convective term is linearized around the velocity of the evaluation
+  // point
+  GlobalVectorType velocity_change(velocity_preconditioner_velocity);
+  velocity_change = this->evaluation_point.block(0);
+  velocity_change -= velocity_preconditioner_velocity;
+
+  return velocity_change.l2_norm() >
+         tolerance * velocity_preconditioner_velocity.l2_norm();
+}
+
+template <int dim>
+double
+FluidDynamicsBlock<dim>::get_inverse_time_step() const
+{
+  if (this->simulation_control->is_steady())
+    return 0;
+
+  return 1. / this->simulation_control->get_time_step();
+}
+
 template <int dim>
 void
 FluidDynamicsBlock<dim>::solve_system_GMRES(const bool   initial_step,
@@ -1104,23 +1169,69 @@ FluidDynamicsBlock<dim>::solve_system_GMRES(const bool   initial_step,
 
   SolverFGMRES<GlobalBlockVectorType> solver(solver_control);
 
+  const bool use_ilu =
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+      .preconditioner == Parameters::LinearSolver::PreconditionerType::ilu;
+  const bool use_amg =
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+      .preconditioner == Parameters::LinearSolver::PreconditionerType::amg;
+
+  const bool velocity_preconditioner_is_missing =
+    use_ilu ? velocity_ilu_preconditioner == nullptr :
+              velocity_amg_preconditioner == nullptr;
+  const bool pressure_preconditioner_is_missing =
+    use_ilu ? pressure_ilu_preconditioner == nullptr :
+              pressure_amg_preconditioner == nullptr;
+
+  // By default, both preconditioners are rebuilt every time the matrix is
+  // renewed. If they are reused, the preconditioner of the pressure block is
+  // kept until the DoFs change and the preconditioner of the velocity block
+  // is only rebuilt if its linearization is outdated.
+  bool setup_velocity = renewed_matrix || velocity_preconditioner_is_missing;
+  bool setup_pressure = renewed_matrix || pressure_preconditioner_is_missing;
   if (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
-        .preconditioner == Parameters::LinearSolver::PreconditionerType::ilu)
+        .block_preconditioner_reuse)
     {
-      if (renewed_matrix || velocity_ilu_preconditioner == nullptr ||
-          pressure_ilu_preconditioner == nullptr ||
-          system_ilu_preconditioner == nullptr)
-        setup_ILU();
+      setup_velocity =
+        velocity_preconditioner_is_missing ||
+        (renewed_matrix && velocity_preconditioner_is_outdated());
+      setup_pressure = pressure_preconditioner_is_missing;
     }
-  else if (this->simulation_parameters.linear_solver
-             .at(PhysicsID::fluid_dynamics)
-             .preconditioner ==
-           Parameters::LinearSolver::PreconditionerType::amg)
+
+  if ((use_ilu || use_amg) && (setup_velocity || setup_pressure))
     {
-      if (renewed_matrix || velocity_amg_preconditioner == nullptr ||
-          pressure_amg_preconditioner == nullptr ||
-          system_amg_preconditioner == nullptr)
-        setup_AMG();
+      // The set up time of the preconditioners is accumulated in the timer
+      // output, such that runs with and without reuse can be compared
+      TimerOutput::Scope t(this->computing_timer,
+                           "Setup block preconditioner");
+
+      Timer timer(this->mpi_communicator);
+
+      if (use_ilu)
+        setup_ILU(setup_velocity, setup_pressure);
+      else
+        setup_AMG(setup_velocity, setup_pressure);
+
+      if (setup_velocity)
+        {
+          velocity_preconditioner_velocity.reinit(this->locally_owned_dofs[0],
+                                                  this->mpi_communicator);
+          velocity_preconditioner_velocity = this->evaluation_point.block(0);
+          velocity_preconditioner_inverse_time_step = get_inverse_time_step();
+        }
+
+      timer.stop();
+      if (this->simulation_parameters.linear_solver
+            .at(PhysicsID::fluid_dynamics)
+            .verbosity != Parameters::Verbosity::quiet)
+        {
+          this->pcout << "  -Block preconditioner set up in "
+                      << timer.wall_time() << "s (velocity: "
+                      << (setup_velocity ? "rebuilt" : "reused")
+                      << ", pressure: "
+                      << (setup_pressure ? "rebuilt" : "reused") << ")"
+                      << std::endl;
+        }
     }
 
   {
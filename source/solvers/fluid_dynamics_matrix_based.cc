@@ -32,6 +32,8 @@
 #include <deal.II/dofs/dof_renumbering.h>
 #include <deal.II/dofs/dof_tools.h>
 
+#include <deal.II/fe/fe_q.h>
+
 #include <deal.II/grid/grid_tools.h>
 
 #include <deal.II/lac/full_matrix.h>
@@ -43,6 +45,9 @@
 
 #include <deal.II/numerics/vector_tools.h>
 
+#include <functional>
+#include <limits>
+
 
 
 // Constructor for class FluidDynamicsMatrixBased
@@ -50,6 +55,13 @@ template <int dim>
 FluidDynamicsMatrixBased<dim>::FluidDynamicsMatrixBased(
   SimulationParameters<dim> &p_nsparam)
   : NavierStokesBase<dim, GlobalVectorType, IndexSet>(p_nsparam)
+  , use_matrix_free_residual(false)
+  , matrix_free_residual_checked(false)
+  , amg_hierarchy_fill_level(-1)
+  , system_matrix_is_jacobian(false)
+  , matrix_structure_n_dofs(0)
+  , matrix_structure_n_active_cells(0)
+  , residual_time_derivative_time(std::numeric_limits<double>::quiet_NaN())
 {
   initial_preconditioner_fill_level =
     ((this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
@@ -71,6 +83,7 @@ void
 FluidDynamicsMatrixBased<dim>::setup_dofs_fd()
 {
   TimerOutput::Scope t(this->computing_timer, "Setup DOFs");
+  Timer               timer(this->mpi_communicator);
 
   // Clear the preconditioner before the matrix they are associated with is
   // cleared
@@ -78,12 +91,34 @@ FluidDynamicsMatrixBased<dim>::setup_dofs_fd()
   ilu_preconditioner.reset();
   current_preconditioner_fill_level = initial_preconditioner_fill_level;
 
+  // The entries of the system matrix no longer correspond to the problem
+  system_matrix_is_jacobian = false;
 
-  // Now reset system matrix
-  system_matrix.clear();
+  // The support of the matrix-free residual is checked once the solver is
+  // fully constructed, such that derived solvers can disable it
+  if (!matrix_free_residual_checked)
+    {
+      matrix_free_residual_checked = true;
+      if (this->simulation_parameters.fem_parameters
+            .enable_matrix_free_residual)
+        {
+          use_matrix_free_residual = matrix_free_residual_is_supported();
+          if (!use_matrix_free_residual)
+            this->pcout
+              << "Warning: the matrix-free residual is not supported for this "
+                 "problem. The residual is assembled with the assemblers."
+              << std::endl;
+        }
+    }
 
   this->dof_handler.distribute_dofs(*this->fe);
-  DoFRenumbering::Cuthill_McKee(this->dof_handler);
+
+  // The finest level of the global coarsening multigrid preconditioner, used
+  // by the matrix-free path of derived solvers, is not renumbered. The DoFs
+  // must keep the same numbering.
+  if (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+        .preconditioner != Parameters::LinearSolver::PreconditionerType::gcmg)
+    DoFRenumbering::Cuthill_McKee(this->dof_handler);
 
   this->locally_owned_dofs = this->dof_handler.locally_owned_dofs();
   this->locally_relevant_dofs =
@@ -117,22 +152,96 @@ FluidDynamicsMatrixBased<dim>::setup_dofs_fd()
   this->system_rhs.reinit(this->locally_owned_dofs, this->mpi_communicator);
   this->local_evaluation_point.reinit(this->locally_owned_dofs,
                                       this->mpi_communicator);
-  auto                  &nonzero_constraints = this->get_nonzero_constraints();
-  DynamicSparsityPattern dsp(this->locally_relevant_dofs);
-  DoFTools::make_sparsity_pattern(this->dof_handler,
-                                  dsp,
-                                  nonzero_constraints,
-                                  false);
-  SparsityTools::distribute_sparsity_pattern(
-    dsp,
-    this->dof_handler.locally_owned_dofs(),
-    this->mpi_communicator,
-    this->locally_relevant_dofs);
-
-  system_matrix.reinit(this->locally_owned_dofs,
-                       this->locally_owned_dofs,
-                       dsp,
-                       this->mpi_communicator);
+
+  // The sparsity pattern and the system matrix are only rebuilt if the
+  // structure of the matrix has changed. This is not the case if the mesh
+  // adaptation has not modified the mesh.
+  const bool reuse_matrix_structure = matrix_structure_is_unchanged();
+  if (!reuse_matrix_structure)
+    {
+      system_matrix.clear();
+
+      DynamicSparsityPattern dsp(this->locally_relevant_dofs);
+      DoFTools::make_sparsity_pattern(this->dof_handler,
+                                      dsp,
+                                      this->get_nonzero_constraints(),
+                                      false);
+      SparsityTools::distribute_sparsity_pattern(
+        dsp,
+        this->dof_handler.locally_owned_dofs(),
+        this->mpi_communicator,
+        this->locally_relevant_dofs);
+
+      system_matrix.reinit(this->locally_owned_dofs,
+                           this->locally_owned_dofs,
+                           dsp,
+                           this->mpi_communicator);
+    }
+
+  // The shape functions of the affine cells are evaluated once for the new
+  // mesh and reused by every assembly until the next set up of the DoFs
+  if (this->simulation_parameters.fem_parameters.enable_shape_data_cache)
+    {
+      if (!shape_data_cache)
+        shape_data_cache = std::make_shared<NavierStokesShapeDataCache<dim>>();
+      shape_data_cache->initialize(this->dof_handler,
+                                   *this->mapping,
+                                   *this->cell_quadrature);
+    }
+
+  // The cells are colored for the new mesh and constraints. The constraints
+  // of the solid domain change during the simulation and are not supported.
+  if (this->simulation_parameters.fem_parameters.enable_colored_assembly &&
+      !this->simulation_parameters.constrain_solid_domain.enable)
+    {
+      if (!assembly_coloring)
+        assembly_coloring = std::make_shared<AssemblyColoring<dim>>();
+      assembly_coloring->reinit(this->dof_handler, this->zero_constraints);
+    }
+
+  // The matrix-free operator that evaluates the residual works on its own DoF
+  // handler, whose DoFs are mapped to the ones of the system matrix
+  if (use_matrix_free_residual)
+    {
+      if (!residual_operator)
+        residual_operator =
+          std::make_shared<NavierStokesStabilizedOperator<dim, double>>();
+
+      std::shared_ptr<Function<dim>> forcing_function;
+      if (this->simulation_parameters.source_term.enable)
+        forcing_function = this->forcing_function;
+
+      // The matrix-based solver uses SUPG/PSPG if the default stabilization
+      // is used. The hessians are always included in the residual, as in the
+      // assemblers.
+      const auto stabilization =
+        this->simulation_parameters.stabilization.use_default_stabilization ?
+          Parameters::Stabilization::NavierStokesStabilization::pspg_supg :
+          this->simulation_parameters.stabilization.stabilization;
+
+      setup_matrix_free_residual_dofs();
+
+      residual_operator->clear();
+      residual_operator->reinit(
+        *this->mapping,
+        residual_dof_handler,
+        residual_zero_constraints,
+        *this->cell_quadrature,
+        forcing_function,
+        this->simulation_parameters.physical_properties_manager
+          .get_kinematic_viscosity_scale(),
+        stabilization,
+        numbers::invalid_unsigned_int,
+        this->simulation_control,
+        this->simulation_parameters.boundary_conditions,
+        false,
+        true);
+
+      residual_operator->initialize_dof_vector(residual_evaluation_point);
+      residual_operator->initialize_dof_vector(residual_vector);
+      residual_operator->initialize_dof_vector(residual_time_derivative);
+      residual_time_derivative_time = std::numeric_limits<double>::quiet_NaN();
+    }
 
   if (this->simulation_parameters.post_processing
         .calculate_average_velocities ||
@@ -164,6 +273,16 @@ FluidDynamicsMatrixBased<dim>::setup_dofs_fd()
   this->pcout << "   Volume of triangulation:      " << global_volume
               << std::endl;
 
+  timer.stop();
+  const auto mesh_adaptation_verbosity =
+    this->simulation_parameters.mesh_adaptation.verbosity;
+  if (mesh_adaptation_verbosity != Parameters::Verbosity::quiet)
+    this->pcout << "   Matrix structure:             "
+                << (reuse_matrix_structure ? "reused" : "rebuilt")
+                << std::endl;
+  if (mesh_adaptation_verbosity == Parameters::Verbosity::extra_verbose)
+    this->pcout << "   Time spent in the setup of the DoFs: "
+                << timer.wall_time() << "s" << std::endl;
 
   // Provide the fluid dynamics dof_handler and present solution to the
   // multiphysics interface
@@ -175,6 +294,67 @@ FluidDynamicsMatrixBased<dim>::setup_dofs_fd()
                                              &this->previous_solutions);
 }
 
+template <int dim>
+bool
+FluidDynamicsMatrixBased<dim>::matrix_structure_is_unchanged()
+{
+  // The structure of the matrix only depends on the partition of the DoFs,
+  // on the DoFs of the locally owned and ghost cells and on the constraints
+  // of the locally relevant DoFs. The number of DoFs, the number of cells and
+  // the partition are compared first, then the DoFs of the cells and the
+  // constraints are compared exactly with the ones of the previous call. They
+  // are always gathered since they are needed by the next call.
+  const types::global_dof_index n_dofs = this->dof_handler.n_dofs();
+  const unsigned int n_active_cells    = this->triangulation->n_active_cells();
+  const bool         invariants_unchanged =
+    system_matrix.m() == n_dofs && matrix_structure_n_dofs == n_dofs &&
+    matrix_structure_n_active_cells == n_active_cells &&
+    matrix_structure_locally_owned_dofs == this->locally_owned_dofs &&
+    matrix_structure_locally_relevant_dofs == this->locally_relevant_dofs;
+
+  const AffineConstraints<double> &constraints =
+    this->get_nonzero_constraints();
+
+  std::vector<types::global_dof_index> structure;
+  structure.reserve(n_active_cells * this->fe->n_dofs_per_cell() +
+                    2 * constraints.n_constraints());
+
+  std::vector<types::global_dof_index> local_dof_indices(
+    this->fe->n_dofs_per_cell());
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_artificial())
+        continue;
+
+      cell->get_dof_indices(local_dof_indices);
+      structure.insert(structure.end(),
+                       local_dof_indices.begin(),
+                       local_dof_indices.end());
+    }
+
+  for (const auto &line : constraints.get_lines())
+    {
+      structure.push_back(line.index);
+      structure.push_back(line.entries.size());
+      for (const auto &entry : line.entries)
+        structure.push_back(entry.first);
+    }
+
+  const bool locally_unchanged =
+    invariants_unchanged && structure == matrix_structure;
+
+  matrix_structure_n_dofs                = n_dofs;
+  matrix_structure_n_active_cells        = n_active_cells;
+  matrix_structure_locally_owned_dofs    = this->locally_owned_dofs;
+  matrix_structure_locally_relevant_dofs = this->locally_relevant_dofs;
+  matrix_structure                       = std::move(structure);
+
+  // The system matrix is distributed and its construction is collective. Its
+  // structure can only be reused if it is unchanged on every process.
+  return Utilities::MPI::min(static_cast<unsigned int>(locally_unchanged),
+                             this->mpi_communicator) == 1;
+}
+
 template <int dim>
 void
 FluidDynamicsMatrixBased<dim>::update_multiphysics_time_average_solution()
@@ -592,6 +772,45 @@ FluidDynamicsMatrixBased<dim>::setup_assemblers()
   if (!this->simulation_parameters.multiphysics.VOF &&
       !this->simulation_parameters.multiphysics.cahn_hilliard)
     {
+      // The BDF and core assemblers of the transient flows of Newtonian fluids
+      // with a constant density and no velocity source are fused into a
+      // single loop over the quadrature points
+      const auto &properties =
+        this->simulation_parameters.physical_properties_manager;
+      const auto &stabilization = this->simulation_parameters.stabilization;
+      if (this->simulation_parameters.fem_parameters.enable_fused_assembly &&
+          is_bdf(this->simulation_control->get_assembly_method()) &&
+          properties.density_is_constant() && !properties.is_non_newtonian() &&
+          this->simulation_parameters.velocity_sources.rotating_frame_type ==
+            Parameters::VelocitySource::RotatingFrameType::none &&
+          this->simulation_parameters.velocity_sources.darcy_type ==
+            Parameters::VelocitySource::DarcySourceType::none)
+        {
+          if (stabilization.use_default_stabilization ||
+              stabilization.stabilization ==
+                Parameters::Stabilization::NavierStokesStabilization::pspg_supg)
+            {
+              this->assemblers.emplace_back(
+                std::make_shared<NavierStokesAssemblerPipeline<
+                  dim,
+                  GLSNavierStokesAssemblerBDF<dim>,
+                  PSPGSUPGNavierStokesAssemblerCore<dim>>>(
+                  this->simulation_control));
+              return;
+            }
+          if (stabilization.stabilization ==
+              Parameters::Stabilization::NavierStokesStabilization::gls)
+            {
+              this->assemblers.emplace_back(
+                std::make_shared<NavierStokesAssemblerPipeline<
+                  dim,
+                  GLSNavierStokesAssemblerBDF<dim>,
+                  GLSNavierStokesAssemblerCore<dim>>>(
+                  this->simulation_control));
+              return;
+            }
+        }
+
       // Time-stepping schemes
       if (is_bdf(this->simulation_control->get_assembly_method()))
         {
@@ -708,6 +927,9 @@ FluidDynamicsMatrixBased<dim>::assemble_system_matrix()
     *this->mapping,
     *this->face_quadrature);
 
+  if (shape_data_cache)
+    scratch_data.enable_shape_data_cache(shape_data_cache);
+
   if (this->simulation_parameters.multiphysics.VOF)
     {
       const DoFHandler<dim> *dof_handler_vof =
@@ -755,9 +977,9 @@ FluidDynamicsMatrixBased<dim>::assemble_system_matrix()
                                         *this->mapping);
     }
 
-  WorkStream::run(
-    this->dof_handler.begin_active(),
-    this->dof_handler.end(),
+  run_cell_assembly(
+    this->dof_handler,
+    assembly_coloring.get(),
     *this,
     &FluidDynamicsMatrixBased::assemble_local_system_matrix,
     &FluidDynamicsMatrixBased::copy_local_matrix_to_global_matrix,
@@ -766,6 +988,37 @@ FluidDynamicsMatrixBased<dim>::assemble_system_matrix()
                                          this->cell_quadrature->size()));
 
   system_matrix.compress(VectorOperation::add);
+  register_system_matrix_assembly();
+}
+
+template <int dim>
+void
+FluidDynamicsMatrixBased<dim>::register_system_matrix_assembly()
+{
+  system_matrix_is_jacobian = true;
+  jacobian_assembly_method  = this->simulation_control->get_assembly_method();
+  jacobian_bdf_coefficients = this->simulation_control->get_bdf_coefficients();
+}
+
+template <int dim>
+bool
+FluidDynamicsMatrixBased<dim>::system_matrix_is_outdated()
+{
+  if (!system_matrix_is_jacobian ||
+      jacobian_assembly_method !=
+        this->simulation_control->get_assembly_method())
+    return true;
+
+  // The BDF coefficients change with the time step and with the order of the
+  // scheme during the start-up of the simulation.
+  if (jacobian_assembly_method ==
+      Parameters::SimulationControl::TimeSteppingMethod::steady)
+    return false;
+
+  const Vector<double> &bdf_coefficients =
+    this->simulation_control->get_bdf_coefficients();
+  return bdf_coefficients.size() != jacobian_bdf_coefficients.size() ||
+         bdf_coefficients != jacobian_bdf_coefficients;
 }
 
 template <int dim>
@@ -906,6 +1159,12 @@ template <int dim>
 void
 FluidDynamicsMatrixBased<dim>::assemble_system_rhs()
 {
+  if (use_matrix_free_residual)
+    {
+      assemble_system_rhs_matrix_free();
+      return;
+    }
+
   TimerOutput::Scope t(this->computing_timer, "Assemble RHS");
 
   this->system_rhs = 0;
@@ -919,6 +1178,9 @@ FluidDynamicsMatrixBased<dim>::assemble_system_rhs()
     *this->mapping,
     *this->face_quadrature);
 
+  if (shape_data_cache)
+    scratch_data.enable_shape_data_cache(shape_data_cache);
+
   if (this->simulation_parameters.multiphysics.VOF)
     {
       const DoFHandler<dim> *dof_handler_vof =
@@ -968,9 +1230,9 @@ FluidDynamicsMatrixBased<dim>::assemble_system_rhs()
                                         *this->mapping);
     }
 
-  WorkStream::run(
-    this->dof_handler.begin_active(),
-    this->dof_handler.end(),
+  run_cell_assembly(
+    this->dof_handler,
+    assembly_coloring.get(),
     *this,
     &FluidDynamicsMatrixBased::assemble_local_system_rhs,
     &FluidDynamicsMatrixBased::copy_local_rhs_to_global_rhs,
@@ -985,6 +1247,219 @@ FluidDynamicsMatrixBased<dim>::assemble_system_rhs()
 }
 
 
+template <int dim>
+bool
+FluidDynamicsMatrixBased<dim>::matrix_free_residual_is_supported()
+{
+  const auto &parameters = this->simulation_parameters;
+  const auto &properties = parameters.physical_properties_manager;
+
+  // Boundary conditions imposed through face integrals
+  for (const auto type : {BoundaryConditions::BoundaryType::function_weak,
+                          BoundaryConditions::BoundaryType::partial_slip,
+                          BoundaryConditions::BoundaryType::outlet,
+                          BoundaryConditions::BoundaryType::pressure})
+    if (this->check_existance_of_bc(type))
+      return false;
+
+  // Additional physics or assemblers
+  if (parameters.multiphysics.VOF || parameters.multiphysics.cahn_hilliard ||
+      parameters.multiphysics.heat_transfer ||
+      parameters.multiphysics.buoyancy_force || parameters.ale.enabled() ||
+      parameters.velocity_sources.rotating_frame_type !=
+        Parameters::VelocitySource::RotatingFrameType::none ||
+      parameters.velocity_sources.darcy_type !=
+        Parameters::VelocitySource::DarcySourceType::none)
+    return false;
+
+  // Physical properties
+  if (properties.is_non_newtonian() || !properties.density_is_constant() ||
+      properties.get_number_of_fluids() > 1 ||
+      properties.get_number_of_solids() > 0)
+    return false;
+
+  // Stabilization and time-stepping method
+  const auto method = parameters.simulation_control.method;
+  if ((!parameters.stabilization.use_default_stabilization &&
+       parameters.stabilization.stabilization !=
+         Parameters::Stabilization::NavierStokesStabilization::pspg_supg &&
+       parameters.stabilization.stabilization !=
+         Parameters::Stabilization::NavierStokesStabilization::gls) ||
+      parameters.stabilization.pressure_scaling_factor != 1. ||
+      (!is_bdf(method) &&
+       method != Parameters::SimulationControl::TimeSteppingMethod::steady))
+    return false;
+
+  // Discretization
+  return !parameters.mesh.simplex &&
+         parameters.fem_parameters.velocity_order ==
+           parameters.fem_parameters.pressure_order;
+}
+
+template <int dim>
+void
+FluidDynamicsMatrixBased<dim>::setup_matrix_free_residual_dofs()
+{
+  // The FEEvaluation of the operator spans a single base element. The
+  // velocity and the pressure have the same order, so both FE systems share
+  // the same base element and only differ by the ordering of the DoFs.
+  if (!residual_fe)
+    residual_fe = std::make_shared<FESystem<dim>>(
+      FE_Q<dim>(this->simulation_parameters.fem_parameters.velocity_order),
+      dim + 1);
+
+  residual_dof_handler.reinit(*this->triangulation);
+  residual_dof_handler.distribute_dofs(*residual_fe);
+
+  const IndexSet residual_locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(residual_dof_handler);
+
+  // Map the locally relevant DoFs of the system matrix to the DoFs of the
+  // operator through the component and the base element index of the shape
+  // functions
+  std::vector<types::global_dof_index> relevant_dof_indices(
+    this->locally_relevant_dofs.n_elements(), numbers::invalid_dof_index);
+  std::vector<types::global_dof_index> local_dof_indices(
+    this->fe->n_dofs_per_cell());
+  std::vector<types::global_dof_index> residual_local_dof_indices(
+    residual_fe->n_dofs_per_cell());
+
+  for (const auto &cell : this->dof_handler.active_cell_iterators())
+    {
+      if (cell->is_artificial())
+        continue;
+
+      typename DoFHandler<dim>::active_cell_iterator residual_cell(
+        &(*(this->triangulation)),
+        cell->level(),
+        cell->index(),
+        &residual_dof_handler);
+
+      cell->get_dof_indices(local_dof_indices);
+      residual_cell->get_dof_indices(residual_local_dof_indices);
+
+      for (unsigned int i = 0; i < local_dof_indices.size(); ++i)
+        {
+          const auto component_and_index =
+            this->fe->system_to_component_index(i);
+          relevant_dof_indices[this->locally_relevant_dofs.index_within_set(
+            local_dof_indices[i])] =
+            residual_local_dof_indices[residual_fe->component_to_system_index(
+              component_and_index.first, component_and_index.second)];
+        }
+    }
+
+  // Both DoF handlers assign the DoFs shared by several cells to the same
+  // process, so the locally owned DoFs are mapped to locally owned DoFs
+  residual_dof_indices.clear();
+  residual_dof_indices.reserve(this->locally_owned_dofs.n_elements());
+  for (const auto index : this->locally_owned_dofs)
+    {
+      residual_dof_indices.push_back(
+        relevant_dof_indices[this->locally_relevant_dofs.index_within_set(
+          index)]);
+      Assert(residual_dof_handler.locally_owned_dofs().is_element(
+               residual_dof_indices.back()),
+             ExcInternalError());
+    }
+
+  // The zero constraints of the system matrix are renumbered to the DoFs of
+  // the operator
+  residual_zero_constraints.clear();
+  residual_zero_constraints.reinit(residual_locally_relevant_dofs);
+  for (const auto &line : this->zero_constraints.get_lines())
+    {
+      if (!this->locally_relevant_dofs.is_element(line.index))
+        continue;
+
+      const auto residual_index =
+        relevant_dof_indices[this->locally_relevant_dofs.index_within_set(
+          line.index)];
+      residual_zero_constraints.add_line(residual_index);
+      for (const auto &entry : line.entries)
+        {
+          Assert(this->locally_relevant_dofs.is_element(entry.first),
+                 ExcInternalError());
+          residual_zero_constraints.add_entry(
+            residual_index,
+            relevant_dof_indices[this->locally_relevant_dofs.index_within_set(
+              entry.first)],
+            entry.second);
+        }
+      residual_zero_constraints.set_inhomogeneity(residual_index,
+                                                  line.inhomogeneity);
+    }
+  residual_zero_constraints.close();
+}
+
+template <int dim>
+void
+FluidDynamicsMatrixBased<dim>::assemble_system_rhs_matrix_free()
+{
+  TimerOutput::Scope t(this->computing_timer, "Assemble RHS");
+
+  // The forcing term and the time derivative of the previous solutions only
+  // change at the beginning of a time step
+  const double time = this->simulation_control->get_current_time();
+  if (time != residual_time_derivative_time)
+    {
+      if (this->simulation_parameters.source_term.enable)
+        residual_operator->compute_forcing_term();
+
+      const auto method = this->simulation_control->get_assembly_method();
+      if (is_bdf(method))
+        {
+          const Vector<double> &bdf_coefs =
+            this->simulation_control->get_bdf_coefficients();
+
+          MFVectorType previous_solution;
+          residual_operator->initialize_dof_vector(previous_solution);
+
+          residual_time_derivative = 0;
+          for (unsigned int p = 0; p < number_of_previous_solutions(method);
+               ++p)
+            {
+              unsigned int i = 0;
+              for (const auto index : this->locally_owned_dofs)
+                previous_solution(residual_dof_indices[i++]) =
+                  this->previous_solutions[p](index);
+              residual_time_derivative.add(bdf_coefs[p + 1], previous_solution);
+            }
+
+          residual_time_derivative.update_ghost_values();
+          residual_operator->evaluate_time_derivative_previous_solutions(
+            residual_time_derivative);
+        }
+
+      residual_time_derivative_time = time;
+    }
+
+  residual_operator->update_beta_force(this->flow_control.get_beta());
+
+  // The values of the evaluation point and the stabilization parameters are
+  // stored at the quadrature points, as for the jacobian of the matrix-free
+  // solver
+  unsigned int i = 0;
+  for (const auto index : this->locally_owned_dofs)
+    residual_evaluation_point(residual_dof_indices[i++]) =
+      this->evaluation_point(index);
+  residual_evaluation_point.update_ghost_values();
+
+  residual_operator->evaluate_non_linear_term_and_calculate_tau(
+    residual_evaluation_point);
+  residual_operator->evaluate_residual(residual_vector,
+                                       residual_evaluation_point);
+
+  // The assemblers provide minus the residual
+  i = 0;
+  for (const auto index : this->locally_owned_dofs)
+    this->system_rhs(index) = -residual_vector(residual_dof_indices[i++]);
+  this->system_rhs.compress(VectorOperation::insert);
+
+  if (this->simulation_control->is_first_assembly())
+    this->simulation_control->provide_residual(this->system_rhs.l2_norm());
+}
+
 template <int dim>
 void
 FluidDynamicsMatrixBased<dim>::assemble_local_system_rhs(
@@ -1315,8 +1790,9 @@ template <int dim>
 void
 FluidDynamicsMatrixBased<dim>::assemble_L2_projection()
 {
-  system_matrix    = 0;
-  this->system_rhs = 0;
+  system_matrix             = 0;
+  this->system_rhs          = 0;
+  system_matrix_is_jacobian = false;
   FEValues<dim>               fe_values(*this->mapping,
                           *this->fe,
                           *this->cell_quadrature,
@@ -1483,6 +1959,23 @@ FluidDynamicsMatrixBased<dim>::setup_AMG()
 {
   TimerOutput::Scope t(this->computing_timer, "setup_AMG");
 
+  const bool reuse_hierarchy =
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+      .amg_reuse_hierarchy;
+
+  // The preconditioner is cleared every time the DoFs are set up, so an
+  // existing preconditioner was built on the current sparsity pattern. Its
+  // aggregates are kept and only the prolongators, the level matrices and the
+  // smoothers are recomputed from the new values of the system matrix. The
+  // hierarchy is rebuilt if the fill level of the smoothers was increased
+  // after a failure of the linear solver.
+  if (reuse_hierarchy && amg_preconditioner &&
+      amg_hierarchy_fill_level == current_preconditioner_fill_level)
+    {
+      amg_preconditioner->reinit();
+      return;
+    }
+
   // Constant modes for velocity
   std::vector<std::vector<bool>> constant_modes;
 
@@ -1546,8 +2039,15 @@ FluidDynamicsMatrixBased<dim>::setup_AMG()
   parameter_ml.set("coarse: ifpack level-of-fill", ilu_fill);
   parameter_ml.set("coarse: ifpack absolute threshold", ilu_atol);
   parameter_ml.set("coarse: ifpack relative threshold", ilu_rtol);
+
+  // ML only keeps the information required to recompute the preconditioner
+  // with the same aggregates if it is asked to
+  if (reuse_hierarchy)
+    parameter_ml.set("reuse: enable", true);
+
   amg_preconditioner = std::make_shared<TrilinosWrappers::PreconditionAMG>();
   amg_preconditioner->initialize(system_matrix, parameter_ml);
+  amg_hierarchy_fill_level = current_preconditioner_fill_level;
 }
 
 template <int dim>
@@ -23,11 +23,16 @@
 #include <solvers/fluid_dynamics_matrix_free.h>
 
 #include <deal.II/base/multithread_info.h>
+#include <deal.II/base/quadrature_lib.h>
 
 #include <deal.II/dofs/dof_tools.h>
 
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_tools.h>
+
 #include <deal.II/grid/grid_tools.h>
 
+#include <deal.II/lac/lapack_full_matrix.h>
 #include <deal.II/lac/precondition.h>
 #include <deal.II/lac/solver_cg.h>
 #include <deal.II/lac/solver_gmres.h>
@@ -248,8 +253,8 @@ public:
 
     for (unsigned int b = 0; b < blocks.size(); ++b)
       {
-        this->blocks[b] =
-          LAPACKFullMatrix<double>(blocks[b].m(), blocks[b].n());
+        this->blocks[b] = LAPACKFullMatrix<typename VectorType::value_type>(
+          blocks[b].m(), blocks[b].n());
         this->blocks[b] = blocks[b];
         this->blocks[b].compute_lu_factorization();
       }
@@ -303,7 +308,7 @@ public:
       src_internal.copy_locally_owned_data_from(src);
     src_ptr.update_ghost_values();
 
-    Vector<double> vector_src, vector_dst, vector_weights;
+    Vector<Number> vector_src, vector_dst, vector_weights;
 
     for (unsigned int c = 0; c < patches.size(); ++c)
       {
@@ -367,6 +372,482 @@ private:
   mutable VectorType src_internal;
 };
 
+/**
+ * @brief A vertex-star patch preconditioner. A patch gathers the DoFs that
+ * lie strictly inside the 2^dim cells sharing an interior vertex. On each
+ * patch, every component of the operator is approximated by the separable
+ * operator \f$ \sigma (K + \gamma M) \f$, where \f$ K \f$ and \f$ M \f$ are
+ * the tensor products of the one-dimensional stiffness and mass matrices of
+ * the cells of the patch. Since the one-dimensional matrices account for the
+ * size of the cells in each direction, the local solvers remain accurate on
+ * stretched cells. The separable operators are inverted with the fast
+ * diagonalization method, i.e., with the eigendecompositions of the
+ * one-dimensional problems applied with sum factorization. The scaling
+ * \f$ \sigma \f$ matches the diagonal of the level operator on the patch,
+ * while the advection and the velocity-pressure coupling are left to the
+ * smoother iterations. DoFs that do not belong to any patch are
+ * preconditioned with the inverse diagonal.
+ */
+template <typename VectorType>
+class PreconditionVertexPatch : public PreconditionBase<VectorType>
+{
+public:
+  /// Value type.
+  using Number = typename VectorType::value_type;
+
+  /**
+   * @brief Identify the vertex patches and compute the eigendecompositions of
+   * their one-dimensional problems. These only depend on the mesh and are
+   * therefore computed once.
+   *
+   * @param[in] dof_handler DoFHandler of the level, with FE_Q elements.
+   * @param[in] constraints Constraints of the level.
+   * @param[in] partitioner Partitioner of the level vectors.
+   */
+  template <int dim, typename ConstraintNumber>
+  void
+  initialize(
+    const DoFHandler<dim>                     &dof_handler,
+    const AffineConstraints<ConstraintNumber> &constraints,
+    const std::shared_ptr<const Utilities::MPI::Partitioner> &partitioner)
+  {
+    this->timer.enter_subsection("patch::indices");
+
+    const auto        &fe     = dof_handler.get_fe();
+    const unsigned int degree = fe.degree;
+
+    AssertThrow(
+      dynamic_cast<const FE_Q<dim> *>(&fe.base_element(0)) != nullptr,
+      ExcMessage("The vertex patch smoother requires FE_Q elements."));
+
+    n_dims       = dim;
+    n_components = fe.n_components();
+    n_1d         = 2 * degree - 1;
+    n_patch_dofs = Utilities::pow(n_1d, dim);
+
+    const unsigned int n_nodes_1d    = 2 * degree + 1;
+    const unsigned int n_patch_nodes = Utilities::pow(n_nodes_1d, dim);
+
+    const std::vector<unsigned int> hierarchic_to_lexicographic =
+      FETools::hierarchic_to_lexicographic_numbering<dim>(degree);
+
+    // Gather the cells around each vertex
+    std::map<unsigned int,
+             std::vector<
+               std::pair<typename DoFHandler<dim>::active_cell_iterator,
+                         unsigned int>>>
+      vertex_to_cells;
+
+    for (const auto &cell : dof_handler.active_cell_iterators())
+      if (cell->is_locally_owned() || cell->is_ghost())
+        for (const auto v : cell->vertex_indices())
+          vertex_to_cells[cell->vertex_index(v)].emplace_back(cell, v);
+
+    patches.clear();
+    cell_lengths.clear();
+
+    std::vector<types::global_dof_index> local_dof_indices(
+      fe.n_dofs_per_cell());
+    std::vector<types::global_dof_index> patch_dofs(n_components *
+                                                    n_patch_nodes);
+
+    for (const auto &[vertex, cells] : vertex_to_cells)
+      {
+        (void)vertex;
+
+        // Only the vertices surrounded by 2^dim locally owned cells define a
+        // patch
+        if (cells.size() != GeometryInfo<dim>::vertices_per_cell)
+          continue;
+
+        bool              valid = true;
+        std::vector<bool> position_used(cells.size(), false);
+
+        // Sum of the lengths of the cells before and after the vertex
+        std::array<std::array<double, 2>, dim> lengths{};
+
+        std::fill(patch_dofs.begin(),
+                  patch_dofs.end(),
+                  numbers::invalid_dof_index);
+
+        for (const auto &[cell, v] : cells)
+          {
+            if (!cell->is_locally_owned())
+              {
+                valid = false;
+                break;
+              }
+
+            // Position of the cell within the patch, a bit is set if the cell
+            // lies after the vertex in the corresponding direction
+            unsigned int position = 0;
+            for (unsigned int d = 0; d < dim; ++d)
+              if ((v & (1U << d)) == 0)
+                position |= (1U << d);
+
+            if (position_used[position])
+              {
+                valid = false;
+                break;
+              }
+            position_used[position] = true;
+
+            for (unsigned int d = 0; d < dim; ++d)
+              lengths[d][(position >> d) & 1U] +=
+                cell->vertex(v ^ (1U << d)).distance(cell->vertex(v));
+
+            // Place the DoFs of the cell in the lexicographic numbering of
+            // the patch. The DoFs shared by two cells must match, which
+            // rules out cells that are not consistently oriented.
+            cell->get_dof_indices(local_dof_indices);
+            for (unsigned int i = 0; i < local_dof_indices.size(); ++i)
+              {
+                const auto [component, base_index] =
+                  fe.system_to_component_index(i);
+
+                unsigned int lexicographic =
+                  hierarchic_to_lexicographic[base_index];
+                unsigned int node   = 0;
+                unsigned int stride = 1;
+                for (unsigned int d = 0; d < dim; ++d)
+                  {
+                    node += (((position >> d) & 1U) * degree +
+                             lexicographic % (degree + 1)) *
+                            stride;
+                    lexicographic /= (degree + 1);
+                    stride *= n_nodes_1d;
+                  }
+
+                auto &patch_dof = patch_dofs[component * n_patch_nodes + node];
+                if (patch_dof == numbers::invalid_dof_index)
+                  patch_dof = local_dof_indices[i];
+                else if (patch_dof != local_dof_indices[i])
+                  valid = false;
+              }
+          }
+
+        if (!valid)
+          continue;
+
+        // Keep the DoFs strictly inside the patch, component by component
+        std::vector<unsigned int> indices;
+        indices.reserve(n_components * n_patch_dofs);
+        for (unsigned int c = 0; c < n_components && valid; ++c)
+          for (unsigned int q = 0; q < n_patch_dofs; ++q)
+            {
+              unsigned int node   = 0;
+              unsigned int stride = 1;
+              for (unsigned int d = 0, r = q; d < dim; ++d, r /= n_1d)
+                {
+                  node += (r % n_1d + 1) * stride;
+                  stride *= n_nodes_1d;
+                }
+
+              const auto dof = patch_dofs[c * n_patch_nodes + node];
+              if (dof == numbers::invalid_dof_index ||
+                  constraints.is_constrained(dof) ||
+                  !partitioner->in_local_range(dof))
+                {
+                  valid = false;
+                  break;
+                }
+              indices.emplace_back(partitioner->global_to_local(dof));
+            }
+
+        if (!valid)
+          continue;
+
+        patches.emplace_back(std::move(indices));
+        for (unsigned int d = 0; d < dim; ++d)
+          for (unsigned int side = 0; side < 2; ++side)
+            cell_lengths.emplace_back(lengths[d][side] /
+                                      (cells.size() / 2));
+      }
+
+    // Weights of the overlapping patches. A zero weight identifies the DoFs
+    // that are not part of any patch.
+    weights.reinit(partitioner);
+    for (const auto &patch : patches)
+      for (const auto i : patch)
+        weights.local_element(i) += 1.0;
+    for (unsigned int i = 0; i < weights.locally_owned_size(); ++i)
+      if (weights.local_element(i) > 0.0)
+        weights.local_element(i) = 1.0 / weights.local_element(i);
+
+    this->timer.leave_subsection("patch::indices");
+    this->timer.enter_subsection("patch::eigendecomposition");
+
+    // One-dimensional mass and stiffness matrices of the reference cell in
+    // lexicographic order
+    const FE_Q<1>                   fe_1d(degree);
+    const QGauss<1>                 quadrature_1d(degree + 1);
+    const std::vector<unsigned int> hierarchic_to_lexicographic_1d =
+      FETools::hierarchic_to_lexicographic_numbering<1>(degree);
+
+    FullMatrix<double> reference_mass(degree + 1, degree + 1);
+    FullMatrix<double> reference_stiffness(degree + 1, degree + 1);
+    for (unsigned int q = 0; q < quadrature_1d.size(); ++q)
+      for (unsigned int i = 0; i < degree + 1; ++i)
+        for (unsigned int j = 0; j < degree + 1; ++j)
+          {
+            const auto &point = quadrature_1d.point(q);
+            const auto  li    = hierarchic_to_lexicographic_1d[i];
+            const auto  lj    = hierarchic_to_lexicographic_1d[j];
+
+            reference_mass(li, lj) += fe_1d.shape_value(i, point) *
+                                      fe_1d.shape_value(j, point) *
+                                      quadrature_1d.weight(q);
+            reference_stiffness(li, lj) += fe_1d.shape_grad(i, point)[0] *
+                                           fe_1d.shape_grad(j, point)[0] *
+                                           quadrature_1d.weight(q);
+          }
+
+    // Generalized eigenvalue problems K s = lambda M s of the interior of
+    // the patch in each direction. The eigenvectors are M-orthonormal.
+    const unsigned int n_patches = patches.size();
+    eigenvalues.resize(n_patches * dim * n_1d);
+    eigenvectors.resize(n_patches * dim * n_1d * n_1d);
+    mass_diagonals.resize(n_patches * dim * n_1d);
+    stiffness_diagonals.resize(n_patches * dim * n_1d);
+
+    for (unsigned int p = 0; p < n_patches; ++p)
+      for (unsigned int d = 0; d < dim; ++d)
+        {
+          LAPACKFullMatrix<double> mass(n_1d, n_1d);
+          LAPACKFullMatrix<double> stiffness(n_1d, n_1d);
+
+          for (unsigned int side = 0; side < 2; ++side)
+            {
+              const double h = cell_lengths[(p * dim + d) * 2 + side];
+              for (unsigned int i = 0; i < degree + 1; ++i)
+                for (unsigned int j = 0; j < degree + 1; ++j)
+                  {
+                    // Skip the nodes on the boundary of the patch
+                    const int ii = side * degree + i - 1;
+                    const int jj = side * degree + j - 1;
+                    if (ii < 0 || jj < 0 || ii >= static_cast<int>(n_1d) ||
+                        jj >= static_cast<int>(n_1d))
+                      continue;
+
+                    mass(ii, jj) += h * reference_mass(i, j);
+                    stiffness(ii, jj) += reference_stiffness(i, j) / h;
+                  }
+            }
+
+          const unsigned int offset = (p * dim + d) * n_1d;
+          for (unsigned int i = 0; i < n_1d; ++i)
+            {
+              mass_diagonals[offset + i]      = mass(i, i);
+              stiffness_diagonals[offset + i] = stiffness(i, i);
+            }
+
+          std::vector<Vector<double>> vectors(n_1d, Vector<double>(n_1d));
+          stiffness.compute_generalized_eigenvalues_symmetric(mass, vectors);
+
+          for (unsigned int j = 0; j < n_1d; ++j)
+            {
+              eigenvalues[offset + j] = stiffness.eigenvalue(j).real();
+              for (unsigned int i = 0; i < n_1d; ++i)
+                eigenvectors[(offset + i) * n_1d + j] = vectors[j][i];
+            }
+        }
+
+    this->timer.leave_subsection("patch::eigendecomposition");
+  }
+
+  /**
+   * @brief Update the scaling of the patch operators and the inverse
+   * diagonal. Must be called every time the level operator changes.
+   *
+   * @param[in] inverse_diagonal Inverse of the diagonal of the level operator.
+   * @param[in] velocity_mass_ratio Ratio between the coefficient of the time
+   * derivative and the kinematic viscosity, zero for steady simulations.
+   */
+  void
+  update(const VectorType &inverse_diagonal, const double velocity_mass_ratio)
+  {
+    this->timer.enter_subsection("patch::update");
+
+    this->inverse_diagonal = inverse_diagonal;
+
+    // Only the velocity components contain a time derivative
+    mass_ratios.assign(n_components, velocity_mass_ratio);
+    mass_ratios.back() = 0.0;
+
+    scalings.resize(patches.size() * n_components);
+    for (unsigned int p = 0; p < patches.size(); ++p)
+      for (unsigned int c = 0; c < n_components; ++c)
+        {
+          double operator_diagonal  = 0.0;
+          double separable_diagonal = 0.0;
+
+          for (unsigned int q = 0; q < n_patch_dofs; ++q)
+            {
+              operator_diagonal +=
+                1.0 / inverse_diagonal.local_element(
+                        patches[p][c * n_patch_dofs + q]);
+
+              double mass      = 1.0;
+              double stiffness = 0.0;
+              for (unsigned int d = 0, r = q; d < n_dims; ++d, r /= n_1d)
+                {
+                  const unsigned int i = (p * n_dims + d) * n_1d + r % n_1d;
+                  stiffness = stiffness * mass_diagonals[i] +
+                              mass * stiffness_diagonals[i];
+                  mass *= mass_diagonals[i];
+                }
+
+              separable_diagonal += stiffness + mass_ratios[c] * mass;
+            }
+
+          Assert(operator_diagonal > 0.0,
+                 ExcMessage("The vertex patch smoother requires a positive "
+                            "diagonal of the level operator."));
+
+          scalings[p * n_components + c] =
+            operator_diagonal / separable_diagonal;
+        }
+
+    this->timer.leave_subsection("patch::update");
+  }
+
+  /**
+   * @brief Apply preconditioner.
+   *
+   * @param[in,out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const override
+  {
+    this->timer.enter_subsection("patch::vmult");
+
+    for (unsigned int i = 0; i < dst.locally_owned_size(); ++i)
+      dst.local_element(i) =
+        (weights.local_element(i) == Number(0.0)) ?
+          inverse_diagonal.local_element(i) * src.local_element(i) :
+          Number(0.0);
+
+    std::vector<Number> values(n_patch_dofs), tmp(n_patch_dofs);
+
+    for (unsigned int p = 0; p < patches.size(); ++p)
+      for (unsigned int c = 0; c < n_components; ++c)
+        {
+          const unsigned int *indices = patches[p].data() + c * n_patch_dofs;
+
+          for (unsigned int q = 0; q < n_patch_dofs; ++q)
+            values[q] = src.local_element(indices[q]);
+
+          // Transform to the eigenbasis, scale with the inverse of the
+          // eigenvalues of the separable operator and transform back
+          apply_eigenvectors(p, true, values, tmp);
+
+          for (unsigned int q = 0; q < n_patch_dofs; ++q)
+            {
+              double lambda = mass_ratios[c];
+              for (unsigned int d = 0, r = q; d < n_dims; ++d, r /= n_1d)
+                lambda += eigenvalues[(p * n_dims + d) * n_1d + r % n_1d];
+
+              values[q] /= scalings[p * n_components + c] * lambda;
+            }
+
+          apply_eigenvectors(p, false, values, tmp);
+
+          for (unsigned int q = 0; q < n_patch_dofs; ++q)
+            dst.local_element(indices[q]) +=
+              weights.local_element(indices[q]) * values[q];
+        }
+
+    this->timer.leave_subsection("patch::vmult");
+  }
+
+private:
+  /**
+   * @brief Apply the tensor product of the one-dimensional eigenvectors of a
+   * patch, or its transpose, with sum factorization.
+   *
+   * @param[in] patch Index of the patch.
+   * @param[in] transpose Flag to apply the transpose.
+   * @param[in,out] values Values of one component on the patch.
+   * @param[in,out] tmp Temporary storage of the same size.
+   */
+  void
+  apply_eigenvectors(const unsigned int   patch,
+                     const bool           transpose,
+                     std::vector<Number> &values,
+                     std::vector<Number> &tmp) const
+  {
+    const unsigned int n_lines = n_patch_dofs / n_1d;
+
+    for (unsigned int d = 0, stride = 1; d < n_dims; ++d, stride *= n_1d)
+      {
+        const Number *vectors =
+          eigenvectors.data() + (patch * n_dims + d) * n_1d * n_1d;
+
+        for (unsigned int line = 0; line < n_lines; ++line)
+          {
+            const unsigned int offset =
+              (line / stride) * stride * n_1d + line % stride;
+
+            for (unsigned int j = 0; j < n_1d; ++j)
+              {
+                Number sum = 0.0;
+                for (unsigned int i = 0; i < n_1d; ++i)
+                  sum += (transpose ? vectors[i * n_1d + j] :
+                                      vectors[j * n_1d + i]) *
+                         values[offset + i * stride];
+                tmp[offset + j * stride] = sum;
+              }
+          }
+
+        values.swap(tmp);
+      }
+  }
+
+  /// Number of spatial dimensions.
+  unsigned int n_dims;
+
+  /// Number of components.
+  unsigned int n_components;
+
+  /// Number of DoFs of a component inside a patch in each direction.
+  unsigned int n_1d;
+
+  /// Number of DoFs of a component inside a patch.
+  unsigned int n_patch_dofs;
+
+  /// Local DoF indices of the patches, component by component.
+  std::vector<std::vector<unsigned int>> patches;
+
+  /// Mean size of the cells before and after the vertex of the patches in
+  /// each direction.
+  std::vector<double> cell_lengths;
+
+  /// Eigenvalues of the one-dimensional problems of the patches.
+  std::vector<double> eigenvalues;
+
+  /// Eigenvectors of the one-dimensional problems of the patches.
+  std::vector<Number> eigenvectors;
+
+  /// Diagonals of the one-dimensional mass matrices of the patches.
+  std::vector<double> mass_diagonals;
+
+  /// Diagonals of the one-dimensional stiffness matrices of the patches.
+  std::vector<double> stiffness_diagonals;
+
+  /// Ratio between the mass and stiffness terms of each component.
+  std::vector<double> mass_ratios;
+
+  /// Scaling of the separable operators of the patches.
+  std::vector<double> scalings;
+
+  /// Weights of the overlapping patches.
+  VectorType weights;
+
+  /// Inverse diagonal of the level operator.
+  VectorType inverse_diagonal;
+};
+
 /**
  * @brief Helper function that allows to convert deal.II vectors to Trilinos vectors.
  *
@@ -385,6 +866,62 @@ convert_vector_dealii_to_trilinos(
   out.import_elements(rwv, VectorOperation::insert);
 }
 
+/**
+ * @brief A wrapper around the Trilinos preconditioners, which only work with
+ * double precision vectors, so that they can be applied to the level vectors
+ * of the geometric multigrid preconditioner, e.g., within the coarse grid
+ * GMRES solver. Vectors of other number types are converted on the fly.
+ *
+ * @tparam VectorType Type of the vectors the preconditioner is applied to.
+ */
+template <typename VectorType>
+class TrilinosPreconditionerAdapter : public Subscriptor
+{
+public:
+  /**
+   * @brief Constructor.
+   *
+   * @param[in] preconditioner Trilinos preconditioner to be applied.
+   */
+  TrilinosPreconditionerAdapter(
+    const std::shared_ptr<const TrilinosWrappers::PreconditionBase>
+      &preconditioner)
+    : preconditioner(preconditioner)
+  {}
+
+  /**
+   * @brief Apply preconditioner.
+   *
+   * @param[in,out] dst Destination vector holding the result.
+   * @param[in] src Input source vector.
+   */
+  void
+  vmult(VectorType &dst, const VectorType &src) const
+  {
+    if constexpr (std::is_same_v<typename VectorType::value_type, double>)
+      preconditioner->vmult(dst, src);
+    else
+      {
+        src_double = src;
+        dst_double = dst;
+
+        preconditioner->vmult(dst_double, src_double);
+
+        dst = dst_double;
+      }
+  }
+
+private:
+  /// Trilinos preconditioner.
+  std::shared_ptr<const TrilinosWrappers::PreconditionBase> preconditioner;
+
+  /// Source vector converted to double precision.
+  mutable LinearAlgebra::distributed::Vector<double> src_double;
+
+  /// Destination vector converted to double precision.
+  mutable LinearAlgebra::distributed::Vector<double> dst_double;
+};
+
 namespace dealii
 {
   /**
@@ -538,7 +1075,14 @@ namespace dealii
 } // namespace dealii
 
 template <int dim>
-MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
+MFNavierStokesPreconditionGMGBase<dim>::MFNavierStokesPreconditionGMGBase()
+  : pcout(std::cout, Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+  , mg_setup_timer(this->pcout, TimerOutput::never, TimerOutput::wall_times)
+  , mg_vmult_timer(this->pcout, TimerOutput::never, TimerOutput::wall_times)
+{}
+
+template <int dim, typename MGNumber>
+MFNavierStokesPreconditionGMG<dim, MGNumber>::MFNavierStokesPreconditionGMG(
   const SimulationParameters<dim>          &simulation_parameters,
   const DoFHandler<dim>                    &dof_handler,
   const DoFHandler<dim>                    &dof_handler_fe_q_iso_q1,
@@ -546,14 +1090,29 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
   const std::shared_ptr<Quadrature<dim>>   &cell_quadrature,
   const std::shared_ptr<Function<dim>>      forcing_function,
   const std::shared_ptr<SimulationControl> &simulation_control,
-  const std::shared_ptr<FESystem<dim>>      fe)
-  : pcout(std::cout, Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0)
+  const std::shared_ptr<FESystem<dim>>      fe,
+  const std::function<std::shared_ptr<OperatorType>()>
+    &level_operator_factory)
+  : MFNavierStokesPreconditionGMGBase<dim>()
   , simulation_parameters(simulation_parameters)
   , dof_handler(dof_handler)
   , dof_handler_fe_q_iso_q1(dof_handler_fe_q_iso_q1)
-  , mg_setup_timer(this->pcout, TimerOutput::never, TimerOutput::wall_times)
-  , mg_vmult_timer(this->pcout, TimerOutput::never, TimerOutput::wall_times)
 {
+  // The vertex patches are identified on the active cells of the levels,
+  // with the numbering of FE_Q elements
+  AssertThrow(
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+          .mg_smoother_preconditioner_type !=
+        Parameters::LinearSolver::MultigridSmootherPreconditionerType::
+          VertexPatch ||
+      (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+           .preconditioner ==
+         Parameters::LinearSolver::PreconditionerType::gcmg &&
+       !this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+          .mg_use_fe_q_iso_q1),
+    ExcMessage(
+      "The vertex patch smoother is only supported by the gcmg preconditioner without FE_Q_iso_Q1 elements."));
+
   if (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
         .preconditioner == Parameters::LinearSolver::PreconditionerType::lsmg)
     {
@@ -711,10 +1270,8 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
           else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
                    BoundaryConditions::BoundaryType::pressure)
             {
-              Assert(
-                false,
-                ExcMessage(
-                  "Pressure boundary conditions are not supported by the matrix free application."));
+              /*The pressure boundary condition is implemented in
+               * the operators*/
             }
           else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
                    BoundaryConditions::BoundaryType::function_weak)
@@ -725,10 +1282,8 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
           else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
                    BoundaryConditions::BoundaryType::partial_slip)
             {
-              Assert(
-                false,
-                ExcMessage(
-                  "Partial slip boundary conditions are not supported by the matrix free application."));
+              /*The partial slip boundary condition is implemented in
+               * the operators*/
             }
           else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
                    BoundaryConditions::BoundaryType::outlet)
@@ -807,6 +1362,11 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
 
           level_constraints[level].close();
 
+          // The level operators store the constraints in the number type of
+          // the multigrid levels
+          AffineConstraints<MGNumber> mg_level_constraints;
+          mg_level_constraints.copy_from(level_constraints[level]);
+
           this->mg_setup_timer.enter_subsection("Set up operators");
 
           // Provide appropriate quadrature depending on the type of elements of
@@ -824,8 +1384,11 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
               quadrature_mg = QIterated<dim>(QGauss<1>(2), points);
             }
 
-          this->mg_operators[level] =
-            std::make_shared<NavierStokesStabilizedOperator<dim, double>>();
+          if (level_operator_factory)
+            this->mg_operators[level] = level_operator_factory();
+          else
+            this->mg_operators[level] =
+              std::make_shared<NavierStokesStabilizedOperator<dim, MGNumber>>();
 
           this->mg_operators[level]->reinit(
             *mapping,
@@ -835,7 +1398,7 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
              level == this->minlevel) ?
               this->dof_handler_fe_q_iso_q1 :
               this->dof_handler,
-            level_constraints[level],
+            mg_level_constraints,
             quadrature_mg,
             forcing_function,
             this->simulation_parameters.physical_properties_manager
@@ -849,6 +1412,16 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
               .mg_enable_hessians_jacobian,
             true);
 
+          // Recompute the linearization data on the fly on the finest levels
+          // if requested to reduce their memory footprint
+          const int recompute_linearization_level =
+            this->simulation_parameters.linear_solver
+              .at(PhysicsID::fluid_dynamics)
+              .mg_recompute_linearization_level;
+          this->mg_operators[level]->set_recompute_linearization(
+            recompute_linearization_level >= 0 &&
+            static_cast<int>(level) >= recompute_linearization_level);
+
           this->ls_mg_operators[level].initialize(*(this->mg_operators)[level]);
           this->ls_mg_interface_in[level].initialize(
             *(this->mg_operators)[level]);
@@ -1012,12 +1585,16 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
       this->intlevel = (mg_int_level == -1) ? this->minlevel : mg_int_level;
 
       // Local object for constraints of the different levels
-      MGLevelObject<AffineConstraints<typename VectorType::value_type>>
-        constraints;
+      MGLevelObject<AffineConstraints<double>> constraints;
+
+      // Constraints of the different levels in the number type of the
+      // multigrid levels, required by the level operators and transfers
+      MGLevelObject<AffineConstraints<MGNumber>> mg_constraints;
 
       // Resize all multilevel objects according to level
       this->mg_operators.resize(this->minlevel, this->maxlevel);
       constraints.resize(this->minlevel, this->maxlevel);
+      mg_constraints.resize(this->minlevel, this->maxlevel);
       this->transfers.resize(this->minlevel, this->maxlevel);
 
       // Distribute DoFs for each level
@@ -1143,10 +1720,8 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
                          .type[i_bc] ==
                        BoundaryConditions::BoundaryType::pressure)
                 {
-                  Assert(
-                    false,
-                    ExcMessage(
-                      "Pressure boundary conditions are not supported by the matrix free application."));
+                  /*The pressure boundary condition is implemented in
+                   * the operators*/
                 }
               else if (this->simulation_parameters.boundary_conditions
                          .type[i_bc] ==
@@ -1159,10 +1734,8 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
                          .type[i_bc] ==
                        BoundaryConditions::BoundaryType::partial_slip)
                 {
-                  Assert(
-                    false,
-                    ExcMessage(
-                      "Partial slip boundary conditions are not supported by the matrix free application."));
+                  /*The partial slip boundary condition is implemented in
+                   * the operators*/
                 }
               else if (this->simulation_parameters.boundary_conditions
                          .type[i_bc] ==
@@ -1218,6 +1791,8 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
 
           level_constraint.close();
 
+          mg_constraints[level].copy_from(level_constraint);
+
           this->mg_setup_timer.leave_subsection("Set boundary conditions");
 
           this->mg_setup_timer.enter_subsection("Set up operators");
@@ -1242,13 +1817,16 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
               quadrature_mg = QIterated<dim>(QGauss<1>(2), points);
             }
 
-          this->mg_operators[level] =
-            std::make_shared<NavierStokesStabilizedOperator<dim, double>>();
+          if (level_operator_factory)
+            this->mg_operators[level] = level_operator_factory();
+          else
+            this->mg_operators[level] =
+              std::make_shared<NavierStokesStabilizedOperator<dim, MGNumber>>();
 
           this->mg_operators[level]->reinit(
             *mapping,
             level_dof_handler,
-            level_constraint,
+            mg_constraints[level],
             quadrature_mg,
             forcing_function,
             this->simulation_parameters.physical_properties_manager
@@ -1262,6 +1840,16 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
               .mg_enable_hessians_jacobian,
             true);
 
+          // Recompute the linearization data on the fly on the finest levels
+          // if requested to reduce their memory footprint
+          const int recompute_linearization_level =
+            this->simulation_parameters.linear_solver
+              .at(PhysicsID::fluid_dynamics)
+              .mg_recompute_linearization_level;
+          this->mg_operators[level]->set_recompute_linearization(
+            recompute_linearization_level >= 0 &&
+            static_cast<int>(level) >= recompute_linearization_level);
+
           this->mg_setup_timer.leave_subsection("Set up operators");
         }
 
@@ -1271,8 +1859,8 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
       for (unsigned int level = this->minlevel; level < this->maxlevel; ++level)
         this->transfers[level + 1].reinit(this->dof_handlers[level + 1],
                                           this->dof_handlers[level],
-                                          constraints[level + 1],
-                                          constraints[level]);
+                                          mg_constraints[level + 1],
+                                          mg_constraints[level]);
 
       this->mg_transfer_gc = std::make_shared<GCTransferType>(
         this->transfers, [&](const auto l, auto &vec) {
@@ -1287,17 +1875,48 @@ MFNavierStokesPreconditionGMG<dim>::MFNavierStokesPreconditionGMG(
   mg_smoother_preconditioners.resize(this->minlevel, this->maxlevel);
 }
 
-template <int dim>
+template <int dim, typename MGNumber>
+void
+MFNavierStokesPreconditionGMG<dim, MGNumber>::initialize(
+  const std::shared_ptr<SimulationControl> &simulation_control,
+  FlowControl<dim>                         &flow_control,
+  const VectorType                         &present_solution,
+  const VectorType                         &time_derivative_previous_solutions)
+{
+  // Components that may be reused are only rebuilt on the first set up or
+  // if the convergence of the outer solver degraded
+  const bool full_setup = !this->mg || this->rebuild_reused_components;
+
+  update_level_operators(simulation_control,
+                         flow_control,
+                         present_solution,
+                         time_derivative_previous_solutions);
+
+  setup_smoother(simulation_control, full_setup);
+
+  // The multigrid objects refer to the coarse-grid solver, they are created
+  // again only if a new coarse-grid solver was created
+  if (setup_coarse_grid_solver(full_setup))
+    setup_multigrid();
+
+  if (full_setup)
+    {
+      this->rebuild_reused_components  = false;
+      this->reference_outer_iterations = 0;
+    }
+}
+
+template <int dim, typename MGNumber>
 void
-MFNavierStokesPreconditionGMG<dim>::initialize(
+MFNavierStokesPreconditionGMG<dim, MGNumber>::update_level_operators(
   const std::shared_ptr<SimulationControl> &simulation_control,
   FlowControl<dim>                         &flow_control,
   const VectorType                         &present_solution,
   const VectorType                         &time_derivative_previous_solutions)
 {
   // Local objects for the different levels
-  MGLevelObject<VectorType> mg_solution(this->minlevel, this->maxlevel);
-  MGLevelObject<VectorType> mg_time_derivative_previous_solutions(
+  MGLevelObject<MGVectorType> mg_solution(this->minlevel, this->maxlevel);
+  MGLevelObject<MGVectorType> mg_time_derivative_previous_solutions(
     this->minlevel, this->maxlevel);
 
   for (unsigned int level = this->minlevel; level <= this->maxlevel; ++level)
@@ -1324,9 +1943,6 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
           this->dof_handler,
           mg_time_derivative_previous_solutions,
           time_derivative_previous_solutions);
-
-      this->mg_matrix =
-        std::make_shared<mg::Matrix<VectorType>>(this->ls_mg_operators);
     }
   else if (this->simulation_parameters.linear_solver
              .at(PhysicsID::fluid_dynamics)
@@ -1342,9 +1958,6 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
           this->dof_handler,
           mg_time_derivative_previous_solutions,
           time_derivative_previous_solutions);
-
-      this->mg_matrix =
-        std::make_shared<mg::Matrix<VectorType>>(this->mg_operators);
     }
 
   this->mg_setup_timer.leave_subsection("Execute relevant transfers");
@@ -1368,12 +1981,30 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
               flow_control.get_beta());
         }
     }
+}
 
+template <int dim, typename MGNumber>
+void
+MFNavierStokesPreconditionGMG<dim, MGNumber>::setup_smoother(
+  const std::shared_ptr<SimulationControl> &simulation_control,
+  const bool                                full_setup)
+{
   // Create smoother, fill parameters for each level and intialize it
   this->mg_setup_timer.enter_subsection("Set up and initialize smoother");
 
-  this->mg_smoother = std::make_shared<
-    MGSmootherPrecondition<OperatorType, SmootherType, VectorType>>();
+  // The smoother object is kept alive across updates since the multigrid
+  // object refers to it
+  if (!this->mg_smoother)
+    this->mg_smoother = std::make_shared<
+      MGSmootherPrecondition<OperatorType, SmootherType, MGVectorType>>();
+
+  // The relaxation parameters obtained from the eigenvalue estimates of the
+  // previous set up are reused if requested
+  const bool reuse_eigenvalue_estimates =
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+      .mg_reuse_eigenvalue_estimates &&
+    !full_setup;
+  bool eigenvalues_estimated = false;
 
   MGLevelObject<typename SmootherType::AdditionalData> smoother_data(
     this->minlevel, this->maxlevel);
@@ -1386,10 +2017,10 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
           Parameters::LinearSolver::MultigridSmootherPreconditionerType::
             InverseDiagonal)
         {
-          VectorType diagonal_vector;
+          MGVectorType diagonal_vector;
           this->mg_operators[level]->compute_inverse_diagonal(diagonal_vector);
           mg_smoother_preconditioners[level] =
-            std::make_shared<MyDiagonalMatrix<VectorType>>(diagonal_vector);
+            std::make_shared<MyDiagonalMatrix<MGVectorType>>(diagonal_vector);
         }
       else if (this->simulation_parameters.linear_solver
                  .at(PhysicsID::fluid_dynamics)
@@ -1399,9 +2030,9 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
         {
           if (mg_smoother_preconditioners[level] == nullptr)
             mg_smoother_preconditioners[level] =
-              std::make_shared<PreconditionASM<VectorType>>();
+              std::make_shared<PreconditionASM<MGVectorType>>();
 
-          dynamic_cast<PreconditionASM<VectorType> *>(
+          dynamic_cast<PreconditionASM<MGVectorType> *>(
             mg_smoother_preconditioners[level].get())
             ->initialize(this->mg_operators[level]
                            ->get_system_matrix_free()
@@ -1413,6 +2044,42 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
                            .get_affine_constraints(),
                          this->mg_operators[level]->get_vector_partitioner());
         }
+      else if (this->simulation_parameters.linear_solver
+                 .at(PhysicsID::fluid_dynamics)
+                 .mg_smoother_preconditioner_type ==
+               Parameters::LinearSolver::MultigridSmootherPreconditionerType::
+                 VertexPatch)
+        {
+          // The patches only depend on the mesh and are identified once
+          if (mg_smoother_preconditioners[level] == nullptr)
+            {
+              auto vertex_patch =
+                std::make_shared<PreconditionVertexPatch<MGVectorType>>();
+              vertex_patch->initialize(
+                this->mg_operators[level]
+                  ->get_system_matrix_free()
+                  .get_dof_handler(),
+                this->mg_operators[level]
+                  ->get_system_matrix_free()
+                  .get_affine_constraints(),
+                this->mg_operators[level]->get_vector_partitioner());
+              mg_smoother_preconditioners[level] = vertex_patch;
+            }
+
+          MGVectorType inverse_diagonal;
+          this->mg_operators[level]->compute_inverse_diagonal(
+            inverse_diagonal);
+
+          const double velocity_mass_ratio =
+            is_bdf(simulation_control->get_assembly_method()) ?
+              simulation_control->get_bdf_coefficients()[0] /
+                this->mg_operators[level]->get_kinematic_viscosity() :
+              0.0;
+
+          dynamic_cast<PreconditionVertexPatch<MGVectorType> *>(
+            mg_smoother_preconditioners[level].get())
+            ->update(inverse_diagonal, velocity_mass_ratio);
+        }
 
       smoother_data[level].preconditioner = mg_smoother_preconditioners[level];
 
@@ -1425,23 +2092,36 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
             .mg_smoother_eig_estimation)
         {
 #if DEAL_II_VERSION_GTE(9, 6, 0)
-          // Set relaxation to zero so that eigenvalues are estimated
-          // internally
-          smoother_data[level].relaxation = 0.0;
-          smoother_data[level].smoothing_range =
-            this->simulation_parameters.linear_solver
-              .at(PhysicsID::fluid_dynamics)
-              .eig_estimation_smoothing_range;
-          smoother_data[level].eig_cg_n_iterations =
-            this->simulation_parameters.linear_solver
-              .at(PhysicsID::fluid_dynamics)
-              .eig_estimation_cg_n_iterations;
-          smoother_data[level].eigenvalue_algorithm =
-            SmootherType::AdditionalData::EigenvalueAlgorithm::power_iteration;
-          smoother_data[level].constraints.copy_from(
-            this->mg_operators[level]
-              ->get_system_matrix_free()
-              .get_affine_constraints());
+          const double previous_relaxation =
+            reuse_eigenvalue_estimates ?
+              this->mg_smoother->smoothers[level].get_relaxation() :
+              0.0;
+
+          if (previous_relaxation > 0.0)
+            smoother_data[level].relaxation = previous_relaxation;
+          else
+            {
+              // Set relaxation to zero so that eigenvalues are estimated
+              // internally
+              smoother_data[level].relaxation = 0.0;
+              smoother_data[level].smoothing_range =
+                this->simulation_parameters.linear_solver
+                  .at(PhysicsID::fluid_dynamics)
+                  .eig_estimation_smoothing_range;
+              smoother_data[level].eig_cg_n_iterations =
+                this->simulation_parameters.linear_solver
+                  .at(PhysicsID::fluid_dynamics)
+                  .eig_estimation_cg_n_iterations;
+              smoother_data[level].eigenvalue_algorithm =
+                SmootherType::AdditionalData::EigenvalueAlgorithm::
+                  power_iteration;
+              smoother_data[level].constraints.copy_from(
+                this->mg_operators[level]
+                  ->get_system_matrix_free()
+                  .get_affine_constraints());
+
+              eigenvalues_estimated = true;
+            }
 #else
           AssertThrow(
             false,
@@ -1459,8 +2139,7 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
   mg_smoother->initialize(this->mg_operators, smoother_data);
 
 #if DEAL_II_VERSION_GTE(9, 6, 0)
-  if (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
-        .mg_smoother_eig_estimation &&
+  if (eigenvalues_estimated &&
       this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
           .eig_estimation_verbose != Parameters::Verbosity::quiet)
     {
@@ -1468,7 +2147,7 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
       for (unsigned int level = this->minlevel; level <= this->maxlevel;
            ++level)
         {
-          VectorType vec;
+          MGVectorType vec;
           this->mg_operators[level]->initialize_dof_vector(vec);
           const auto evs =
             mg_smoother->smoothers[level].estimate_eigenvalues(vec);
@@ -1494,6 +2173,18 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
 #endif
 
   this->mg_setup_timer.leave_subsection("Set up and initialize smoother");
+}
+
+template <int dim, typename MGNumber>
+bool
+MFNavierStokesPreconditionGMG<dim, MGNumber>::setup_coarse_grid_solver(
+  const bool full_setup)
+{
+  // The coarse-grid solver of the previous set up is reused if requested
+  if (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+        .mg_reuse_coarse_grid_solver &&
+      !full_setup && this->mg_coarse)
+    return false;
 
   // Create coarse-grid GMRES solver and AMG preconditioner
   this->mg_setup_timer.enter_subsection("Create coarse-grid solver");
@@ -1513,12 +2204,12 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
           .mg_gmres_reduce;
       this->coarse_grid_solver_control = std::make_shared<ReductionControl>(
         max_iterations, tolerance, reduce, false, false);
-      SolverGMRES<VectorType>::AdditionalData solver_parameters;
+      typename SolverGMRES<MGVectorType>::AdditionalData solver_parameters;
       solver_parameters.max_n_tmp_vectors =
         this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
           .mg_gmres_max_krylov_vectors;
 
-      this->coarse_grid_solver = std::make_shared<SolverGMRES<VectorType>>(
+      this->coarse_grid_solver = std::make_shared<SolverGMRES<MGVectorType>>(
         *this->coarse_grid_solver_control, solver_parameters);
 
       if (this->simulation_parameters.linear_solver
@@ -1528,14 +2219,9 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
         {
           setup_AMG();
 
-          this->mg_coarse = std::make_shared<
-            MGCoarseGridIterativeSolver<VectorType,
-                                        SolverGMRES<VectorType>,
-                                        OperatorType,
-                                        TrilinosWrappers::PreconditionAMG>>(
-            *this->coarse_grid_solver,
-            *this->mg_operators[this->minlevel],
-            *this->precondition_amg);
+          this->coarse_grid_preconditioner = std::make_shared<
+            TrilinosPreconditionerAdapter<MGVectorType>>(
+            this->precondition_amg);
         }
       else if (this->simulation_parameters.linear_solver
                  .at(PhysicsID::fluid_dynamics)
@@ -1544,15 +2230,19 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
         {
           setup_ILU();
 
-          this->mg_coarse = std::make_shared<
-            MGCoarseGridIterativeSolver<VectorType,
-                                        SolverGMRES<VectorType>,
-                                        OperatorType,
-                                        TrilinosWrappers::PreconditionILU>>(
-            *this->coarse_grid_solver,
-            *this->mg_operators[this->minlevel],
-            *this->precondition_ilu);
+          this->coarse_grid_preconditioner = std::make_shared<
+            TrilinosPreconditionerAdapter<MGVectorType>>(
+            this->precondition_ilu);
         }
+
+      this->mg_coarse = std::make_shared<MGCoarseGridIterativeSolver<
+        MGVectorType,
+        SolverGMRES<MGVectorType>,
+        OperatorType,
+        TrilinosPreconditionerAdapter<MGVectorType>>>(
+        *this->coarse_grid_solver,
+        *this->mg_operators[this->minlevel],
+        *this->coarse_grid_preconditioner);
     }
   else if (this->simulation_parameters.linear_solver
              .at(PhysicsID::fluid_dynamics)
@@ -1562,7 +2252,7 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
       setup_AMG();
 
       this->mg_coarse = std::make_shared<
-        MGCoarseGridApplyPreconditioner<VectorType,
+        MGCoarseGridApplyPreconditioner<MGVectorType,
                                         TrilinosWrappers::PreconditionAMG>>(
         *this->precondition_amg);
     }
@@ -1574,7 +2264,7 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
       setup_ILU();
 
       this->mg_coarse = std::make_shared<
-        MGCoarseGridApplyPreconditioner<VectorType,
+        MGCoarseGridApplyPreconditioner<MGVectorType,
                                         TrilinosWrappers::PreconditionILU>>(
         *this->precondition_ilu);
     }
@@ -1596,7 +2286,7 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
         this->mg_operators[this->minlevel]->get_system_matrix());
 
       this->mg_coarse = std::make_shared<
-        MGCoarseGridApplyPreconditioner<VectorType,
+        MGCoarseGridApplyPreconditioner<MGVectorType,
                                         TrilinosWrappers::SolverDirect>>(
         *this->precondition_direct);
 #else
@@ -1625,52 +2315,68 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
 
   this->mg_setup_timer.leave_subsection("Create coarse-grid solver");
 
+  return true;
+}
+
+template <int dim, typename MGNumber>
+void
+MFNavierStokesPreconditionGMG<dim, MGNumber>::setup_multigrid()
+{
   if (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
         .preconditioner == Parameters::LinearSolver::PreconditionerType::lsmg)
     {
+      this->mg_matrix =
+        std::make_shared<mg::Matrix<MGVectorType>>(this->ls_mg_operators);
+
       // Create interface matrices needed for local smoothing in case of
       // local refinement
       this->mg_interface_matrix_in =
-        std::make_shared<mg::Matrix<VectorType>>(this->ls_mg_interface_in);
+        std::make_shared<mg::Matrix<MGVectorType>>(this->ls_mg_interface_in);
 
       // Create main MG object
-      this->mg = std::make_shared<Multigrid<VectorType>>(*this->mg_matrix,
-                                                         *this->mg_coarse,
-                                                         *this->mg_transfer_ls,
-                                                         *this->mg_smoother,
-                                                         *this->mg_smoother,
-                                                         this->minlevel,
-                                                         this->maxlevel);
+      this->mg =
+        std::make_shared<Multigrid<MGVectorType>>(*this->mg_matrix,
+                                                  *this->mg_coarse,
+                                                  *this->mg_transfer_ls,
+                                                  *this->mg_smoother,
+                                                  *this->mg_smoother,
+                                                  this->minlevel,
+                                                  this->maxlevel);
 
       if (this->dof_handler.get_triangulation().has_hanging_nodes())
         this->mg->set_edge_in_matrix(*this->mg_interface_matrix_in);
 
       // Create MG preconditioner
       this->ls_multigrid_preconditioner =
-        std::make_shared<PreconditionMG<dim, VectorType, LSTransferType>>(
-          this->dof_handler, *this->mg, *this->mg_transfer_ls);
+        std::make_shared<PreconditionerTypeLS>(this->dof_handler,
+                                               *this->mg,
+                                               *this->mg_transfer_ls);
     }
   else if (this->simulation_parameters.linear_solver
              .at(PhysicsID::fluid_dynamics)
              .preconditioner ==
            Parameters::LinearSolver::PreconditionerType::gcmg)
     {
+      this->mg_matrix =
+        std::make_shared<mg::Matrix<MGVectorType>>(this->mg_operators);
+
       if (this->minlevel != this->intlevel)
         {
           // Create main MG object
           this->mg_intermediate =
-            std::make_shared<Multigrid<VectorType>>(*this->mg_matrix,
-                                                    *this->mg_coarse,
-                                                    *this->mg_transfer_gc,
-                                                    *this->mg_smoother,
-                                                    *this->mg_smoother,
-                                                    this->minlevel,
-                                                    this->intlevel);
+            std::make_shared<Multigrid<MGVectorType>>(*this->mg_matrix,
+                                                      *this->mg_coarse,
+                                                      *this->mg_transfer_gc,
+                                                      *this->mg_smoother,
+                                                      *this->mg_smoother,
+                                                      this->minlevel,
+                                                      this->intlevel);
 
           // Create MG preconditioner
           this->gc_multigrid_preconditioner_intermediate =
-            std::make_shared<PreconditionMG<dim, VectorType, GCTransferType>>(
-              this->dof_handler, *this->mg_intermediate, *this->mg_transfer_gc);
+            std::make_shared<PreconditionerTypeGC>(this->dof_handler,
+                                                   *this->mg_intermediate,
+                                                   *this->mg_transfer_gc);
 
           const int max_iterations = this->simulation_parameters.linear_solver
                                        .at(PhysicsID::fluid_dynamics)
@@ -1687,22 +2393,22 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
               max_iterations, tolerance, reduce, false, false);
 
           this->coarse_grid_solver_intermediate =
-            std::make_shared<SolverGMRES<VectorType>>(
+            std::make_shared<SolverGMRES<MGVectorType>>(
               *this->coarse_grid_solver_control_intermediate);
 
           this->mg_coarse_intermediate =
             std::make_shared<MGCoarseGridIterativeSolver<
-              VectorType,
-              SolverGMRES<VectorType>,
+              MGVectorType,
+              SolverGMRES<MGVectorType>,
               OperatorType,
-              PreconditionMG<dim, VectorType, GCTransferType>>>(
+              PreconditionerTypeGC>>(
               *this->coarse_grid_solver_intermediate,
               *this->mg_operators[this->intlevel],
               *this->gc_multigrid_preconditioner_intermediate);
         }
 
       // Create main MG object
-      this->mg = std::make_shared<Multigrid<VectorType>>(
+      this->mg = std::make_shared<Multigrid<MGVectorType>>(
         *this->mg_matrix,
         (this->minlevel != this->intlevel) ? (*this->mg_coarse_intermediate) :
                                              (*this->mg_coarse),
@@ -1711,12 +2417,13 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
         *this->mg_smoother,
         this->intlevel,
         this->maxlevel,
-        Multigrid<VectorType>::Cycle::v_cycle);
+        Multigrid<MGVectorType>::Cycle::v_cycle);
 
       // Create MG preconditioner
       this->gc_multigrid_preconditioner =
-        std::make_shared<PreconditionMG<dim, VectorType, GCTransferType>>(
-          this->dof_handler, *this->mg, *this->mg_transfer_gc);
+        std::make_shared<PreconditionerTypeGC>(this->dof_handler,
+                                               *this->mg,
+                                               *this->mg_transfer_gc);
     }
 
   // Print detailed timings of multigrid vmult
@@ -1793,10 +2500,29 @@ MFNavierStokesPreconditionGMG<dim>::initialize(
     }
 }
 
-template <int dim>
+template <int dim, typename MGNumber>
+void
+MFNavierStokesPreconditionGMG<dim, MGNumber>::monitor_outer_iterations(
+  const unsigned int n_iterations)
+{
+  const double max_iterations_ratio =
+    this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+      .mg_reuse_max_iterations_ratio;
+
+  // The first solve after a full set up serves as reference, the reused
+  // components are rebuilt once the number of iterations grew too much
+  if (this->reference_outer_iterations == 0)
+    this->reference_outer_iterations = n_iterations;
+  else if (n_iterations >
+           max_iterations_ratio * this->reference_outer_iterations)
+    this->rebuild_reused_components = true;
+}
+
+template <int dim, typename MGNumber>
 void
-MFNavierStokesPreconditionGMG<dim>::vmult(VectorType       &dst,
-                                          const VectorType &src) const
+MFNavierStokesPreconditionGMG<dim, MGNumber>::vmult(
+  VectorType       &dst,
+  const VectorType &src) const
 {
   if (this->ls_multigrid_preconditioner)
     this->ls_multigrid_preconditioner->vmult(dst, src);
@@ -1814,9 +2540,9 @@ MFNavierStokesPreconditionGMG<dim>::vmult(VectorType       &dst,
       this->coarse_grid_solver_control_intermediate->last_step());
 }
 
-template <int dim>
+template <int dim, typename MGNumber>
 void
-MFNavierStokesPreconditionGMG<dim>::print_relevant_info() const
+MFNavierStokesPreconditionGMG<dim, MGNumber>::print_relevant_info() const
 {
   if (this->coarse_grid_solver_control ||
       this->coarse_grid_solver_control_intermediate)
@@ -1840,24 +2566,87 @@ MFNavierStokesPreconditionGMG<dim>::print_relevant_info() const
     }
 }
 
-template <int dim>
-const MGLevelObject<std::shared_ptr<NavierStokesOperatorBase<dim, double>>> &
-MFNavierStokesPreconditionGMG<dim>::get_mg_operators() const
+template <int dim, typename MGNumber>
+void
+MFNavierStokesPreconditionGMG<dim, MGNumber>::set_kinematic_viscosity(
+  const double kinematic_viscosity)
+{
+  for (unsigned int level = this->mg_operators.min_level();
+       level <= this->mg_operators.max_level();
+       level++)
+    {
+      this->mg_operators[level]->set_kinematic_viscosity(kinematic_viscosity);
+    }
+}
+
+template <int dim, typename MGNumber>
+void
+MFNavierStokesPreconditionGMG<dim, MGNumber>::print_level_timers() const
+{
+  for (unsigned int level = this->mg_operators.min_level();
+       level <= this->mg_operators.max_level();
+       level++)
+    {
+      announce_string(this->pcout,
+                      "Operator level " + std::to_string(level) + " times");
+      this->mg_operators[level]->timer.print_wall_time_statistics(
+        MPI_COMM_WORLD);
+
+      // Reset timer if output is set to every iteration
+      this->mg_operators[level]->timer.reset();
+    }
+
+  for (unsigned int level = this->mg_operators.min_level();
+       level <= this->mg_operators.max_level();
+       level++)
+    {
+      announce_string(this->pcout,
+                      "Preconditioner level " + std::to_string(level) +
+                        " times");
+      this->mg_smoother_preconditioners[level]->timer_print();
+
+      // Reset timer if output is set to every iteration
+      this->mg_smoother_preconditioners[level]->timer_reset();
+    }
+}
+
+template <int dim, typename MGNumber>
+void
+MFNavierStokesPreconditionGMG<dim, MGNumber>::interpolate_to_levels(
+  const VectorType            &src,
+  MGLevelObject<MGVectorType> &dst) const
+{
+  dst.resize(this->minlevel, this->maxlevel);
+  for (unsigned int level = this->minlevel; level <= this->maxlevel; ++level)
+    this->mg_operators[level]->initialize_dof_vector(dst[level]);
+
+  if (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+        .preconditioner == Parameters::LinearSolver::PreconditionerType::lsmg)
+    this->mg_transfer_ls->interpolate_to_mg(this->dof_handler, dst, src);
+  else
+    this->mg_transfer_gc->interpolate_to_mg(this->dof_handler, dst, src);
+}
+
+template <int dim, typename MGNumber>
+const MGLevelObject<
+  std::shared_ptr<NavierStokesOperatorBase<dim, MGNumber>>> &
+MFNavierStokesPreconditionGMG<dim, MGNumber>::get_mg_operators() const
 {
   return this->mg_operators;
 }
 
-template <int dim>
-const MGLevelObject<std::shared_ptr<
-  PreconditionBase<typename MFNavierStokesPreconditionGMG<dim>::VectorType>>> &
-MFNavierStokesPreconditionGMG<dim>::get_mg_smoother_preconditioners() const
+template <int dim, typename MGNumber>
+const MGLevelObject<std::shared_ptr<PreconditionBase<
+  typename MFNavierStokesPreconditionGMG<dim, MGNumber>::MGVectorType>>> &
+MFNavierStokesPreconditionGMG<dim, MGNumber>::get_mg_smoother_preconditioners()
+  const
 {
   return this->mg_smoother_preconditioners;
 }
 
-template <int dim>
+template <int dim, typename MGNumber>
 void
-MFNavierStokesPreconditionGMG<dim>::setup_AMG()
+MFNavierStokesPreconditionGMG<dim, MGNumber>::setup_AMG()
 {
   TrilinosWrappers::PreconditionAMG::AdditionalData amg_data;
 
@@ -1961,9 +2750,9 @@ MFNavierStokesPreconditionGMG<dim>::setup_AMG()
     }
 }
 
-template <int dim>
+template <int dim, typename MGNumber>
 void
-MFNavierStokesPreconditionGMG<dim>::setup_ILU()
+MFNavierStokesPreconditionGMG<dim, MGNumber>::setup_ILU()
 {
   int current_preconditioner_fill_level =
     this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
@@ -1985,6 +2774,361 @@ MFNavierStokesPreconditionGMG<dim>::setup_ILU()
     preconditionerOptions);
 }
 
+template <int dim>
+MFNavierStokesPreconditionBlockSchur<dim>::
+  MFNavierStokesPreconditionBlockSchur(
+    const SimulationParameters<dim>          &simulation_parameters,
+    const DoFHandler<dim>                    &dof_handler,
+    const std::shared_ptr<Mapping<dim>>      &mapping,
+    const std::shared_ptr<Quadrature<dim>>   &cell_quadrature,
+    const std::shared_ptr<SimulationControl> &simulation_control,
+    const std::shared_ptr<NavierStokesOperatorBase<dim, double>>
+      &system_operator)
+  : MFNavierStokesPreconditionGMGBase<dim>()
+  , simulation_parameters(simulation_parameters)
+  , scalar_linear_solver_parameters(
+      simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics))
+  , dof_handler(dof_handler)
+  , mapping(mapping)
+  , cell_quadrature(cell_quadrature)
+  , simulation_control(simulation_control)
+  , system_operator(system_operator)
+  , kinematic_viscosity(simulation_parameters.physical_properties_manager
+                          .get_kinematic_viscosity_scale())
+{
+  AssertThrow(
+    !this->scalar_linear_solver_parameters.mg_use_fe_q_iso_q1,
+    ExcMessage(
+      "The schur preconditioner does not support FE_Q_iso_Q1 elements in the multigrid levels."));
+
+  // The scalar multigrid preconditioners only support iterative or algebraic
+  // coarse-grid solvers
+  if (this->scalar_linear_solver_parameters.mg_coarse_grid_solver !=
+      Parameters::LinearSolver::CoarseGridSolverType::gmres)
+    this->scalar_linear_solver_parameters.mg_coarse_grid_solver =
+      Parameters::LinearSolver::CoarseGridSolverType::amg;
+
+  this->mg_setup_timer.enter_subsection("Create scalar DoFHandler");
+
+  // The DoFs are not renumbered, which ensures that the numbering matches the
+  // finest level of the scalar multigrid preconditioners
+  const unsigned int fe_degree = dof_handler.get_fe().degree;
+  dof_handler_scalar.reinit(dof_handler.get_triangulation());
+  dof_handler_scalar.distribute_dofs(FE_Q<dim>(fe_degree));
+
+  // The velocity is prescribed on Dirichlet-type boundaries, while the
+  // pressure is prescribed where the flow leaves the domain, which is the
+  // usual choice for the pressure convection-diffusion method
+  const auto &boundary_conditions =
+    this->simulation_parameters.boundary_conditions;
+  for (unsigned int i_bc = 0; i_bc < boundary_conditions.size; ++i_bc)
+    {
+      if (boundary_conditions.type[i_bc] ==
+            BoundaryConditions::BoundaryType::noslip ||
+          boundary_conditions.type[i_bc] ==
+            BoundaryConditions::BoundaryType::slip ||
+          boundary_conditions.type[i_bc] ==
+            BoundaryConditions::BoundaryType::function)
+        velocity_dirichlet_ids.insert(boundary_conditions.id[i_bc]);
+      else if (boundary_conditions.type[i_bc] ==
+                 BoundaryConditions::BoundaryType::pressure ||
+               boundary_conditions.type[i_bc] ==
+                 BoundaryConditions::BoundaryType::outlet)
+        pressure_dirichlet_ids.insert(boundary_conditions.id[i_bc]);
+    }
+
+  const IndexSet locally_relevant_dofs =
+    DoFTools::extract_locally_relevant_dofs(dof_handler_scalar);
+
+  for (auto [constraints, dirichlet_ids] :
+       {std::make_pair(&velocity_constraints, &velocity_dirichlet_ids),
+        std::make_pair(&pressure_constraints, &pressure_dirichlet_ids)})
+    {
+      constraints->clear();
+      constraints->reinit(locally_relevant_dofs);
+      DoFTools::make_hanging_node_constraints(dof_handler_scalar,
+                                              *constraints);
+      for (const auto &id : *dirichlet_ids)
+        DoFTools::make_zero_boundary_constraints(dof_handler_scalar,
+                                                 id,
+                                                 *constraints);
+      constraints->close();
+    }
+
+  this->mg_setup_timer.leave_subsection("Create scalar DoFHandler");
+
+  setup_operators();
+
+  this->mg_setup_timer.enter_subsection("Create component indices");
+
+  // Map the locally owned DoFs of each component of the vector-valued
+  // problem to the DoFs of the scalar DoFHandler. Both DoFHandlers share the
+  // triangulation, which ensures that the DoFs at the same support point are
+  // owned by the same process.
+  VectorType system_vector, scalar_vector;
+  this->system_operator->initialize_dof_vector(system_vector);
+  this->velocity_operator.initialize_dof_vector(scalar_vector);
+
+  const auto &system_partitioner = *system_vector.get_partitioner();
+  const auto &scalar_partitioner = *scalar_vector.get_partitioner();
+
+  const FiniteElement<dim> &fe = dof_handler.get_fe();
+
+  component_indices.clear();
+  component_indices.resize(dim + 1);
+
+  const unsigned int n_scalar_dofs = scalar_partitioner.locally_owned_size();
+  std::vector<std::vector<bool>> visited(
+    dim + 1, std::vector<bool>(n_scalar_dofs, false));
+
+  std::vector<types::global_dof_index> dof_indices(fe.n_dofs_per_cell());
+  std::vector<types::global_dof_index> scalar_dof_indices(
+    dof_handler_scalar.get_fe().n_dofs_per_cell());
+
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      if (!cell->is_locally_owned())
+        continue;
+
+      typename DoFHandler<dim>::active_cell_iterator scalar_cell(
+        &cell->get_triangulation(),
+        cell->level(),
+        cell->index(),
+        &dof_handler_scalar);
+
+      cell->get_dof_indices(dof_indices);
+      scalar_cell->get_dof_indices(scalar_dof_indices);
+
+      for (unsigned int i = 0; i < dof_indices.size(); ++i)
+        {
+          const auto [component, base_index] = fe.system_to_component_index(i);
+
+          const types::global_dof_index scalar_index =
+            scalar_dof_indices[base_index];
+
+          if (!system_partitioner.in_local_range(dof_indices[i]) ||
+              !scalar_partitioner.in_local_range(scalar_index))
+            continue;
+
+          const unsigned int local_scalar_index =
+            scalar_partitioner.global_to_local(scalar_index);
+
+          if (visited[component][local_scalar_index])
+            continue;
+
+          visited[component][local_scalar_index] = true;
+          component_indices[component].emplace_back(
+            system_partitioner.global_to_local(dof_indices[i]),
+            local_scalar_index);
+        }
+    }
+
+  this->mg_setup_timer.leave_subsection("Create component indices");
+
+  // Pressure Laplacian and its multigrid preconditioner. Since they do not
+  // depend on the time step and on the viscosity, they are only created once.
+  this->mg_setup_timer.enter_subsection("Create pressure preconditioners");
+
+  this->pressure_laplacian_preconditioner =
+    std::make_shared<ScalarGMGType>(this->scalar_linear_solver_parameters,
+                                    dof_handler_scalar,
+                                    *this->mapping,
+                                    *this->cell_quadrature,
+                                    pressure_dirichlet_ids,
+                                    0.0,
+                                    1.0,
+                                    false,
+                                    this->simulation_control);
+  this->pressure_laplacian_preconditioner->initialize();
+
+  // Inverse of the diagonal of the pressure mass matrix
+  const auto &pressure_matrix_free =
+    this->pressure_operator.get_system_matrix_free();
+  VectorType &mass_diagonal = this->pressure_mass_inverse.get_vector();
+  pressure_matrix_free.initialize_dof_vector(mass_diagonal);
+  MatrixFreeTools::compute_diagonal<dim, -1, 0, 1, double>(
+    pressure_matrix_free,
+    mass_diagonal,
+    [&](auto &integrator) {
+      integrator.evaluate(EvaluationFlags::values);
+      for (const auto q : integrator.quadrature_point_indices())
+        integrator.submit_value(integrator.get_value(q), q);
+      integrator.integrate(EvaluationFlags::values);
+    });
+
+  for (auto &i : mass_diagonal)
+    i = (std::abs(i) > 1.0e-10) ? (1.0 / i) : 1.0;
+
+  this->mg_setup_timer.leave_subsection("Create pressure preconditioners");
+
+  this->velocity_operator.initialize_dof_vector(scalar_src);
+  this->velocity_operator.initialize_dof_vector(scalar_dst);
+  this->velocity_operator.initialize_dof_vector(pressure_solution);
+  this->system_operator->initialize_dof_vector(system_tmp);
+  this->system_operator->initialize_dof_vector(system_coupling);
+}
+
+template <int dim>
+void
+MFNavierStokesPreconditionBlockSchur<dim>::setup_operators()
+{
+  this->mg_setup_timer.enter_subsection("Create operators");
+
+  // Each velocity component is approximated by the advection-diffusion
+  // operator, which neglects the coupling between the components introduced
+  // by the Newton linearization of the convective term
+  this->velocity_operator.reinit(*this->mapping,
+                                 dof_handler_scalar,
+                                 velocity_constraints,
+                                 *this->cell_quadrature,
+                                 1.0,
+                                 this->kinematic_viscosity,
+                                 false,
+                                 this->simulation_control);
+
+  this->pressure_operator.reinit(*this->mapping,
+                                 dof_handler_scalar,
+                                 pressure_constraints,
+                                 *this->cell_quadrature,
+                                 1.0,
+                                 this->kinematic_viscosity,
+                                 false,
+                                 this->simulation_control);
+
+  this->mg_setup_timer.leave_subsection("Create operators");
+
+  this->rebuild_velocity_preconditioner = true;
+}
+
+template <int dim>
+void
+MFNavierStokesPreconditionBlockSchur<dim>::initialize(
+  const std::shared_ptr<SimulationControl> & /*simulation_control*/,
+  FlowControl<dim> & /*flow_control*/,
+  const VectorType &present_solution,
+  const VectorType & /*time_derivative_previous_solutions*/)
+{
+  this->mg_setup_timer.enter_subsection("Evaluate velocity");
+
+  this->velocity_operator.evaluate_velocity_and_calculate_tau(
+    *this->mapping, this->dof_handler, present_solution);
+  this->pressure_operator.evaluate_velocity_and_calculate_tau(
+    *this->mapping, this->dof_handler, present_solution);
+
+  this->mg_setup_timer.leave_subsection("Evaluate velocity");
+
+  // The levels of the velocity preconditioner only depend on the viscosity
+  // and on the time step, the latter requiring a new smoother
+  this->mg_setup_timer.enter_subsection("Setup velocity preconditioner");
+
+  if (this->rebuild_velocity_preconditioner)
+    {
+      this->velocity_preconditioner =
+        std::make_shared<ScalarGMGType>(this->scalar_linear_solver_parameters,
+                                        dof_handler_scalar,
+                                        *this->mapping,
+                                        *this->cell_quadrature,
+                                        velocity_dirichlet_ids,
+                                        1.0,
+                                        this->kinematic_viscosity,
+                                        false,
+                                        this->simulation_control);
+      this->rebuild_velocity_preconditioner = false;
+    }
+
+  this->velocity_preconditioner->initialize();
+
+  this->mg_setup_timer.leave_subsection("Setup velocity preconditioner");
+}
+
+template <int dim>
+void
+MFNavierStokesPreconditionBlockSchur<dim>::vmult(VectorType       &dst,
+                                                 const VectorType &src) const
+{
+  // 1. Pressure: p = M_p^-1 F_p A_p^-1 src_p
+  this->mg_vmult_timer.enter_subsection("Schur complement");
+
+  extract_component(src, dim, scalar_src);
+  this->pressure_laplacian_preconditioner->vmult(scalar_dst, scalar_src);
+  this->pressure_operator.vmult(scalar_src, scalar_dst);
+  this->pressure_mass_inverse.vmult(pressure_solution, scalar_src);
+
+  this->mg_vmult_timer.leave_subsection("Schur complement");
+
+  // 2. Remove the contribution of the pressure from the momentum equations,
+  // i.e., src_u - B_1 p, with the matrix-free system operator
+  this->mg_vmult_timer.enter_subsection("Velocity-pressure coupling");
+
+  system_tmp = 0.0;
+  insert_component(pressure_solution, dim, system_tmp);
+  this->system_operator->vmult(system_coupling, system_tmp);
+  system_coupling.sadd(-1.0, 1.0, src);
+
+  this->mg_vmult_timer.leave_subsection("Velocity-pressure coupling");
+
+  // 3. Velocity: u = A^-1 (src_u - B_1 p), component by component
+  this->mg_vmult_timer.enter_subsection("Velocity block");
+
+  for (unsigned int d = 0; d < dim; ++d)
+    {
+      extract_component(system_coupling, d, scalar_src);
+      this->velocity_preconditioner->vmult(scalar_dst, scalar_src);
+      insert_component(scalar_dst, d, dst);
+    }
+
+  insert_component(pressure_solution, dim, dst);
+
+  this->mg_vmult_timer.leave_subsection("Velocity block");
+}
+
+template <int dim>
+void
+MFNavierStokesPreconditionBlockSchur<dim>::extract_component(
+  const VectorType  &src,
+  const unsigned int component,
+  VectorType        &dst) const
+{
+  for (const auto &[system_index, scalar_index] : component_indices[component])
+    dst.local_element(scalar_index) = src.local_element(system_index);
+}
+
+template <int dim>
+void
+MFNavierStokesPreconditionBlockSchur<dim>::insert_component(
+  const VectorType  &src,
+  const unsigned int component,
+  VectorType        &dst) const
+{
+  for (const auto &[system_index, scalar_index] : component_indices[component])
+    dst.local_element(system_index) = src.local_element(scalar_index);
+}
+
+template <int dim>
+void
+MFNavierStokesPreconditionBlockSchur<dim>::print_relevant_info() const
+{}
+
+template <int dim>
+void
+MFNavierStokesPreconditionBlockSchur<dim>::set_kinematic_viscosity(
+  const double kinematic_viscosity)
+{
+  this->kinematic_viscosity = kinematic_viscosity;
+  setup_operators();
+}
+
+template <int dim>
+void
+MFNavierStokesPreconditionBlockSchur<dim>::print_level_timers() const
+{}
+
+template <int dim>
+void
+MFNavierStokesPreconditionBlockSchur<dim>::monitor_outer_iterations(
+  const unsigned int /*n_iterations*/)
+{}
+
 template <int dim>
 FluidDynamicsMatrixFree<dim>::FluidDynamicsMatrixFree(
   SimulationParameters<dim> &nsparam)
@@ -2305,31 +3449,20 @@ FluidDynamicsMatrixFree<dim>::set_initial_condition_fd(
           (this->simulation_parameters.linear_solver
              .at(PhysicsID::fluid_dynamics)
              .preconditioner ==
-           Parameters::LinearSolver::PreconditionerType::gcmg))
+           Parameters::LinearSolver::PreconditionerType::gcmg) ||
+          (this->simulation_parameters.linear_solver
+             .at(PhysicsID::fluid_dynamics)
+             .preconditioner ==
+           Parameters::LinearSolver::PreconditionerType::schur))
         {
           // Create the mg operators if they do not exist to be able
           // to change the viscosity for all of them
           if (!gmg_preconditioner)
-            gmg_preconditioner =
-              std::make_shared<MFNavierStokesPreconditionGMG<dim>>(
-                this->simulation_parameters,
-                this->dof_handler,
-                this->dof_handler_fe_q_iso_q1,
-                this->mapping,
-                this->cell_quadrature,
-                this->forcing_function,
-                this->simulation_control,
-                this->fe);
-
-          auto mg_operators = this->gmg_preconditioner->get_mg_operators();
-          for (unsigned int level = mg_operators.min_level();
-               level <= mg_operators.max_level();
-               level++)
-            {
-              mg_operators[level]->set_kinematic_viscosity(
-                this->simulation_parameters.physical_properties_manager
-                  .get_kinematic_viscosity_scale());
-            }
+            create_GMG();
+
+          this->gmg_preconditioner->set_kinematic_viscosity(
+            this->simulation_parameters.physical_properties_manager
+              .get_kinematic_viscosity_scale());
         }
 
       // Solve the problem with the temporary viscosity
@@ -2354,15 +3487,13 @@ FluidDynamicsMatrixFree<dim>::set_initial_condition_fd(
           (this->simulation_parameters.linear_solver
              .at(PhysicsID::fluid_dynamics)
              .preconditioner ==
-           Parameters::LinearSolver::PreconditionerType::gcmg))
+           Parameters::LinearSolver::PreconditionerType::gcmg) ||
+          (this->simulation_parameters.linear_solver
+             .at(PhysicsID::fluid_dynamics)
+             .preconditioner ==
+           Parameters::LinearSolver::PreconditionerType::schur))
         {
-          auto mg_operators = this->gmg_preconditioner->get_mg_operators();
-          for (unsigned int level = mg_operators.min_level();
-               level <= mg_operators.max_level();
-               level++)
-            {
-              mg_operators[level]->set_kinematic_viscosity(viscosity_end);
-            }
+          this->gmg_preconditioner->set_kinematic_viscosity(viscosity_end);
         }
     }
   else if (initial_condition_type == Parameters::InitialConditionType::ramp)
@@ -2423,31 +3554,20 @@ FluidDynamicsMatrixFree<dim>::set_initial_condition_fd(
               (this->simulation_parameters.linear_solver
                  .at(PhysicsID::fluid_dynamics)
                  .preconditioner ==
-               Parameters::LinearSolver::PreconditionerType::gcmg))
+               Parameters::LinearSolver::PreconditionerType::gcmg) ||
+              (this->simulation_parameters.linear_solver
+                 .at(PhysicsID::fluid_dynamics)
+                 .preconditioner ==
+               Parameters::LinearSolver::PreconditionerType::schur))
             {
               // Create the mg operators if they do not exist to be able
               // to change the viscosity for all of them
               if (!gmg_preconditioner)
-                gmg_preconditioner =
-                  std::make_shared<MFNavierStokesPreconditionGMG<dim>>(
-                    this->simulation_parameters,
-                    this->dof_handler,
-                    this->dof_handler_fe_q_iso_q1,
-                    this->mapping,
-                    this->cell_quadrature,
-                    this->forcing_function,
-                    this->simulation_control,
-                    this->fe);
-
-              auto mg_operators = this->gmg_preconditioner->get_mg_operators();
-              for (unsigned int level = mg_operators.min_level();
-                   level <= mg_operators.max_level();
-                   level++)
-                {
-                  mg_operators[level]->set_kinematic_viscosity(
-                    this->simulation_parameters.physical_properties_manager
-                      .get_kinematic_viscosity_scale());
-                }
+                create_GMG();
+
+              this->gmg_preconditioner->set_kinematic_viscosity(
+                this->simulation_parameters.physical_properties_manager
+                  .get_kinematic_viscosity_scale());
             }
 
           this->simulation_control->set_assembly_method(
@@ -2471,15 +3591,13 @@ FluidDynamicsMatrixFree<dim>::set_initial_condition_fd(
           (this->simulation_parameters.linear_solver
              .at(PhysicsID::fluid_dynamics)
              .preconditioner ==
-           Parameters::LinearSolver::PreconditionerType::gcmg))
+           Parameters::LinearSolver::PreconditionerType::gcmg) ||
+          (this->simulation_parameters.linear_solver
+             .at(PhysicsID::fluid_dynamics)
+             .preconditioner ==
+           Parameters::LinearSolver::PreconditionerType::schur))
         {
-          auto mg_operators = this->gmg_preconditioner->get_mg_operators();
-          for (unsigned int level = mg_operators.min_level();
-               level <= mg_operators.max_level();
-               level++)
-            {
-              mg_operators[level]->set_kinematic_viscosity(viscosity_end);
-            }
+          this->gmg_preconditioner->set_kinematic_viscosity(viscosity_end);
         }
 
       timer.stop();
@@ -2571,6 +3689,46 @@ FluidDynamicsMatrixFree<dim>::calculate_time_derivative_previous_solutions()
     }
 }
 
+template <int dim>
+void
+FluidDynamicsMatrixFree<dim>::create_GMG()
+{
+  if (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+        .preconditioner == Parameters::LinearSolver::PreconditionerType::schur)
+    gmg_preconditioner =
+      std::make_shared<MFNavierStokesPreconditionBlockSchur<dim>>(
+        this->simulation_parameters,
+        this->dof_handler,
+        this->mapping,
+        this->cell_quadrature,
+        this->simulation_control,
+        this->system_operator);
+  else if (this->simulation_parameters.linear_solver
+             .at(PhysicsID::fluid_dynamics)
+             .mg_use_single_precision)
+    gmg_preconditioner =
+      std::make_shared<MFNavierStokesPreconditionGMG<dim, float>>(
+        this->simulation_parameters,
+        this->dof_handler,
+        this->dof_handler_fe_q_iso_q1,
+        this->mapping,
+        this->cell_quadrature,
+        this->forcing_function,
+        this->simulation_control,
+        this->fe);
+  else
+    gmg_preconditioner =
+      std::make_shared<MFNavierStokesPreconditionGMG<dim, double>>(
+        this->simulation_parameters,
+        this->dof_handler,
+        this->dof_handler_fe_q_iso_q1,
+        this->mapping,
+        this->cell_quadrature,
+        this->forcing_function,
+        this->simulation_control,
+        this->fe);
+}
+
 template <int dim>
 void
 FluidDynamicsMatrixFree<dim>::setup_GMG()
@@ -2578,15 +3736,7 @@ FluidDynamicsMatrixFree<dim>::setup_GMG()
   TimerOutput::Scope t(this->computing_timer, "Setup GMG");
 
   if (!gmg_preconditioner)
-    gmg_preconditioner = std::make_shared<MFNavierStokesPreconditionGMG<dim>>(
-      this->simulation_parameters,
-      this->dof_handler,
-      this->dof_handler_fe_q_iso_q1,
-      this->mapping,
-      this->cell_quadrature,
-      this->forcing_function,
-      this->simulation_control,
-      this->fe);
+    create_GMG();
 
   gmg_preconditioner->initialize(this->simulation_control,
                                  this->flow_control,
@@ -2637,33 +3787,7 @@ FluidDynamicsMatrixFree<dim>::print_mg_setup_times()
       announce_string(this->pcout, "System operator times");
       this->system_operator->timer.print_wall_time_statistics(MPI_COMM_WORLD);
 
-      auto mg_operators = this->gmg_preconditioner->get_mg_operators();
-      for (unsigned int level = mg_operators.min_level();
-           level <= mg_operators.max_level();
-           level++)
-        {
-          announce_string(this->pcout,
-                          "Operator level " + std::to_string(level) + " times");
-          mg_operators[level]->timer.print_wall_time_statistics(MPI_COMM_WORLD);
-
-          // Reset timer if output is set to every iteration
-          mg_operators[level]->timer.reset();
-        }
-
-      auto mg_smoother_preconditioners =
-        this->gmg_preconditioner->get_mg_smoother_preconditioners();
-      for (unsigned int level = mg_operators.min_level();
-           level <= mg_operators.max_level();
-           level++)
-        {
-          announce_string(this->pcout,
-                          "Preconditioner level " + std::to_string(level) +
-                            " times");
-          mg_smoother_preconditioners[level]->timer_print();
-
-          // Reset timer if output is set to every iteration
-          mg_smoother_preconditioners[level]->timer_reset();
-        }
+      this->gmg_preconditioner->print_level_timers();
 
       // Reset timers if output is set to every iteration
       this->gmg_preconditioner->mg_setup_timer.reset();
@@ -2863,10 +3987,7 @@ FluidDynamicsMatrixFree<dim>::define_zero_constraints()
       else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
                BoundaryConditions::BoundaryType::pressure)
         {
-          Assert(
-            false,
-            ExcMessage(
-              "Pressure boundary conditions are not supported by the matrix free application."));
+          /*The pressure boundary condition is implemented in the operators*/
         }
       else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
                BoundaryConditions::BoundaryType::function_weak)
@@ -2877,10 +3998,8 @@ FluidDynamicsMatrixFree<dim>::define_zero_constraints()
       else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
                BoundaryConditions::BoundaryType::partial_slip)
         {
-          Assert(
-            false,
-            ExcMessage(
-              "Partial slip boundary conditions are not supported by the matrix free application."));
+          /*The partial slip boundary condition is implemented in
+           * the operators*/
         }
       else if (this->simulation_parameters.boundary_conditions.type[i_bc] ==
                BoundaryConditions::BoundaryType::outlet)
@@ -2928,7 +4047,11 @@ FluidDynamicsMatrixFree<dim>::setup_preconditioner()
            (this->simulation_parameters.linear_solver
               .at(PhysicsID::fluid_dynamics)
               .preconditioner ==
-            Parameters::LinearSolver::PreconditionerType::gcmg))
+            Parameters::LinearSolver::PreconditionerType::gcmg) ||
+           (this->simulation_parameters.linear_solver
+              .at(PhysicsID::fluid_dynamics)
+              .preconditioner ==
+            Parameters::LinearSolver::PreconditionerType::schur))
     setup_GMG();
   else
     AssertThrow(
@@ -2939,7 +4062,7 @@ FluidDynamicsMatrixFree<dim>::setup_preconditioner()
             .preconditioner ==
           Parameters::LinearSolver::PreconditionerType::amg,
       ExcMessage(
-        "This linear solver does not support this preconditioner. Only <ilu|lsmg|gcmg> preconditioners are supported."));
+        "This linear solver does not support this preconditioner. Only <ilu|lsmg|gcmg|schur> preconditioners are supported."));
 }
 
 template <int dim>
@@ -3015,13 +4138,20 @@ FluidDynamicsMatrixFree<dim>::solve_system_GMRES(const bool   initial_step,
          .preconditioner ==
        Parameters::LinearSolver::PreconditionerType::lsmg) ||
       (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
-         .preconditioner == Parameters::LinearSolver::PreconditionerType::gcmg))
+         .preconditioner ==
+       Parameters::LinearSolver::PreconditionerType::gcmg) ||
+      (this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+         .preconditioner ==
+       Parameters::LinearSolver::PreconditionerType::schur))
     {
       solver.solve(*(this->system_operator),
                    this->newton_update,
                    this->system_rhs,
                    *(this->gmg_preconditioner));
 
+      this->gmg_preconditioner->monitor_outer_iterations(
+        solver_control.last_step());
+
       if (this->simulation_parameters.linear_solver
             .at(PhysicsID::fluid_dynamics)
             .mg_verbosity != Parameters::Verbosity::quiet)
@@ -3045,9 +4175,12 @@ FluidDynamicsMatrixFree<dim>::solve_system_GMRES(const bool   initial_step,
           Parameters::LinearSolver::PreconditionerType::lsmg ||
         this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
             .preconditioner ==
-          Parameters::LinearSolver::PreconditionerType::gcmg,
+          Parameters::LinearSolver::PreconditionerType::gcmg ||
+        this->simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+            .preconditioner ==
+          Parameters::LinearSolver::PreconditionerType::schur,
       ExcMessage(
-        "This linear solver does not support this preconditioner. Only <ilu|lsmg|gcmg> preconditioners are supported."));
+        "This linear solver does not support this preconditioner. Only <ilu|lsmg|gcmg|schur> preconditioners are supported."));
 
   this->computing_timer.leave_subsection("Solve linear system");
 
@@ -16,6 +16,7 @@
 #include "solvers/fluid_dynamics_matrix_free_operators.h"
 
 #include <deal.II/grid/grid_generator.h>
+
 /**
  * @brief Creates and fills a table that works as bool dof mask object
  * needed for the sparsity pattern and computation of the system matrix
@@ -200,18 +201,22 @@ NavierStokesOperatorBase<dim, number>::reinit(
   for (unsigned int i_bc = 0; i_bc < boundary_conditions.size; ++i_bc)
     {
       if (boundary_conditions.type[i_bc] ==
-          BoundaryConditions::BoundaryType::function_weak)
+            BoundaryConditions::BoundaryType::function_weak ||
+          boundary_conditions.type[i_bc] ==
+            BoundaryConditions::BoundaryType::pressure)
         {
           this->enable_face_terms = true;
-          additional_data.mapping_update_flags_boundary_faces =
+          additional_data.mapping_update_flags_boundary_faces |=
             update_values | update_gradients | update_quadrature_points |
             update_JxW_values | update_normal_vectors;
         }
       else if (boundary_conditions.type[i_bc] ==
-               BoundaryConditions::BoundaryType::outlet)
+                 BoundaryConditions::BoundaryType::outlet ||
+               boundary_conditions.type[i_bc] ==
+                 BoundaryConditions::BoundaryType::partial_slip)
         {
           this->enable_face_terms = true;
-          additional_data.mapping_update_flags_boundary_faces =
+          additional_data.mapping_update_flags_boundary_faces |=
             update_values | update_quadrature_points | update_JxW_values |
             update_normal_vectors;
         }
@@ -220,6 +225,11 @@ NavierStokesOperatorBase<dim, number>::reinit(
   matrix_free.reinit(
     mapping, dof_handler, this->constraints, quadrature, additional_data);
 
+  // The integrators of the linearization data refer to the previous
+  // matrix-free data and are created again in the next cell integrals
+  this->linearization_integrator_storage.clear();
+  this->time_derivatives_integrator_storage.clear();
+
   this->fe_degree = dof_handler.get_fe().degree;
 
   this->forcing_function = forcing_function;
@@ -793,12 +803,30 @@ NavierStokesOperatorBase<dim, number>::
 
   // 1. Precompute values on cells:
 
-  // Set appropriate size for tables
-  nonlinear_previous_values.reinit(n_cells, integrator.n_q_points);
-  nonlinear_previous_gradient.reinit(n_cells, integrator.n_q_points);
-  nonlinear_previous_hessian_diagonal.reinit(n_cells, integrator.n_q_points);
-  stabilization_parameter.reinit(n_cells, integrator.n_q_points);
-  stabilization_parameter_lsic.reinit(n_cells, integrator.n_q_points);
+  // If the linearization data is recomputed on the fly, only the DoF values
+  // of the linearization point are stored and the tables are released
+  if (this->recompute_linearization)
+    {
+      matrix_free.initialize_dof_vector(linearization_point);
+      linearization_point.copy_locally_owned_data_from(newton_step);
+      linearization_point.update_ghost_values();
+
+      nonlinear_previous_values.reinit(0, 0);
+      nonlinear_previous_gradient.reinit(0, 0);
+      nonlinear_previous_hessian_diagonal.reinit(0, 0);
+      stabilization_parameter.reinit(0, 0);
+      stabilization_parameter_lsic.reinit(0, 0);
+    }
+  else
+    {
+      // Set appropriate size for tables
+      nonlinear_previous_values.reinit(n_cells, integrator.n_q_points);
+      nonlinear_previous_gradient.reinit(n_cells, integrator.n_q_points);
+      nonlinear_previous_hessian_diagonal.reinit(n_cells,
+                                                 integrator.n_q_points);
+      stabilization_parameter.reinit(n_cells, integrator.n_q_points);
+      stabilization_parameter_lsic.reinit(n_cells, integrator.n_q_points);
+    }
 
   // Define 1/dt if the simulation is transient
   double sdt = 0.0;
@@ -814,45 +842,42 @@ NavierStokesOperatorBase<dim, number>::
       sdt             = 1. / dt;
     }
 
-  for (unsigned int cell = 0; cell < n_cells; ++cell)
+  if (!this->recompute_linearization)
     {
-      integrator.reinit(cell);
-      integrator.read_dof_values_plain(newton_step);
-
-      if (this->enable_hessians_jacobian)
-        integrator.evaluate(EvaluationFlags::values |
-                            EvaluationFlags::gradients |
-                            EvaluationFlags::hessians);
-      else
-        integrator.evaluate(EvaluationFlags::values |
-                            EvaluationFlags::gradients);
-
-      // Get previously calculated element size needed for tau
-      const auto h = integrator.read_cell_data(this->get_element_size());
-
-      for (const auto q : integrator.quadrature_point_indices())
+      for (unsigned int cell = 0; cell < n_cells; ++cell)
         {
-          nonlinear_previous_values(cell, q)   = integrator.get_value(q);
-          nonlinear_previous_gradient(cell, q) = integrator.get_gradient(q);
+          integrator.reinit(cell);
+          integrator.read_dof_values_plain(newton_step);
 
           if (this->enable_hessians_jacobian)
-            nonlinear_previous_hessian_diagonal(cell, q) =
-              integrator.get_hessian_diagonal(q);
-
-          // Calculate tau
-          VectorizedArray<number> u_mag_squared = 1e-12;
-          for (unsigned int k = 0; k < dim; ++k)
-            u_mag_squared +=
-              Utilities::fixed_power<2>(integrator.get_value(q)[k]);
+            integrator.evaluate(EvaluationFlags::values |
+                                EvaluationFlags::gradients |
+                                EvaluationFlags::hessians);
+          else
+            integrator.evaluate(EvaluationFlags::values |
+                                EvaluationFlags::gradients);
 
-          stabilization_parameter(cell, q) =
-            1. / std::sqrt(Utilities::fixed_power<2>(sdt) +
-                           4. * u_mag_squared / h / h +
-                           9. * Utilities::fixed_power<2>(
-                                  4. * this->kinematic_viscosity / (h * h)));
+          // Get previously calculated element size needed for tau
+          const auto h = integrator.read_cell_data(this->get_element_size());
 
-          stabilization_parameter_lsic(cell, q) =
-            std::sqrt(u_mag_squared) * h * 0.5;
+          for (const auto q : integrator.quadrature_point_indices())
+            {
+              nonlinear_previous_values(cell, q) = integrator.get_value(q);
+              nonlinear_previous_gradient(cell, q) =
+                integrator.get_gradient(q);
+
+              if (this->enable_hessians_jacobian)
+                nonlinear_previous_hessian_diagonal(cell, q) =
+                  integrator.get_hessian_diagonal(q);
+
+              // Calculate tau
+              compute_stabilization_parameters(
+                integrator.get_value(q),
+                h,
+                sdt,
+                stabilization_parameter(cell, q),
+                stabilization_parameter_lsic(cell, q));
+            }
         }
     }
 
@@ -862,6 +887,7 @@ NavierStokesOperatorBase<dim, number>::
     {
       effective_beta_face.reinit(n_boundary_faces);
       face_target_velocity.reinit(n_boundary_faces, face_integrator.n_q_points);
+      face_target_pressure.reinit(n_boundary_faces, face_integrator.n_q_points);
       face_nonlinear_previous_values.reinit(n_boundary_faces,
                                             face_integrator.n_q_points);
 
@@ -890,13 +916,14 @@ NavierStokesOperatorBase<dim, number>::
           const auto boundary_index =
             boundary_id - this->boundary_conditions.id.begin();
 
-          // Check if the boundary condition is a weak Dirichlet boundary
-          // condition or an outlet boundary condition, otherwise, no terms
+          // Check if the boundary condition is a weak Dirichlet, an outlet, a
+          // pressure or a partial slip boundary condition, otherwise, no terms
           // need to be precomputed for faces
-          if (this->boundary_conditions.type[boundary_index] !=
-                BoundaryConditions::BoundaryType::function_weak &&
-              this->boundary_conditions.type[boundary_index] !=
-                BoundaryConditions::BoundaryType::outlet)
+          const auto type = this->boundary_conditions.type[boundary_index];
+          if (type != BoundaryConditions::BoundaryType::function_weak &&
+              type != BoundaryConditions::BoundaryType::outlet &&
+              type != BoundaryConditions::BoundaryType::pressure &&
+              type != BoundaryConditions::BoundaryType::partial_slip)
             continue;
 
           // We need to read the values for the outlet boundary condition
@@ -910,8 +937,8 @@ NavierStokesOperatorBase<dim, number>::
 
           for (const auto q : face_integrator.quadrature_point_indices())
             {
-              if (this->boundary_conditions.type[boundary_index] ==
-                  BoundaryConditions::BoundaryType::function_weak)
+              if (type == BoundaryConditions::BoundaryType::function_weak ||
+                  type == BoundaryConditions::BoundaryType::partial_slip)
                 {
                   Point<dim, VectorizedArray<number>> point_batch =
                     face_integrator.quadrature_point(q);
@@ -934,12 +961,18 @@ NavierStokesOperatorBase<dim, number>::
                   face_target_velocity(face - n_inner_faces, q) =
                     target_velocity_value;
                 }
-              else if (this->boundary_conditions.type[boundary_index] ==
-                       BoundaryConditions::BoundaryType::outlet)
+              else if (type == BoundaryConditions::BoundaryType::outlet)
                 {
                   face_nonlinear_previous_values[face - n_inner_faces][q] =
                     face_integrator.get_value(q);
                 }
+              else if (type == BoundaryConditions::BoundaryType::pressure)
+                {
+                  face_target_pressure(face - n_inner_faces, q) =
+                    evaluate_function<dim, number>(
+                      boundary_conditions.bcPressureFunction[boundary_index].p,
+                      face_integrator.quadrature_point(q));
+                }
             }
 
           // Calculate the element size and use it to calculate the penalty
@@ -972,6 +1005,22 @@ NavierStokesOperatorBase<dim, number>::
   const unsigned int n_cells = matrix_free.n_cell_batches();
   FECellIntegrator   integrator(matrix_free);
 
+  // If the linearization data is recomputed on the fly, only the DoF values
+  // of the time derivatives are stored
+  if (this->recompute_linearization)
+    {
+      matrix_free.initialize_dof_vector(linearization_time_derivatives);
+      linearization_time_derivatives.copy_locally_owned_data_from(
+        time_derivative_previous_solutions);
+      linearization_time_derivatives.update_ghost_values();
+
+      time_derivatives_previous_solutions.reinit(0, 0);
+
+      this->timer.leave_subsection(
+        "operator::evaluate_time_derivative_previous_solutions");
+      return;
+    }
+
   time_derivatives_previous_solutions.reinit(n_cells, integrator.n_q_points);
 
   for (unsigned int cell = 0; cell < n_cells; ++cell)
@@ -987,6 +1036,27 @@ NavierStokesOperatorBase<dim, number>::
     "operator::evaluate_time_derivative_previous_solutions");
 }
 
+template <int dim, typename number>
+void
+NavierStokesOperatorBase<dim, number>::compute_stabilization_parameters(
+  const Tensor<1, dim + 1, VectorizedArray<number>> &previous_values,
+  const VectorizedArray<number>                     &h,
+  const double                                       sdt,
+  VectorizedArray<number>                           &tau,
+  VectorizedArray<number>                           &tau_lsic) const
+{
+  VectorizedArray<number> u_mag_squared = 1e-12;
+  for (unsigned int k = 0; k < dim; ++k)
+    u_mag_squared += Utilities::fixed_power<2>(previous_values[k]);
+
+  tau = 1. / std::sqrt(Utilities::fixed_power<2>(sdt) +
+                       4. * u_mag_squared / h / h +
+                       9. * Utilities::fixed_power<2>(
+                              4. * this->kinematic_viscosity / (h * h)));
+
+  tau_lsic = std::sqrt(u_mag_squared) * h * 0.5;
+}
+
 template <int dim, typename number>
 void
 NavierStokesOperatorBase<dim, number>::update_beta_force(
@@ -1130,12 +1200,19 @@ NavierStokesOperatorBase<dim, number>::do_boundary_face_integral_range(
 
 
 // Assembles face terms of boundary conditions for both the Jacobian matrix
-// and the residual. There are two types implemented:
+// and the residual. There are four types implemented:
 // 1. Weak Dirichlet boundary conditions using Nitsche's symmetric
 // penalty method. It adds the following term:
 // (v,β·(u-u_target)) - ν(v,∇δu·n) - ν(∇v·n,(u-u_target))
 // 2. Outlet boundary conditions using the directional do-nothing method.
 // It adds the following term: -(v,β(u·n)_·u) where (u·n)_=min(0,u·n)
+// 3. Pressure boundary conditions. It adds the following term:
+// (v,p_target n) + ν(v,∇u·n)
+// 4. Partial slip boundary conditions, where the normal component of the
+// velocity is penalized and the tangential one is subjected to a friction
+// β_t = ν/δ with δ the boundary layer thickness. Like the matrix-based
+// assembler, the projection is applied component-wise:
+// (v_d,β n_d n_d (u_d-u_target_d)) + (v_d,β_t (1-n_d n_d)(u_d-u_target_d))
 template <int dim, typename number>
 template <bool assemble_residual>
 void
@@ -1154,14 +1231,18 @@ NavierStokesOperatorBase<dim, number>::do_boundary_face_integral_local(
     boundary_id - this->boundary_conditions.id.begin();
 
   // If the boundary condition is not in our list of boundary
-  // conditions or the boundary condition that is set in the list is
-  // not a weak function or outlet BC, there is nothing to do, so we set the
+  // conditions or the boundary condition that is set in the list does
+  // not have face terms, there is nothing to do, so we set the
   // values to zero and return
   if (boundary_id == this->boundary_conditions.id.end() ||
       (this->boundary_conditions.type[boundary_index] !=
          BoundaryConditions::BoundaryType::function_weak &&
        this->boundary_conditions.type[boundary_index] !=
-         BoundaryConditions::BoundaryType::outlet))
+         BoundaryConditions::BoundaryType::outlet &&
+       this->boundary_conditions.type[boundary_index] !=
+         BoundaryConditions::BoundaryType::pressure &&
+       this->boundary_conditions.type[boundary_index] !=
+         BoundaryConditions::BoundaryType::partial_slip))
     {
       const VectorizedArray<number> zero = 0.0;
 
@@ -1243,7 +1324,7 @@ NavierStokesOperatorBase<dim, number>::do_boundary_face_integral_local(
             {
               // Only use the previous velocity values for the Jacobian
               for (unsigned int d = 0; d < dim; ++d)
-                velocity[d] = face_nonlinear_previous_values[face][q][d];
+                velocity[d] = face_nonlinear_previous_values[face_index][q][d];
             }
 
           // (u·n)_=min(0,u·n)
@@ -1262,6 +1343,78 @@ NavierStokesOperatorBase<dim, number>::do_boundary_face_integral_local(
       integrator.integrate(EvaluationFlags::EvaluationFlags::values);
     }
 
+  else if (this->boundary_conditions.type[boundary_index] ==
+           BoundaryConditions::BoundaryType::pressure)
+    {
+      integrator.evaluate(EvaluationFlags::EvaluationFlags::gradients);
+
+      for (const auto q : integrator.quadrature_point_indices())
+        {
+          typename FEFaceIntegrator::value_type value_result = {};
+
+          const auto normal_vector = integrator.get_normal_vector(q);
+
+          const auto gradient = integrator.get_gradient(q);
+
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              // Assemble ν(v,∇δu·n)
+              for (unsigned int i = 0; i < dim; ++i)
+                value_result[d] +=
+                  kinematic_viscosity * gradient[d][i] * normal_vector[i];
+
+              // Assemble (v,p_target n), which only appears in the residual
+              if constexpr (assemble_residual)
+                value_result[d] +=
+                  this->face_target_pressure[face_index][q] * normal_vector[d];
+            }
+
+          integrator.submit_value(value_result, q);
+        }
+
+      integrator.integrate(EvaluationFlags::EvaluationFlags::values);
+    }
+
+  else if (this->boundary_conditions.type[boundary_index] ==
+           BoundaryConditions::BoundaryType::partial_slip)
+    {
+      integrator.evaluate(EvaluationFlags::EvaluationFlags::values);
+
+      const VectorizedArray<number> beta_tangent =
+        kinematic_viscosity /
+        this->boundary_conditions.boundary_layer_thickness[boundary_index];
+
+      for (const auto q : integrator.quadrature_point_indices())
+        {
+          typename FEFaceIntegrator::value_type value_result = {};
+
+          const auto normal_vector = integrator.get_normal_vector(q);
+
+          auto value = integrator.get_value(q);
+
+          // If we are assembling the residual, substract the target velocity
+          // from the velocity value.
+          if constexpr (assemble_residual)
+            for (unsigned int d = 0; d < dim; ++d)
+              value[d] -= this->face_target_velocity[face_index][q][d];
+
+          for (unsigned int d = 0; d < dim; ++d)
+            {
+              const auto normal_value =
+                normal_vector[d] * normal_vector[d] * value[d];
+
+              // Assemble the penalization of the normal component and the
+              // friction on the tangential component
+              value_result[d] += penalty_parameter * normal_value +
+                                 beta_tangent * (value[d] - normal_value);
+            }
+
+          integrator.submit_value(value_result, q);
+        }
+
+      integrator.integrate(EvaluationFlags::EvaluationFlags::values);
+    }
+
 #endif
 }
 
@@ -1289,6 +1442,8 @@ NavierStokesOperatorBase<dim, number>::get_refinement_edges(
 
 template class NavierStokesOperatorBase<2, double>;
 template class NavierStokesOperatorBase<3, double>;
+template class NavierStokesOperatorBase<2, float>;
+template class NavierStokesOperatorBase<3, float>;
 
 template <int dim, typename number>
 NavierStokesStabilizedOperator<dim, number>::NavierStokesStabilizedOperator() =
@@ -1328,6 +1483,56 @@ NavierStokesStabilizedOperator<dim, number>::do_cell_integral_local(
   if (transient)
     bdf_coefs = &this->simulation_control->get_bdf_coefficients();
 
+  // If the linearization data is not stored at the quadrature points, the
+  // linearization point and the time derivatives are re-interpolated from
+  // their DoF values
+  FECellIntegrator       *previous_integrator         = nullptr;
+  FECellIntegrator       *time_derivatives_integrator = nullptr;
+  VectorizedArray<number> h;
+  double                  sdt = 0.0;
+
+  if (this->recompute_linearization)
+    {
+      Assert(this->linearization_point.size() > 0,
+             ExcMessage("The linearization point must be evaluated before "
+                        "the cell integrals."));
+      auto &linearization_integrator =
+        this->linearization_integrator_storage.get();
+      if (!linearization_integrator)
+        linearization_integrator.emplace(this->matrix_free);
+      previous_integrator = &*linearization_integrator;
+      previous_integrator->reinit(cell);
+      previous_integrator->read_dof_values_plain(this->linearization_point);
+
+      if (this->enable_hessians_jacobian)
+        previous_integrator->evaluate(EvaluationFlags::values |
+                                      EvaluationFlags::gradients |
+                                      EvaluationFlags::hessians);
+      else
+        previous_integrator->evaluate(EvaluationFlags::values |
+                                      EvaluationFlags::gradients);
+
+      h = integrator.read_cell_data(this->element_size);
+
+      if (transient)
+        {
+          Assert(this->linearization_time_derivatives.size() > 0,
+                 ExcMessage("The time derivatives must be evaluated before "
+                            "the cell integrals."));
+          auto &time_derivatives_storage =
+            this->time_derivatives_integrator_storage.get();
+          if (!time_derivatives_storage)
+            time_derivatives_storage.emplace(this->matrix_free);
+          time_derivatives_integrator = &*time_derivatives_storage;
+          time_derivatives_integrator->reinit(cell);
+          time_derivatives_integrator->read_dof_values_plain(
+            this->linearization_time_derivatives);
+          time_derivatives_integrator->evaluate(EvaluationFlags::values);
+
+          sdt = 1. / this->simulation_control->get_time_steps_vector()[0];
+        }
+    }
+
   for (const auto q : integrator.quadrature_point_indices())
     {
       Tensor<1, dim, VectorizedArray<number>> source_value;
@@ -1355,19 +1560,47 @@ NavierStokesStabilizedOperator<dim, number>::do_cell_integral_local(
       typename FECellIntegrator::hessian_type  hessian_result;
 
       // Gather previous values of the velocity and the pressure
-      auto previous_values   = this->nonlinear_previous_values(cell, q);
-      auto previous_gradient = this->nonlinear_previous_gradient(cell, q);
-      auto previous_hessian_diagonal =
-        this->nonlinear_previous_hessian_diagonal(cell, q);
+      Tensor<1, dim + 1, VectorizedArray<number>> previous_values;
+      Tensor<1, dim + 1, Tensor<1, dim, VectorizedArray<number>>>
+        previous_gradient;
+      Tensor<1, dim + 1, Tensor<1, dim, VectorizedArray<number>>>
+        previous_hessian_diagonal;
 
       Tensor<1, dim + 1, VectorizedArray<number>> previous_time_derivatives;
-      if (transient)
-        previous_time_derivatives =
-          this->time_derivatives_previous_solutions(cell, q);
 
-      // Get stabilization parameter
-      const auto tau      = this->stabilization_parameter[cell][q];
-      const auto tau_lsic = this->stabilization_parameter_lsic[cell][q];
+      // Stabilization parameters
+      VectorizedArray<number> tau;
+      VectorizedArray<number> tau_lsic;
+
+      if (this->recompute_linearization)
+        {
+          previous_values   = previous_integrator->get_value(q);
+          previous_gradient = previous_integrator->get_gradient(q);
+          if (this->enable_hessians_jacobian)
+            previous_hessian_diagonal =
+              previous_integrator->get_hessian_diagonal(q);
+
+          if (transient)
+            previous_time_derivatives =
+              time_derivatives_integrator->get_value(q);
+
+          this->compute_stabilization_parameters(
+            previous_values, h, sdt, tau, tau_lsic);
+        }
+      else
+        {
+          previous_values   = this->nonlinear_previous_values(cell, q);
+          previous_gradient = this->nonlinear_previous_gradient(cell, q);
+          previous_hessian_diagonal =
+            this->nonlinear_previous_hessian_diagonal(cell, q);
+
+          if (transient)
+            previous_time_derivatives =
+              this->time_derivatives_previous_solutions(cell, q);
+
+          tau      = this->stabilization_parameter[cell][q];
+          tau_lsic = this->stabilization_parameter_lsic[cell][q];
+        }
 
       // Weak form Jacobian
       for (unsigned int i = 0; i < dim; ++i)
@@ -1551,6 +1784,49 @@ NavierStokesStabilizedOperator<dim, number>::local_evaluate_residual(
       if (transient)
         bdf_coefs = &this->simulation_control->get_bdf_coefficients();
 
+      // If the linearization data is not stored at the quadrature points, the
+      // stabilization parameters and the time derivatives are recomputed from
+      // the DoF values of the linearization point and of the time derivatives
+      FECellIntegrator       *previous_integrator         = nullptr;
+      FECellIntegrator       *time_derivatives_integrator = nullptr;
+      VectorizedArray<number> h;
+      double                  sdt = 0.0;
+
+      if (this->recompute_linearization)
+        {
+          Assert(this->linearization_point.size() > 0,
+                 ExcMessage("The linearization point must be evaluated before "
+                            "the residual."));
+          auto &linearization_integrator =
+            this->linearization_integrator_storage.get();
+          if (!linearization_integrator)
+            linearization_integrator.emplace(matrix_free);
+          previous_integrator = &*linearization_integrator;
+          previous_integrator->reinit(cell);
+          previous_integrator->read_dof_values_plain(this->linearization_point);
+          previous_integrator->evaluate(EvaluationFlags::values);
+
+          h = integrator.read_cell_data(this->element_size);
+
+          if (transient)
+            {
+              Assert(this->linearization_time_derivatives.size() > 0,
+                     ExcMessage("The time derivatives must be evaluated "
+                                "before the residual."));
+              auto &time_derivatives_storage =
+                this->time_derivatives_integrator_storage.get();
+              if (!time_derivatives_storage)
+                time_derivatives_storage.emplace(matrix_free);
+              time_derivatives_integrator = &*time_derivatives_storage;
+              time_derivatives_integrator->reinit(cell);
+              time_derivatives_integrator->read_dof_values_plain(
+                this->linearization_time_derivatives);
+              time_derivatives_integrator->evaluate(EvaluationFlags::values);
+
+              sdt = 1. / this->simulation_control->get_time_steps_vector()[0];
+            }
+        }
+
       for (const auto q : integrator.quadrature_point_indices())
         {
           Tensor<1, dim, VectorizedArray<number>> source_value;
@@ -1574,13 +1850,29 @@ NavierStokesStabilizedOperator<dim, number>::local_evaluate_residual(
 
           // Time derivatives of previous solutions
           Tensor<1, dim + 1, VectorizedArray<number>> previous_time_derivatives;
-          if (transient)
-            previous_time_derivatives =
-              this->time_derivatives_previous_solutions(cell, q);
 
-          // Get stabilization parameter
-          const auto tau      = this->stabilization_parameter[cell][q];
-          const auto tau_lsic = this->stabilization_parameter_lsic[cell][q];
+          // Stabilization parameters
+          VectorizedArray<number> tau;
+          VectorizedArray<number> tau_lsic;
+
+          if (this->recompute_linearization)
+            {
+              if (transient)
+                previous_time_derivatives =
+                  time_derivatives_integrator->get_value(q);
+
+              this->compute_stabilization_parameters(
+                previous_integrator->get_value(q), h, sdt, tau, tau_lsic);
+            }
+          else
+            {
+              if (transient)
+                previous_time_derivatives =
+                  this->time_derivatives_previous_solutions(cell, q);
+
+              tau      = this->stabilization_parameter[cell][q];
+              tau_lsic = this->stabilization_parameter_lsic[cell][q];
+            }
 
           // Result value/gradient we will use
           typename FECellIntegrator::value_type    value_result;
@@ -1721,3 +2013,5 @@ NavierStokesStabilizedOperator<dim, number>::local_evaluate_residual(
 
 template class NavierStokesStabilizedOperator<2, double>;
 template class NavierStokesStabilizedOperator<3, double>;
+template class NavierStokesStabilizedOperator<2, float>;
+template class NavierStokesStabilizedOperator<3, float>;
@@ -12,7 +12,9 @@
 
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/read_write_vector.h>
 #include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
 #include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_solver.h>
@@ -401,6 +403,12 @@ HeatTransfer<dim>::assemble_system_matrix()
 {
   TimerOutput::Scope t(this->computing_timer, "Assemble matrix");
 
+  if (this->use_matrix_free)
+    {
+      update_matrix_free();
+      return;
+    }
+
   this->system_matrix = 0;
   setup_assemblers();
 
@@ -429,14 +437,14 @@ HeatTransfer<dim>::assemble_system_matrix()
         this->simulation_parameters.multiphysics.vof_parameters.phase_filter);
     }
 
-  WorkStream::run(this->dof_handler.begin_active(),
-                  this->dof_handler.end(),
-                  *this,
-                  &HeatTransfer::assemble_local_system_matrix,
-                  &HeatTransfer::copy_local_matrix_to_global_matrix,
-                  scratch_data,
-                  StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
-                                            this->cell_quadrature->size()));
+  run_cell_assembly(this->dof_handler,
+                    assembly_coloring.get(),
+                    *this,
+                    &HeatTransfer::assemble_local_system_matrix,
+                    &HeatTransfer::copy_local_matrix_to_global_matrix,
+                    scratch_data,
+                    StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
+                                              this->cell_quadrature->size()));
 
   system_matrix.compress(VectorOperation::add);
 
@@ -596,14 +604,14 @@ HeatTransfer<dim>::assemble_system_rhs()
         this->simulation_parameters.multiphysics.vof_parameters.phase_filter);
     }
 
-  WorkStream::run(this->dof_handler.begin_active(),
-                  this->dof_handler.end(),
-                  *this,
-                  &HeatTransfer::assemble_local_system_rhs,
-                  &HeatTransfer::copy_local_rhs_to_global_rhs,
-                  scratch_data,
-                  StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
-                                            this->cell_quadrature->size()));
+  run_cell_assembly(this->dof_handler,
+                    assembly_coloring.get(),
+                    *this,
+                    &HeatTransfer::assemble_local_system_rhs,
+                    &HeatTransfer::copy_local_rhs_to_global_rhs,
+                    scratch_data,
+                    StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
+                                              this->cell_quadrature->size()));
 
   this->system_rhs.compress(VectorOperation::add);
 
@@ -1195,7 +1203,11 @@ void
 HeatTransfer<dim>::setup_dofs()
 {
   dof_handler.distribute_dofs(*fe);
-  DoFRenumbering::Cuthill_McKee(this->dof_handler);
+
+  // The levels of the geometric multigrid preconditioner use the default
+  // numbering of the DoFs
+  if (!this->use_matrix_free)
+    DoFRenumbering::Cuthill_McKee(this->dof_handler);
 
   auto mpi_communicator = triangulation->get_communicator();
 
@@ -1270,21 +1282,34 @@ HeatTransfer<dim>::setup_dofs()
   }
   zero_constraints.close();
 
-  // Sparse matrices initialization
-  DynamicSparsityPattern dsp(locally_relevant_dofs);
-  DoFTools::make_sparsity_pattern(this->dof_handler,
-                                  dsp,
-                                  nonzero_constraints,
-                                  /*keep_constrained_dofs = */ true);
-
-  SparsityTools::distribute_sparsity_pattern(dsp,
-                                             locally_owned_dofs,
-                                             mpi_communicator,
-                                             locally_relevant_dofs);
-  system_matrix.reinit(locally_owned_dofs,
-                       locally_owned_dofs,
-                       dsp,
-                       mpi_communicator);
+  if (this->use_matrix_free)
+    setup_matrix_free();
+  else
+    {
+      // Sparse matrices initialization
+      DynamicSparsityPattern dsp(locally_relevant_dofs);
+      DoFTools::make_sparsity_pattern(this->dof_handler,
+                                      dsp,
+                                      nonzero_constraints,
+                                      /*keep_constrained_dofs = */ true);
+
+      SparsityTools::distribute_sparsity_pattern(dsp,
+                                                 locally_owned_dofs,
+                                                 mpi_communicator,
+                                                 locally_relevant_dofs);
+      system_matrix.reinit(locally_owned_dofs,
+                           locally_owned_dofs,
+                           dsp,
+                           mpi_communicator);
+    }
+
+  // The cells are colored for the new mesh and constraints
+  if (this->simulation_parameters.fem_parameters.enable_colored_assembly)
+    {
+      if (!assembly_coloring)
+        assembly_coloring = std::make_shared<AssemblyColoring<dim>>();
+      assembly_coloring->reinit(this->dof_handler, zero_constraints);
+    }
 
   this->pcout << "   Number of thermal degrees of freedom: "
               << dof_handler.n_dofs() << std::endl;
@@ -1368,6 +1393,12 @@ HeatTransfer<dim>::solve_linear_system(const bool initial_step,
 {
   TimerOutput::Scope t(this->computing_timer, "Solve linear system");
 
+  if (this->use_matrix_free)
+    {
+      solve_linear_system_matrix_free(initial_step);
+      return;
+    }
+
   auto mpi_communicator = triangulation->get_communicator();
 
   const AffineConstraints<double> &constraints_used =
@@ -1442,6 +1473,138 @@ HeatTransfer<dim>::solve_linear_system(const bool initial_step,
   newton_update = completely_distributed_solution;
 }
 
+template <int dim>
+void
+HeatTransfer<dim>::setup_matrix_free()
+{
+  AssertThrow(!this->simulation_parameters.mesh.simplex,
+              ExcMessage("The matrix-free heat transfer solver does not "
+                         "support simplex meshes."));
+  AssertThrow(!this->simulation_parameters.multiphysics.VOF,
+              ExcMessage("The matrix-free heat transfer solver does not "
+                         "support VOF simulations."));
+  AssertThrow(!this->simulation_parameters.boundary_conditions_ht
+                 .has_convection_radiation_bc,
+              ExcMessage("The matrix-free heat transfer solver does not "
+                         "support convection-radiation boundary conditions."));
+  AssertThrow(!this->simulation_parameters.stabilization
+                 .heat_transfer_dcdd_stabilization,
+              ExcMessage("The matrix-free heat transfer solver does not "
+                         "support DCDD stabilization."));
+  AssertThrow(this->simulation_parameters.nitsche->number_solids == 0,
+              ExcMessage("The matrix-free heat transfer solver does not "
+                         "support Nitsche immersed solids."));
+  AssertThrow(!this->simulation_parameters.ale.enabled(),
+              ExcMessage("The matrix-free heat transfer solver does not "
+                         "support ALE."));
+
+  // The coefficients of the matrix-free operator are constant, which requires
+  // physical properties that do not depend on any field
+  const auto &properties_manager =
+    this->simulation_parameters.physical_properties_manager;
+  const auto density       = properties_manager.get_density();
+  const auto specific_heat = properties_manager.get_specific_heat();
+  const auto thermal_conductivity =
+    properties_manager.get_thermal_conductivity();
+
+  for (const field id : {field::temperature, field::pressure})
+    AssertThrow(!density->depends_on(id) && !specific_heat->depends_on(id) &&
+                  !thermal_conductivity->depends_on(id),
+                ExcMessage("The matrix-free heat transfer solver only "
+                           "supports constant physical properties."));
+
+  const std::map<field, double> field_values;
+
+  const double rho_cp =
+    density->value(field_values) * specific_heat->value(field_values);
+  const double k = thermal_conductivity->value(field_values);
+
+  std::set<types::boundary_id> dirichlet_boundary_ids;
+  for (unsigned int i_bc = 0;
+       i_bc < this->simulation_parameters.boundary_conditions_ht.size;
+       ++i_bc)
+    if (this->simulation_parameters.boundary_conditions_ht.type[i_bc] ==
+        BoundaryConditions::BoundaryType::temperature)
+      dirichlet_boundary_ids.insert(
+        this->simulation_parameters.boundary_conditions_ht.id[i_bc]);
+
+  system_operator = std::make_shared<AdvectionDiffusionOperator<dim, double>>();
+  system_operator->reinit(*this->temperature_mapping,
+                          this->dof_handler,
+                          this->zero_constraints,
+                          *this->cell_quadrature,
+                          rho_cp,
+                          k,
+                          this->GGLS,
+                          this->simulation_control);
+
+  gmg_preconditioner =
+    std::make_shared<MFAdvectionDiffusionPreconditionGMG<dim>>(
+      this->simulation_parameters.linear_solver.at(PhysicsID::heat_transfer),
+      this->dof_handler,
+      *this->temperature_mapping,
+      *this->cell_quadrature,
+      dirichlet_boundary_ids,
+      rho_cp,
+      k,
+      this->GGLS,
+      this->simulation_control);
+}
+
+template <int dim>
+void
+HeatTransfer<dim>::update_matrix_free()
+{
+  const DoFHandler<dim> *dof_handler_fluid =
+    multiphysics->get_dof_handler(PhysicsID::fluid_dynamics);
+
+  // Check if the velocity needs to be taken from the average velocity profile
+  // or the fluid solution
+  const bool use_average_velocity =
+    this->simulation_parameters.initial_condition->type ==
+      Parameters::InitialConditionType::average_velocity_profile &&
+    !this->simulation_parameters.multiphysics.fluid_dynamics &&
+    simulation_control->get_current_time() >
+      this->simulation_parameters.post_processing.initial_time;
+
+  if (multiphysics->fluid_dynamics_is_block())
+    system_operator->evaluate_velocity_and_calculate_tau(
+      *this->temperature_mapping,
+      *dof_handler_fluid,
+      use_average_velocity ?
+        *multiphysics->get_block_time_average_solution(
+          PhysicsID::fluid_dynamics) :
+        *multiphysics->get_block_solution(PhysicsID::fluid_dynamics));
+  else
+    system_operator->evaluate_velocity_and_calculate_tau(
+      *this->temperature_mapping,
+      *dof_handler_fluid,
+      use_average_velocity ?
+        *multiphysics->get_time_average_solution(PhysicsID::fluid_dynamics) :
+        *multiphysics->get_solution(PhysicsID::fluid_dynamics));
+
+  // The level operators only depend on the time step, the smoother and the
+  // coarse-grid solver are only rebuilt if it changed
+  gmg_preconditioner->initialize();
+}
+
+template <int dim>
+void
+HeatTransfer<dim>::solve_linear_system_matrix_free(const bool initial_step)
+{
+  const AffineConstraints<double> &constraints_used =
+    initial_step ? nonzero_constraints : this->zero_constraints;
+
+  solve_advection_diffusion_matrix_free(
+    *system_operator,
+    *gmg_preconditioner,
+    this->simulation_parameters.linear_solver.at(PhysicsID::heat_transfer),
+    this->system_rhs,
+    constraints_used,
+    this->newton_update,
+    this->pcout);
+}
+
 template <int dim>
 void
 HeatTransfer<dim>::postprocess_temperature_statistics(
@@ -1833,8 +1996,8 @@ HeatTransfer<dim>::postprocess_heat_flux_on_bc(
   // Initialize fluid properties
   auto &properties_manager =
     this->simulation_parameters.physical_properties_manager;
-  std::map<field, double>              field_values;
-  std::map<field, std::vector<double>> fields;
+  std::map<field, double> field_values;
+  FieldVectors            fields;
 
   // monophase flow
   double density(0.);
@@ -2133,8 +2296,8 @@ HeatTransfer<dim>::postprocess_thermal_energy_in_fluid(
   // Initialize fluid properties
   auto &properties_manager =
     this->simulation_parameters.physical_properties_manager;
-  std::map<field, double>              field_values;
-  std::map<field, std::vector<double>> fields;
+  std::map<field, double> field_values;
+  FieldVectors            fields;
 
   // monophase flow
   double density(0.);
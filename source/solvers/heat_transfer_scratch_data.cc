@@ -57,18 +57,6 @@ HeatTransferScratchData<dim>::allocate()
     n_q_points, std::vector<Tensor<2, dim>>(n_dofs));
   this->laplacian_phi_T =
     std::vector<std::vector<double>>(n_q_points, std::vector<double>(n_dofs));
-
-  // Physical properties
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::temperature, n_q_points));
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::temperature_p1, n_q_points));
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::temperature_p2, n_q_points));
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::shear_rate, n_q_points));
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::pressure, n_q_points));
 }
 
 template <int dim>
@@ -143,19 +131,13 @@ template <int dim>
 void
 HeatTransferScratchData<dim>::calculate_physical_properties()
 {
-  set_field_vector(field::temperature,
-                   this->present_temperature_values,
-                   this->fields);
+  fields.set(field::temperature, this->present_temperature_values);
 
   if (properties_manager.field_is_required(field::temperature_p1))
-    set_field_vector(field::temperature_p1,
-                     this->previous_temperature_values[0],
-                     this->fields);
+    fields.set(field::temperature_p1, this->previous_temperature_values[0]);
 
   if (properties_manager.field_is_required(field::temperature_p2))
-    set_field_vector(field::temperature_p2,
-                     this->previous_temperature_values[1],
-                     this->fields);
+    fields.set(field::temperature_p2, this->previous_temperature_values[1]);
 
   if (properties_manager.field_is_required(field::shear_rate))
     {
@@ -171,12 +153,12 @@ HeatTransferScratchData<dim>::calculate_physical_properties()
             calculate_shear_rate_magnitude(shear_rate_tensor);
         }
 
-      set_field_vector(field::shear_rate, shear_rate_values, this->fields);
+      fields.set(field::shear_rate, shear_rate_values);
     }
 
   if (properties_manager.field_is_required(field::pressure))
     {
-      set_field_vector(field::pressure, this->pressure_values, this->fields);
+      fields.set(field::pressure, this->pressure_values);
     }
 
   if (material_id < 1 || properties_manager.get_number_of_solids() < 1)
@@ -73,6 +73,8 @@ MultiphysicsInterface<dim>::MultiphysicsInterface(
   // ,
   // verbosity(nsparam.non_linear_solver.at(PhysicsID::fluid_dynamics).verbosity)
   , pcout(p_pcout)
+  , coupling_acceleration(
+      nsparam.multiphysics.coupling_parameters.anderson_depth)
 {
   inspect_multiphysics_models_dependencies(nsparam);
 
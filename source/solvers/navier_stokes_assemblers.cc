@@ -11,6 +11,20 @@ void
 PSPGSUPGNavierStokesAssemblerCore<dim>::assemble_matrix(
   NavierStokesScratchData<dim>         &scratch_data,
   StabilizedMethodsTensorCopyData<dim> &copy_data)
+{
+  const NavierStokesTimeSteppingData time_data(*this->simulation_control);
+
+  for (unsigned int q = 0; q < scratch_data.n_q_points; ++q)
+    assemble_matrix_at_quadrature_point(q, time_data, scratch_data, copy_data);
+}
+
+template <int dim>
+void
+PSPGSUPGNavierStokesAssemblerCore<dim>::assemble_matrix_at_quadrature_point(
+  const unsigned int                    q,
+  const NavierStokesTimeSteppingData   &time_data,
+  NavierStokesScratchData<dim>         &scratch_data,
+  StabilizedMethodsTensorCopyData<dim> &copy_data) const
 {
   // Scheme and physical properties
   const std::vector<double> &viscosity_vector =
@@ -20,164 +34,154 @@ PSPGSUPGNavierStokesAssemblerCore<dim>::assemble_matrix(
     scratch_data.kinematic_viscosity_for_stabilization;
 
   // Loop and quadrature information
-  const auto        &JxW_vec    = scratch_data.JxW;
-  const unsigned int n_q_points = scratch_data.n_q_points;
-  const unsigned int n_dofs     = scratch_data.n_dofs;
-  const double       h          = scratch_data.cell_size;
+  const auto        &JxW_vec = scratch_data.JxW;
+  const unsigned int n_dofs  = scratch_data.n_dofs;
+  const double       h       = scratch_data.cell_size;
 
   // Copy data elements
   auto &strong_residual_vec = copy_data.strong_residual;
   auto &strong_jacobian_vec = copy_data.strong_jacobian;
   auto &local_matrix        = copy_data.local_matrix;
 
-  // Time steps and inverse time steps which is used for stabilization constant
-  std::vector<double> time_steps_vector =
-    this->simulation_control->get_time_steps_vector();
-  const double dt  = time_steps_vector[0];
-  const double sdt = 1. / dt;
+  // Inverse time step which is used for stabilization constant
+  const double sdt = time_data.sdt;
 
   // Pressure scaling factor
   const double pressure_scaling_factor = scratch_data.pressure_scaling_factor;
 
-  // Loop over the quadrature points
-  for (unsigned int q = 0; q < n_q_points; ++q)
-    {
-      // Gather into local variables the relevant fields
-      const double          kinematic_viscosity = viscosity_vector[q];
-      const Tensor<1, dim> &velocity = scratch_data.velocity_values[q];
-      const Tensor<2, dim> &velocity_gradient =
-        scratch_data.velocity_gradients[q];
-      const Tensor<1, dim> &velocity_laplacian =
-        scratch_data.velocity_laplacians[q];
-
-      const Tensor<1, dim> &pressure_gradient =
-        scratch_data.pressure_gradients[q];
-
-      // Forcing term
-      const Tensor<1, dim> &force       = scratch_data.force[q];
-      double                mass_source = scratch_data.mass_source[q];
+  // Gather into local variables the relevant fields
+  const double          kinematic_viscosity = viscosity_vector[q];
+  const Tensor<1, dim> &velocity            = scratch_data.velocity_values[q];
+  const Tensor<2, dim> &velocity_gradient = scratch_data.velocity_gradients[q];
+  const Tensor<1, dim> &velocity_laplacian =
+    scratch_data.velocity_laplacians[q];
+
+  const Tensor<1, dim> &pressure_gradient = scratch_data.pressure_gradients[q];
+
+  // Forcing term
+  const Tensor<1, dim> &force       = scratch_data.force[q];
+  double                mass_source = scratch_data.mass_source[q];
+
+  // Calculation of the magnitude of the velocity for the
+  // stabilization parameter
+  const double u_mag = std::max(velocity.norm(), 1e-12);
+
+  // Store JxW in local variable for faster access;
+  const double JxW = JxW_vec[q];
+
+  // Calculation of the GLS stabilization parameter. The
+  // stabilization parameter used is different if the simulation
+  // is steady or unsteady. In the unsteady case it includes the
+  // value of the time-step
+  const double tau =
+    this->simulation_control->get_assembly_method() ==
+        Parameters::SimulationControl::TimeSteppingMethod::steady ?
+      calculate_navier_stokes_gls_tau_steady(
+        u_mag, viscosity_for_stabilization_vector[q], h) :
+      calculate_navier_stokes_gls_tau_transient(
+        u_mag, viscosity_for_stabilization_vector[q], h, sdt);
+
+  // Calculate the strong residual for GLS stabilization
+  auto strong_residual = velocity_gradient * velocity + pressure_gradient -
+                         kinematic_viscosity * velocity_laplacian - force +
+                         mass_source * velocity + strong_residual_vec[q];
 
-      // Calculation of the magnitude of the velocity for the
-      // stabilization parameter
-      const double u_mag = std::max(velocity.norm(), 1e-12);
+  std::vector<Tensor<1, dim>> grad_phi_u_j_x_velocity(n_dofs);
+  std::vector<Tensor<1, dim>> velocity_gradient_x_phi_u_j(n_dofs);
 
-      // Store JxW in local variable for faster access;
-      const double JxW = JxW_vec[q];
 
-      // Calculation of the GLS stabilization parameter. The
-      // stabilization parameter used is different if the simulation
-      // is steady or unsteady. In the unsteady case it includes the
-      // value of the time-step
-      const double tau =
-        this->simulation_control->get_assembly_method() ==
-            Parameters::SimulationControl::TimeSteppingMethod::steady ?
-          calculate_navier_stokes_gls_tau_steady(
-            u_mag, viscosity_for_stabilization_vector[q], h) :
-          calculate_navier_stokes_gls_tau_transient(
-            u_mag, viscosity_for_stabilization_vector[q], h, sdt);
+  // We loop over the column first to prevent recalculation
+  // of the strong jacobian in the inner loop
+  for (unsigned int j = 0; j < n_dofs; ++j)
+    {
+      const auto &phi_u_j           = scratch_data.phi_u[q][j];
+      const auto &grad_phi_u_j      = scratch_data.grad_phi_u[q][j];
+      const auto &laplacian_phi_u_j = scratch_data.laplacian_phi_u[q][j];
 
-      // Calculate the strong residual for GLS stabilization
-      auto strong_residual = velocity_gradient * velocity + pressure_gradient -
-                             kinematic_viscosity * velocity_laplacian - force +
-                             mass_source * velocity + strong_residual_vec[q];
+      const auto &grad_phi_p_j =
+        pressure_scaling_factor * scratch_data.grad_phi_p[q][j];
 
-      std::vector<Tensor<1, dim>> grad_phi_u_j_x_velocity(n_dofs);
-      std::vector<Tensor<1, dim>> velocity_gradient_x_phi_u_j(n_dofs);
+      strong_jacobian_vec[q][j] +=
+        (velocity_gradient * phi_u_j + grad_phi_u_j * velocity +
+         grad_phi_p_j - kinematic_viscosity * laplacian_phi_u_j +
+         mass_source * phi_u_j);
 
+      // Store these temporary products in auxiliary variables for speed
+      grad_phi_u_j_x_velocity[j]     = grad_phi_u_j * velocity;
+      velocity_gradient_x_phi_u_j[j] = velocity_gradient * phi_u_j;
+    }
 
-      // We loop over the column first to prevent recalculation
-      // of the strong jacobian in the inner loop
-      for (unsigned int j = 0; j < n_dofs; ++j)
-        {
-          const auto &phi_u_j           = scratch_data.phi_u[q][j];
-          const auto &grad_phi_u_j      = scratch_data.grad_phi_u[q][j];
-          const auto &laplacian_phi_u_j = scratch_data.laplacian_phi_u[q][j];
 
-          const auto &grad_phi_p_j =
-            pressure_scaling_factor * scratch_data.grad_phi_p[q][j];
 
-          strong_jacobian_vec[q][j] +=
-            (velocity_gradient * phi_u_j + grad_phi_u_j * velocity +
-             grad_phi_p_j - kinematic_viscosity * laplacian_phi_u_j +
-             mass_source * phi_u_j);
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    {
+      const unsigned int component_i = scratch_data.components[i];
 
-          // Store these temporary products in auxiliary variables for speed
-          grad_phi_u_j_x_velocity[j]     = grad_phi_u_j * velocity;
-          velocity_gradient_x_phi_u_j[j] = velocity_gradient * phi_u_j;
-        }
+      const auto &phi_u_i      = scratch_data.phi_u[q][i];
+      const auto &grad_phi_u_i = scratch_data.grad_phi_u[q][i];
+      const auto &div_phi_u_i  = scratch_data.div_phi_u[q][i];
+      const auto &phi_p_i      = scratch_data.phi_p[q][i];
+      const auto &grad_phi_p_i = scratch_data.grad_phi_p[q][i];
 
 
+      // Store these temporary products in auxiliary variables for speed
+      const auto grad_phi_u_i_x_velocity = grad_phi_u_i * velocity;
+      const auto strong_residual_x_grad_phi_u_i =
+        strong_residual * grad_phi_u_i;
 
-      for (unsigned int i = 0; i < n_dofs; ++i)
+      for (unsigned int j = 0; j < n_dofs; ++j)
         {
-          const unsigned int component_i = scratch_data.components[i];
+          const unsigned int component_j = scratch_data.components[j];
 
-          const auto &phi_u_i      = scratch_data.phi_u[q][i];
-          const auto &grad_phi_u_i = scratch_data.grad_phi_u[q][i];
-          const auto &div_phi_u_i  = scratch_data.div_phi_u[q][i];
-          const auto &phi_p_i      = scratch_data.phi_p[q][i];
-          const auto &grad_phi_p_i = scratch_data.grad_phi_p[q][i];
+          const auto &phi_u_j = scratch_data.phi_u[q][j];
 
+          const auto &phi_p_j =
+            pressure_scaling_factor * scratch_data.phi_p[q][j];
 
-          // Store these temporary products in auxiliary variables for speed
-          const auto grad_phi_u_i_x_velocity = grad_phi_u_i * velocity;
-          const auto strong_residual_x_grad_phi_u_i =
-            strong_residual * grad_phi_u_i;
+          const auto &strong_jac = strong_jacobian_vec[q][j];
 
-          for (unsigned int j = 0; j < n_dofs; ++j)
+          double local_matrix_ij =
+            component_j == dim ? -div_phi_u_i * phi_p_j : 0;
+          if (component_i == dim)
             {
-              const unsigned int component_j = scratch_data.components[j];
-
-              const auto &phi_u_j = scratch_data.phi_u[q][j];
-
-              const auto &phi_p_j =
-                pressure_scaling_factor * scratch_data.phi_p[q][j];
+              const auto &div_phi_u_j = scratch_data.div_phi_u[q][j];
 
-              const auto &strong_jac = strong_jacobian_vec[q][j];
-
-              double local_matrix_ij =
-                component_j == dim ? -div_phi_u_i * phi_p_j : 0;
-              if (component_i == dim)
-                {
-                  const auto &div_phi_u_j = scratch_data.div_phi_u[q][j];
+              local_matrix_ij += phi_p_i * div_phi_u_j;
 
-                  local_matrix_ij += phi_p_i * div_phi_u_j;
-
-                  // PSPG GLS term
-                  local_matrix_ij += tau * (strong_jac * grad_phi_p_i);
-                }
+              // PSPG GLS term
+              local_matrix_ij += tau * (strong_jac * grad_phi_p_i);
+            }
 
-              if (component_i < dim && component_j < dim)
-                {
-                  const auto &grad_phi_u_j = scratch_data.grad_phi_u[q][j];
+          if (component_i < dim && component_j < dim)
+            {
+              const auto &grad_phi_u_j = scratch_data.grad_phi_u[q][j];
 
-                  local_matrix_ij += velocity_gradient_x_phi_u_j[j] * phi_u_i +
-                                     grad_phi_u_j_x_velocity[j] * phi_u_i;
+              local_matrix_ij += velocity_gradient_x_phi_u_j[j] * phi_u_i +
+                                 grad_phi_u_j_x_velocity[j] * phi_u_i;
 
-                  if (component_i == component_j)
-                    {
-                      local_matrix_ij +=
-                        kinematic_viscosity * (grad_phi_u_j[component_j] *
-                                               grad_phi_u_i[component_i]) +
-                        mass_source * phi_u_j * phi_u_i;
-                    }
-                }
-              if (component_i < dim)
+              if (component_i == component_j)
                 {
-                  // The jacobian matrix for the SUPG formulation
-                  // currently does not include the jacobian of the
-                  // stabilization parameter tau. Our experience has shown that
-                  // does not alter the number of newton iteration for
-                  // convergence, but greatly simplifies assembly.
-
                   local_matrix_ij +=
-                    tau * (strong_jac * grad_phi_u_i_x_velocity +
-                           strong_residual_x_grad_phi_u_i * phi_u_j);
+                    kinematic_viscosity * (grad_phi_u_j[component_j] *
+                                           grad_phi_u_i[component_i]) +
+                    mass_source * phi_u_j * phi_u_i;
                 }
-
-              local_matrix_ij *= JxW;
-              local_matrix(i, j) += local_matrix_ij;
             }
+          if (component_i < dim)
+            {
+              // The jacobian matrix for the SUPG formulation
+              // currently does not include the jacobian of the
+              // stabilization parameter tau. Our experience has shown that
+              // does not alter the number of newton iteration for
+              // convergence, but greatly simplifies assembly.
+
+              local_matrix_ij +=
+                tau * (strong_jac * grad_phi_u_i_x_velocity +
+                       strong_residual_x_grad_phi_u_i * phi_u_j);
+            }
+
+          local_matrix_ij *= JxW;
+          local_matrix(i, j) += local_matrix_ij;
         }
     }
 }
@@ -187,6 +191,20 @@ void
 PSPGSUPGNavierStokesAssemblerCore<dim>::assemble_rhs(
   NavierStokesScratchData<dim>         &scratch_data,
   StabilizedMethodsTensorCopyData<dim> &copy_data)
+{
+  const NavierStokesTimeSteppingData time_data(*this->simulation_control);
+
+  for (unsigned int q = 0; q < scratch_data.n_q_points; ++q)
+    assemble_rhs_at_quadrature_point(q, time_data, scratch_data, copy_data);
+}
+
+template <int dim>
+void
+PSPGSUPGNavierStokesAssemblerCore<dim>::assemble_rhs_at_quadrature_point(
+  const unsigned int                    q,
+  const NavierStokesTimeSteppingData   &time_data,
+  NavierStokesScratchData<dim>         &scratch_data,
+  StabilizedMethodsTensorCopyData<dim> &copy_data) const
 {
   // Scheme and physical properties
   const std::vector<double> &viscosity_vector =
@@ -196,101 +214,90 @@ PSPGSUPGNavierStokesAssemblerCore<dim>::assemble_rhs(
     scratch_data.kinematic_viscosity_for_stabilization;
 
   // Loop and quadrature information
-  const auto        &JxW_vec    = scratch_data.JxW;
-  const unsigned int n_q_points = scratch_data.n_q_points;
-  const unsigned int n_dofs     = scratch_data.n_dofs;
-  const double       h          = scratch_data.cell_size;
+  const auto        &JxW_vec = scratch_data.JxW;
+  const unsigned int n_dofs  = scratch_data.n_dofs;
+  const double       h       = scratch_data.cell_size;
 
   // Copy data elements
   auto &strong_residual_vec = copy_data.strong_residual;
   auto &local_rhs           = copy_data.local_rhs;
 
-  // Time steps and inverse time steps which is used for stabilization constant
-  std::vector<double> time_steps_vector =
-    this->simulation_control->get_time_steps_vector();
-  const double dt  = time_steps_vector[0];
-  const double sdt = 1. / dt;
-
-  // Loop over the quadrature points
-  for (unsigned int q = 0; q < n_q_points; ++q)
+  // Inverse time step which is used for stabilization constant
+  const double sdt = time_data.sdt;
+
+  // Physical properties
+  const double kinematic_viscosity = viscosity_vector[q];
+
+  // Velocity
+  const Tensor<1, dim> &velocity   = scratch_data.velocity_values[q];
+  const double velocity_divergence = scratch_data.velocity_divergences[q];
+  const Tensor<2, dim> &velocity_gradient = scratch_data.velocity_gradients[q];
+  const Tensor<1, dim> &velocity_laplacian =
+    scratch_data.velocity_laplacians[q];
+
+  // Pressure
+  const double          pressure = scratch_data.pressure_values[q];
+  const Tensor<1, dim> &pressure_gradient = scratch_data.pressure_gradients[q];
+
+  // Forcing term
+  const Tensor<1, dim> &force       = scratch_data.force[q];
+  double                mass_source = scratch_data.mass_source[q];
+  // Calculation of the magnitude of the
+  // velocity for the stabilization parameter
+  const double u_mag = std::max(velocity.norm(), 1e-12);
+
+  // Store JxW in local variable for faster access;
+  const double JxW = JxW_vec[q];
+
+  // Calculation of the GLS stabilization parameter. The
+  // stabilization parameter used is different if the simulation
+  // is steady or unsteady. In the unsteady case it includes the
+  // value of the time-step
+  const double tau =
+    this->simulation_control->get_assembly_method() ==
+        Parameters::SimulationControl::TimeSteppingMethod::steady ?
+      calculate_navier_stokes_gls_tau_steady(
+        u_mag, viscosity_for_stabilization_vector[q], h) :
+      calculate_navier_stokes_gls_tau_transient(
+        u_mag, viscosity_for_stabilization_vector[q], h, sdt);
+
+
+
+  // Calculate the strong residual for GLS stabilization
+  auto strong_residual = velocity_gradient * velocity + pressure_gradient -
+                         kinematic_viscosity * velocity_laplacian - force +
+                         mass_source * velocity + strong_residual_vec[q];
+
+  // Assembly of the right-hand side
+  for (unsigned int i = 0; i < n_dofs; ++i)
     {
-      // Physical properties
-      const double kinematic_viscosity = viscosity_vector[q];
-
-      // Velocity
-      const Tensor<1, dim> &velocity   = scratch_data.velocity_values[q];
-      const double velocity_divergence = scratch_data.velocity_divergences[q];
-      const Tensor<2, dim> &velocity_gradient =
-        scratch_data.velocity_gradients[q];
-      const Tensor<1, dim> &velocity_laplacian =
-        scratch_data.velocity_laplacians[q];
-
-      // Pressure
-      const double          pressure = scratch_data.pressure_values[q];
-      const Tensor<1, dim> &pressure_gradient =
-        scratch_data.pressure_gradients[q];
-
-      // Forcing term
-      const Tensor<1, dim> &force       = scratch_data.force[q];
-      double                mass_source = scratch_data.mass_source[q];
-      // Calculation of the magnitude of the
-      // velocity for the stabilization parameter
-      const double u_mag = std::max(velocity.norm(), 1e-12);
-
-      // Store JxW in local variable for faster access;
-      const double JxW = JxW_vec[q];
-
-      // Calculation of the GLS stabilization parameter. The
-      // stabilization parameter used is different if the simulation
-      // is steady or unsteady. In the unsteady case it includes the
-      // value of the time-step
-      const double tau =
-        this->simulation_control->get_assembly_method() ==
-            Parameters::SimulationControl::TimeSteppingMethod::steady ?
-          calculate_navier_stokes_gls_tau_steady(
-            u_mag, viscosity_for_stabilization_vector[q], h) :
-          calculate_navier_stokes_gls_tau_transient(
-            u_mag, viscosity_for_stabilization_vector[q], h, sdt);
-
-
-
-      // Calculate the strong residual for GLS stabilization
-      auto strong_residual = velocity_gradient * velocity + pressure_gradient -
-                             kinematic_viscosity * velocity_laplacian - force +
-                             mass_source * velocity + strong_residual_vec[q];
-
-      // Assembly of the right-hand side
-      for (unsigned int i = 0; i < n_dofs; ++i)
-        {
-          const auto &phi_u_i      = scratch_data.phi_u[q][i];
-          const auto &grad_phi_u_i = scratch_data.grad_phi_u[q][i];
-          const auto &phi_p_i      = scratch_data.phi_p[q][i];
-          const auto &grad_phi_p_i = scratch_data.grad_phi_p[q][i];
-          const auto &div_phi_u_i  = scratch_data.div_phi_u[q][i];
-
-          double local_rhs_i = 0;
-
-          // Navier-Stokes Residual
-          local_rhs_i +=
-            (
-              // Momentum
-              -kinematic_viscosity *
-                scalar_product(velocity_gradient, grad_phi_u_i) -
-              velocity_gradient * velocity * phi_u_i + pressure * div_phi_u_i +
-              force * phi_u_i - mass_source * velocity * phi_u_i -
-              // Continuity
-              velocity_divergence * phi_p_i + mass_source * phi_p_i) *
-            JxW;
-
-          // PSPG GLS term
-          local_rhs_i += -tau * (strong_residual * grad_phi_p_i) * JxW;
-
-          // SUPG GLS term
-          local_rhs_i +=
-            -tau * (strong_residual * (grad_phi_u_i * velocity)) * JxW;
-
-          local_rhs(i) += local_rhs_i;
-        }
+      const auto &phi_u_i      = scratch_data.phi_u[q][i];
+      const auto &grad_phi_u_i = scratch_data.grad_phi_u[q][i];
+      const auto &phi_p_i      = scratch_data.phi_p[q][i];
+      const auto &grad_phi_p_i = scratch_data.grad_phi_p[q][i];
+      const auto &div_phi_u_i  = scratch_data.div_phi_u[q][i];
+
+      double local_rhs_i = 0;
+
+      // Navier-Stokes Residual
+      local_rhs_i +=
+        (
+          // Momentum
+          -kinematic_viscosity *
+            scalar_product(velocity_gradient, grad_phi_u_i) -
+          velocity_gradient * velocity * phi_u_i + pressure * div_phi_u_i +
+          force * phi_u_i - mass_source * velocity * phi_u_i -
+          // Continuity
+          velocity_divergence * phi_p_i + mass_source * phi_p_i) *
+        JxW;
+
+      // PSPG GLS term
+      local_rhs_i += -tau * (strong_residual * grad_phi_p_i) * JxW;
+
+      // SUPG GLS term
+      local_rhs_i += -tau * (strong_residual * (grad_phi_u_i * velocity)) * JxW;
+
+      local_rhs(i) += local_rhs_i;
     }
 }
 
@@ -304,6 +311,20 @@ void
 GLSNavierStokesAssemblerCore<dim>::assemble_matrix(
   NavierStokesScratchData<dim>         &scratch_data,
   StabilizedMethodsTensorCopyData<dim> &copy_data)
+{
+  const NavierStokesTimeSteppingData time_data(*this->simulation_control);
+
+  for (unsigned int q = 0; q < scratch_data.n_q_points; ++q)
+    assemble_matrix_at_quadrature_point(q, time_data, scratch_data, copy_data);
+}
+
+template <int dim>
+void
+GLSNavierStokesAssemblerCore<dim>::assemble_matrix_at_quadrature_point(
+  const unsigned int                    q,
+  const NavierStokesTimeSteppingData   &time_data,
+  NavierStokesScratchData<dim>         &scratch_data,
+  StabilizedMethodsTensorCopyData<dim> &copy_data) const
 {
   // Scheme and physical properties
   const std::vector<double> &viscosity_vector =
@@ -313,172 +334,162 @@ GLSNavierStokesAssemblerCore<dim>::assemble_matrix(
     scratch_data.kinematic_viscosity_for_stabilization;
 
   // Loop and quadrature information
-  const auto        &JxW_vec    = scratch_data.JxW;
-  const unsigned int n_q_points = scratch_data.n_q_points;
-  const unsigned int n_dofs     = scratch_data.n_dofs;
-  const double       h          = scratch_data.cell_size;
+  const auto        &JxW_vec = scratch_data.JxW;
+  const unsigned int n_dofs  = scratch_data.n_dofs;
+  const double       h       = scratch_data.cell_size;
 
   // Copy data elements
   auto &strong_residual_vec = copy_data.strong_residual;
   auto &strong_jacobian_vec = copy_data.strong_jacobian;
   auto &local_matrix        = copy_data.local_matrix;
 
-  // Time steps and inverse time steps which is used for stabilization constant
-  std::vector<double> time_steps_vector =
-    this->simulation_control->get_time_steps_vector();
-  const double dt  = time_steps_vector[0];
-  const double sdt = 1. / dt;
+  // Inverse time step which is used for stabilization constant
+  const double sdt = time_data.sdt;
 
   // Pressure scaling factor
   const double pressure_scaling_factor = scratch_data.pressure_scaling_factor;
 
-  // Loop over the quadrature points
-  for (unsigned int q = 0; q < n_q_points; ++q)
-    {
-      // Gather into local variables the relevant fields
-      const double          kinematic_viscosity = viscosity_vector[q];
-      const Tensor<1, dim> &velocity = scratch_data.velocity_values[q];
-      const Tensor<2, dim> &velocity_gradient =
-        scratch_data.velocity_gradients[q];
-      const Tensor<1, dim> &velocity_laplacian =
-        scratch_data.velocity_laplacians[q];
+  // Gather into local variables the relevant fields
+  const double          kinematic_viscosity = viscosity_vector[q];
+  const Tensor<1, dim> &velocity            = scratch_data.velocity_values[q];
+  const Tensor<2, dim> &velocity_gradient = scratch_data.velocity_gradients[q];
+  const Tensor<1, dim> &velocity_laplacian =
+    scratch_data.velocity_laplacians[q];
 
-      const Tensor<1, dim> &pressure_gradient =
-        scratch_data.pressure_gradients[q];
+  const Tensor<1, dim> &pressure_gradient = scratch_data.pressure_gradients[q];
 
-      // Forcing term
-      const Tensor<1, dim> &force       = scratch_data.force[q];
-      double                mass_source = scratch_data.mass_source[q];
+  // Forcing term
+  const Tensor<1, dim> &force       = scratch_data.force[q];
+  double                mass_source = scratch_data.mass_source[q];
 
-      // Calculation of the magnitude of the velocity for the
-      // stabilization parameter
-      const double u_mag = std::max(velocity.norm(), 1e-12);
+  // Calculation of the magnitude of the velocity for the
+  // stabilization parameter
+  const double u_mag = std::max(velocity.norm(), 1e-12);
 
-      // Store JxW in local variable for faster access;
-      const double JxW = JxW_vec[q];
+  // Store JxW in local variable for faster access;
+  const double JxW = JxW_vec[q];
 
-      // Calculation of the GLS stabilization parameter. The
-      // stabilization parameter used is different if the simulation
-      // is steady or unsteady. In the unsteady case it includes the
-      // value of the time-step
-      const double tau =
-        this->simulation_control->get_assembly_method() ==
-            Parameters::SimulationControl::TimeSteppingMethod::steady ?
-          calculate_navier_stokes_gls_tau_steady(
-            u_mag, viscosity_for_stabilization_vector[q], h) :
-          calculate_navier_stokes_gls_tau_transient(
-            u_mag, viscosity_for_stabilization_vector[q], h, sdt);
+  // Calculation of the GLS stabilization parameter. The
+  // stabilization parameter used is different if the simulation
+  // is steady or unsteady. In the unsteady case it includes the
+  // value of the time-step
+  const double tau =
+    this->simulation_control->get_assembly_method() ==
+        Parameters::SimulationControl::TimeSteppingMethod::steady ?
+      calculate_navier_stokes_gls_tau_steady(
+        u_mag, viscosity_for_stabilization_vector[q], h) :
+      calculate_navier_stokes_gls_tau_transient(
+        u_mag, viscosity_for_stabilization_vector[q], h, sdt);
 
-      // LSIC stabilization term
-      const double tau_lsic = 0.5 * u_mag * h;
+  // LSIC stabilization term
+  const double tau_lsic = 0.5 * u_mag * h;
 
 
-      // Calculate the strong residual for GLS stabilization
-      auto strong_residual = velocity_gradient * velocity + pressure_gradient -
-                             kinematic_viscosity * velocity_laplacian - force +
-                             mass_source * velocity + strong_residual_vec[q];
+  // Calculate the strong residual for GLS stabilization
+  auto strong_residual = velocity_gradient * velocity + pressure_gradient -
+                         kinematic_viscosity * velocity_laplacian - force +
+                         mass_source * velocity + strong_residual_vec[q];
 
-      std::vector<Tensor<1, dim>> grad_phi_u_j_x_velocity(n_dofs);
-      std::vector<Tensor<1, dim>> velocity_gradient_x_phi_u_j(n_dofs);
+  std::vector<Tensor<1, dim>> grad_phi_u_j_x_velocity(n_dofs);
+  std::vector<Tensor<1, dim>> velocity_gradient_x_phi_u_j(n_dofs);
 
 
-      // We loop over the column first to prevent recalculation
-      // of the strong jacobian in the inner loop
-      for (unsigned int j = 0; j < n_dofs; ++j)
-        {
-          const auto &phi_u_j           = scratch_data.phi_u[q][j];
-          const auto &grad_phi_u_j      = scratch_data.grad_phi_u[q][j];
-          const auto &laplacian_phi_u_j = scratch_data.laplacian_phi_u[q][j];
+  // We loop over the column first to prevent recalculation
+  // of the strong jacobian in the inner loop
+  for (unsigned int j = 0; j < n_dofs; ++j)
+    {
+      const auto &phi_u_j           = scratch_data.phi_u[q][j];
+      const auto &grad_phi_u_j      = scratch_data.grad_phi_u[q][j];
+      const auto &laplacian_phi_u_j = scratch_data.laplacian_phi_u[q][j];
 
-          const auto &grad_phi_p_j =
-            pressure_scaling_factor * scratch_data.grad_phi_p[q][j];
+      const auto &grad_phi_p_j =
+        pressure_scaling_factor * scratch_data.grad_phi_p[q][j];
 
-          strong_jacobian_vec[q][j] +=
-            (velocity_gradient * phi_u_j + grad_phi_u_j * velocity +
-             grad_phi_p_j - kinematic_viscosity * laplacian_phi_u_j +
-             mass_source * phi_u_j);
+      strong_jacobian_vec[q][j] +=
+        (velocity_gradient * phi_u_j + grad_phi_u_j * velocity +
+         grad_phi_p_j - kinematic_viscosity * laplacian_phi_u_j +
+         mass_source * phi_u_j);
 
-          // Store these temporary products in auxiliary variables for speed
-          grad_phi_u_j_x_velocity[j]     = grad_phi_u_j * velocity;
-          velocity_gradient_x_phi_u_j[j] = velocity_gradient * phi_u_j;
-        }
+      // Store these temporary products in auxiliary variables for speed
+      grad_phi_u_j_x_velocity[j]     = grad_phi_u_j * velocity;
+      velocity_gradient_x_phi_u_j[j] = velocity_gradient * phi_u_j;
+    }
 
-      for (unsigned int i = 0; i < n_dofs; ++i)
-        {
-          const unsigned int component_i = scratch_data.components[i];
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    {
+      const unsigned int component_i = scratch_data.components[i];
 
-          const auto &phi_u_i           = scratch_data.phi_u[q][i];
-          const auto &grad_phi_u_i      = scratch_data.grad_phi_u[q][i];
-          const auto &div_phi_u_i       = scratch_data.div_phi_u[q][i];
-          const auto &phi_p_i           = scratch_data.phi_p[q][i];
-          const auto &grad_phi_p_i      = scratch_data.grad_phi_p[q][i];
-          const auto &laplacian_phi_u_i = scratch_data.laplacian_phi_u[q][i];
+      const auto &phi_u_i           = scratch_data.phi_u[q][i];
+      const auto &grad_phi_u_i      = scratch_data.grad_phi_u[q][i];
+      const auto &div_phi_u_i       = scratch_data.div_phi_u[q][i];
+      const auto &phi_p_i           = scratch_data.phi_p[q][i];
+      const auto &grad_phi_p_i      = scratch_data.grad_phi_p[q][i];
+      const auto &laplacian_phi_u_i = scratch_data.laplacian_phi_u[q][i];
 
 
 
-          // Store these temporary products in auxiliary variables for speed
-          const auto grad_phi_u_i_x_velocity = grad_phi_u_i * velocity;
-          const auto strong_residual_x_grad_phi_u_i =
-            strong_residual * grad_phi_u_i;
+      // Store these temporary products in auxiliary variables for speed
+      const auto grad_phi_u_i_x_velocity = grad_phi_u_i * velocity;
+      const auto strong_residual_x_grad_phi_u_i =
+        strong_residual * grad_phi_u_i;
 
-          for (unsigned int j = 0; j < n_dofs; ++j)
-            {
-              const unsigned int component_j = scratch_data.components[j];
+      for (unsigned int j = 0; j < n_dofs; ++j)
+        {
+          const unsigned int component_j = scratch_data.components[j];
 
-              const auto &phi_u_j = scratch_data.phi_u[q][j];
+          const auto &phi_u_j = scratch_data.phi_u[q][j];
 
-              const auto &phi_p_j =
-                pressure_scaling_factor * scratch_data.phi_p[q][j];
+          const auto &phi_p_j =
+            pressure_scaling_factor * scratch_data.phi_p[q][j];
 
-              const auto &strong_jac = strong_jacobian_vec[q][j];
+          const auto &strong_jac = strong_jacobian_vec[q][j];
 
-              double local_matrix_ij =
-                component_j == dim ? -div_phi_u_i * phi_p_j : 0;
-              if (component_i == dim)
-                {
-                  const auto &div_phi_u_j = scratch_data.div_phi_u[q][j];
-                  local_matrix_ij += phi_p_i * div_phi_u_j; // continuity
+          double local_matrix_ij =
+            component_j == dim ? -div_phi_u_i * phi_p_j : 0;
+          if (component_i == dim)
+            {
+              const auto &div_phi_u_j = scratch_data.div_phi_u[q][j];
+              local_matrix_ij += phi_p_i * div_phi_u_j; // continuity
 
-                  // PSPG GLS term
-                  local_matrix_ij += tau * (strong_jac * grad_phi_p_i);
-                }
+              // PSPG GLS term
+              local_matrix_ij += tau * (strong_jac * grad_phi_p_i);
+            }
 
-              if (component_i < dim && component_j < dim)
-                {
-                  const auto &grad_phi_u_j = scratch_data.grad_phi_u[q][j];
+          if (component_i < dim && component_j < dim)
+            {
+              const auto &grad_phi_u_j = scratch_data.grad_phi_u[q][j];
 
-                  local_matrix_ij += velocity_gradient_x_phi_u_j[j] * phi_u_i +
-                                     grad_phi_u_j_x_velocity[j] * phi_u_i;
+              local_matrix_ij += velocity_gradient_x_phi_u_j[j] * phi_u_i +
+                                 grad_phi_u_j_x_velocity[j] * phi_u_i;
 
-                  // LSIC GLS term
-                  const auto &div_phi_u_j = scratch_data.div_phi_u[q][j];
-                  local_matrix_ij += tau_lsic * (div_phi_u_i * div_phi_u_j);
+              // LSIC GLS term
+              const auto &div_phi_u_j = scratch_data.div_phi_u[q][j];
+              local_matrix_ij += tau_lsic * (div_phi_u_i * div_phi_u_j);
 
-                  if (component_i == component_j)
-                    {
-                      local_matrix_ij +=
-                        kinematic_viscosity * (grad_phi_u_j[component_j] *
-                                               grad_phi_u_i[component_i]) +
-                        mass_source * phi_u_j * phi_u_i;
-                    }
-                }
-              if (component_i < dim)
+              if (component_i == component_j)
                 {
-                  // The jacobian matrix for the SUPG formulation
-                  // currently does not include the jacobian of the
-                  // stabilization parameter tau. Our experience has shown that
-                  // does not alter the number of newton iteration for
-                  // convergence, but greatly simplifies assembly.
                   local_matrix_ij +=
-                    tau *
-                    (strong_jac * (grad_phi_u_i_x_velocity -
-                                   kinematic_viscosity * laplacian_phi_u_i) +
-                     strong_residual_x_grad_phi_u_i * phi_u_j);
+                    kinematic_viscosity * (grad_phi_u_j[component_j] *
+                                           grad_phi_u_i[component_i]) +
+                    mass_source * phi_u_j * phi_u_i;
                 }
-
-              local_matrix_ij *= JxW;
-              local_matrix(i, j) += local_matrix_ij;
             }
+          if (component_i < dim)
+            {
+              // The jacobian matrix for the SUPG formulation
+              // currently does not include the jacobian of the
+              // stabilization parameter tau. Our experience has shown that
+              // does not alter the number of newton iteration for
+              // convergence, but greatly simplifies assembly.
+              local_matrix_ij +=
+                tau *
+                (strong_jac * (grad_phi_u_i_x_velocity -
+                               kinematic_viscosity * laplacian_phi_u_i) +
+                 strong_residual_x_grad_phi_u_i * phi_u_j);
+            }
+
+          local_matrix_ij *= JxW;
+          local_matrix(i, j) += local_matrix_ij;
         }
     }
 }
@@ -488,6 +499,20 @@ void
 GLSNavierStokesAssemblerCore<dim>::assemble_rhs(
   NavierStokesScratchData<dim>         &scratch_data,
   StabilizedMethodsTensorCopyData<dim> &copy_data)
+{
+  const NavierStokesTimeSteppingData time_data(*this->simulation_control);
+
+  for (unsigned int q = 0; q < scratch_data.n_q_points; ++q)
+    assemble_rhs_at_quadrature_point(q, time_data, scratch_data, copy_data);
+}
+
+template <int dim>
+void
+GLSNavierStokesAssemblerCore<dim>::assemble_rhs_at_quadrature_point(
+  const unsigned int                    q,
+  const NavierStokesTimeSteppingData   &time_data,
+  NavierStokesScratchData<dim>         &scratch_data,
+  StabilizedMethodsTensorCopyData<dim> &copy_data) const
 {
   // Scheme and physical properties
   const std::vector<double> &viscosity_vector =
@@ -497,112 +522,102 @@ GLSNavierStokesAssemblerCore<dim>::assemble_rhs(
     scratch_data.kinematic_viscosity_for_stabilization;
 
   // Loop and quadrature information
-  const auto        &JxW_vec    = scratch_data.JxW;
-  const unsigned int n_q_points = scratch_data.n_q_points;
-  const unsigned int n_dofs     = scratch_data.n_dofs;
-  const double       h          = scratch_data.cell_size;
+  const auto        &JxW_vec = scratch_data.JxW;
+  const unsigned int n_dofs  = scratch_data.n_dofs;
+  const double       h       = scratch_data.cell_size;
 
   // Copy data elements
   auto &strong_residual_vec = copy_data.strong_residual;
   auto &local_rhs           = copy_data.local_rhs;
 
-  // Time steps and inverse time steps which is used for stabilization constant
-  std::vector<double> time_steps_vector =
-    this->simulation_control->get_time_steps_vector();
-  const double dt  = time_steps_vector[0];
-  const double sdt = 1. / dt;
-
-  // Loop over the quadrature points
-  for (unsigned int q = 0; q < n_q_points; ++q)
+  // Inverse time step which is used for stabilization constant
+  const double sdt = time_data.sdt;
+
+  // Physical properties
+  const double kinematic_viscosity = viscosity_vector[q];
+
+  // Velocity
+  const Tensor<1, dim> &velocity   = scratch_data.velocity_values[q];
+  const double velocity_divergence = scratch_data.velocity_divergences[q];
+  const Tensor<2, dim> &velocity_gradient = scratch_data.velocity_gradients[q];
+  const Tensor<1, dim> &velocity_laplacian =
+    scratch_data.velocity_laplacians[q];
+
+  // Pressure
+  const double          pressure = scratch_data.pressure_values[q];
+  const Tensor<1, dim> &pressure_gradient = scratch_data.pressure_gradients[q];
+
+  // Forcing term
+  const Tensor<1, dim> &force       = scratch_data.force[q];
+  double                mass_source = scratch_data.mass_source[q];
+  // Calculation of the magnitude of the
+  // velocity for the stabilization parameter
+  const double u_mag = std::max(velocity.norm(), 1e-12);
+
+  // Store JxW in local variable for faster access;
+  const double JxW = JxW_vec[q];
+
+  // Calculation of the GLS stabilization parameter. The
+  // stabilization parameter used is different if the simulation
+  // is steady or unsteady. In the unsteady case it includes the
+  // value of the time-step
+  const double tau =
+    this->simulation_control->get_assembly_method() ==
+        Parameters::SimulationControl::TimeSteppingMethod::steady ?
+      calculate_navier_stokes_gls_tau_steady(
+        u_mag, viscosity_for_stabilization_vector[q], h) :
+      calculate_navier_stokes_gls_tau_transient(
+        u_mag, viscosity_for_stabilization_vector[q], h, sdt);
+
+
+  // LSIC stabilization term
+  const double tau_lsic = u_mag * h / 2;
+
+
+  // Calculate the strong residual for GLS stabilization
+  auto strong_residual = velocity_gradient * velocity + pressure_gradient -
+                         kinematic_viscosity * velocity_laplacian - force +
+                         mass_source * velocity + strong_residual_vec[q];
+
+  // Assembly of the right-hand side
+  for (unsigned int i = 0; i < n_dofs; ++i)
     {
-      // Physical properties
-      const double kinematic_viscosity = viscosity_vector[q];
-
-      // Velocity
-      const Tensor<1, dim> &velocity   = scratch_data.velocity_values[q];
-      const double velocity_divergence = scratch_data.velocity_divergences[q];
-      const Tensor<2, dim> &velocity_gradient =
-        scratch_data.velocity_gradients[q];
-      const Tensor<1, dim> &velocity_laplacian =
-        scratch_data.velocity_laplacians[q];
-
-      // Pressure
-      const double          pressure = scratch_data.pressure_values[q];
-      const Tensor<1, dim> &pressure_gradient =
-        scratch_data.pressure_gradients[q];
-
-      // Forcing term
-      const Tensor<1, dim> &force       = scratch_data.force[q];
-      double                mass_source = scratch_data.mass_source[q];
-      // Calculation of the magnitude of the
-      // velocity for the stabilization parameter
-      const double u_mag = std::max(velocity.norm(), 1e-12);
-
-      // Store JxW in local variable for faster access;
-      const double JxW = JxW_vec[q];
-
-      // Calculation of the GLS stabilization parameter. The
-      // stabilization parameter used is different if the simulation
-      // is steady or unsteady. In the unsteady case it includes the
-      // value of the time-step
-      const double tau =
-        this->simulation_control->get_assembly_method() ==
-            Parameters::SimulationControl::TimeSteppingMethod::steady ?
-          calculate_navier_stokes_gls_tau_steady(
-            u_mag, viscosity_for_stabilization_vector[q], h) :
-          calculate_navier_stokes_gls_tau_transient(
-            u_mag, viscosity_for_stabilization_vector[q], h, sdt);
-
-
-      // LSIC stabilization term
-      const double tau_lsic = u_mag * h / 2;
-
-
-      // Calculate the strong residual for GLS stabilization
-      auto strong_residual = velocity_gradient * velocity + pressure_gradient -
-                             kinematic_viscosity * velocity_laplacian - force +
-                             mass_source * velocity + strong_residual_vec[q];
-
-      // Assembly of the right-hand side
-      for (unsigned int i = 0; i < n_dofs; ++i)
-        {
-          const auto &phi_u_i           = scratch_data.phi_u[q][i];
-          const auto &grad_phi_u_i      = scratch_data.grad_phi_u[q][i];
-          const auto &phi_p_i           = scratch_data.phi_p[q][i];
-          const auto &grad_phi_p_i      = scratch_data.grad_phi_p[q][i];
-          const auto &div_phi_u_i       = scratch_data.div_phi_u[q][i];
-          const auto &laplacian_phi_u_i = scratch_data.laplacian_phi_u[q][i];
-
-
-          double local_rhs_i = 0;
-
-          // Navier-Stokes Residual
-          local_rhs_i +=
-            (
-              // Momentum
-              -kinematic_viscosity *
-                scalar_product(velocity_gradient, grad_phi_u_i) -
-              velocity_gradient * velocity * phi_u_i + pressure * div_phi_u_i +
-              force * phi_u_i - mass_source * velocity * phi_u_i -
-              // Continuity
-              velocity_divergence * phi_p_i + mass_source * phi_p_i) *
-            JxW;
-
-          // PSPG GLS term
-          local_rhs_i += -tau * (strong_residual * grad_phi_p_i) * JxW;
-
-          // LSIC GLS term
-          local_rhs_i += -tau_lsic * (div_phi_u_i * velocity_divergence) * JxW;
-
-          // SUPG GLS term
-          local_rhs_i +=
-            -tau *
-            (strong_residual * (grad_phi_u_i * velocity -
-                                kinematic_viscosity * laplacian_phi_u_i)) *
-            JxW;
-
-          local_rhs(i) += local_rhs_i;
-        }
+      const auto &phi_u_i           = scratch_data.phi_u[q][i];
+      const auto &grad_phi_u_i      = scratch_data.grad_phi_u[q][i];
+      const auto &phi_p_i           = scratch_data.phi_p[q][i];
+      const auto &grad_phi_p_i      = scratch_data.grad_phi_p[q][i];
+      const auto &div_phi_u_i       = scratch_data.div_phi_u[q][i];
+      const auto &laplacian_phi_u_i = scratch_data.laplacian_phi_u[q][i];
+
+
+      double local_rhs_i = 0;
+
+      // Navier-Stokes Residual
+      local_rhs_i +=
+        (
+          // Momentum
+          -kinematic_viscosity *
+            scalar_product(velocity_gradient, grad_phi_u_i) -
+          velocity_gradient * velocity * phi_u_i + pressure * div_phi_u_i +
+          force * phi_u_i - mass_source * velocity * phi_u_i -
+          // Continuity
+          velocity_divergence * phi_p_i + mass_source * phi_p_i) *
+        JxW;
+
+      // PSPG GLS term
+      local_rhs_i += -tau * (strong_residual * grad_phi_p_i) * JxW;
+
+      // LSIC GLS term
+      local_rhs_i += -tau_lsic * (div_phi_u_i * velocity_divergence) * JxW;
+
+      // SUPG GLS term
+      local_rhs_i +=
+        -tau *
+        (strong_residual * (grad_phi_u_i * velocity -
+                            kinematic_viscosity * laplacian_phi_u_i)) *
+        JxW;
+
+      local_rhs(i) += local_rhs_i;
     }
 }
 
@@ -1118,54 +1133,52 @@ void
 GLSNavierStokesAssemblerBDF<dim>::assemble_matrix(
   NavierStokesScratchData<dim>         &scratch_data,
   StabilizedMethodsTensorCopyData<dim> &copy_data)
+{
+  const NavierStokesTimeSteppingData time_data(*this->simulation_control);
+
+  for (unsigned int q = 0; q < scratch_data.n_q_points; ++q)
+    assemble_matrix_at_quadrature_point(q, time_data, scratch_data, copy_data);
+}
+
+template <int dim>
+void
+GLSNavierStokesAssemblerBDF<dim>::assemble_matrix_at_quadrature_point(
+  const unsigned int                    q,
+  const NavierStokesTimeSteppingData   &time_data,
+  NavierStokesScratchData<dim>         &scratch_data,
+  StabilizedMethodsTensorCopyData<dim> &copy_data) const
 {
   // Loop and quadrature information
-  const auto        &JxW        = scratch_data.JxW;
-  const unsigned int n_q_points = scratch_data.n_q_points;
-  const unsigned int n_dofs     = scratch_data.n_dofs;
+  const double       JxW    = scratch_data.JxW[q];
+  const unsigned int n_dofs = scratch_data.n_dofs;
 
   // Copy data elements
   auto &strong_residual = copy_data.strong_residual;
   auto &strong_jacobian = copy_data.strong_jacobian;
   auto &local_matrix    = copy_data.local_matrix;
 
-  // Time stepping information
-  const auto method = this->simulation_control->get_assembly_method();
   // Vector for the BDF coefficients
-  const Vector<double> &bdf_coefs =
-    this->simulation_control->get_bdf_coefficients();
+  const Vector<double> &bdf_coefs = *time_data.bdf_coefs;
 
-  std::vector<Tensor<1, dim>> velocity(1 +
-                                       number_of_previous_solutions(method));
+  strong_residual[q] += bdf_coefs[0] * scratch_data.velocity_values[q];
+  for (unsigned int p = 0; p < time_data.n_previous_solutions; ++p)
+    strong_residual[q] +=
+      bdf_coefs[p + 1] * scratch_data.previous_velocity_values[p][q];
 
-  // Loop over the quadrature points
-  for (unsigned int q = 0; q < n_q_points; ++q)
+  for (unsigned int j = 0; j < n_dofs; ++j)
     {
-      velocity[0] = scratch_data.velocity_values[q];
-      for (unsigned int p = 0; p < number_of_previous_solutions(method); ++p)
-        velocity[p + 1] = scratch_data.previous_velocity_values[p][q];
+      strong_jacobian[q][j] += bdf_coefs[0] * scratch_data.phi_u[q][j];
+    }
 
-      for (unsigned int p = 0; p < number_of_previous_solutions(method) + 1;
-           ++p)
-        {
-          strong_residual[q] += bdf_coefs[p] * velocity[p];
-        }
 
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    {
+      const Tensor<1, dim> &phi_u_i = scratch_data.phi_u[q][i];
       for (unsigned int j = 0; j < n_dofs; ++j)
         {
-          strong_jacobian[q][j] += bdf_coefs[0] * scratch_data.phi_u[q][j];
-        }
-
+          const Tensor<1, dim> &phi_u_j = scratch_data.phi_u[q][j];
 
-      for (unsigned int i = 0; i < n_dofs; ++i)
-        {
-          const Tensor<1, dim> &phi_u_i = scratch_data.phi_u[q][i];
-          for (unsigned int j = 0; j < n_dofs; ++j)
-            {
-              const Tensor<1, dim> &phi_u_j = scratch_data.phi_u[q][j];
-
-              local_matrix(i, j) += phi_u_j * phi_u_i * bdf_coefs[0] * JxW[q];
-            }
+          local_matrix(i, j) += phi_u_j * phi_u_i * bdf_coefs[0] * JxW;
         }
     }
 }
@@ -1175,56 +1188,114 @@ void
 GLSNavierStokesAssemblerBDF<dim>::assemble_rhs(
   NavierStokesScratchData<dim>         &scratch_data,
   StabilizedMethodsTensorCopyData<dim> &copy_data)
+{
+  const NavierStokesTimeSteppingData time_data(*this->simulation_control);
+
+  for (unsigned int q = 0; q < scratch_data.n_q_points; ++q)
+    assemble_rhs_at_quadrature_point(q, time_data, scratch_data, copy_data);
+}
+
+template <int dim>
+void
+GLSNavierStokesAssemblerBDF<dim>::assemble_rhs_at_quadrature_point(
+  const unsigned int                    q,
+  const NavierStokesTimeSteppingData   &time_data,
+  NavierStokesScratchData<dim>         &scratch_data,
+  StabilizedMethodsTensorCopyData<dim> &copy_data) const
 {
   // Loop and quadrature information
-  const auto        &JxW        = scratch_data.JxW;
-  const unsigned int n_q_points = scratch_data.n_q_points;
-  const unsigned int n_dofs     = scratch_data.n_dofs;
+  const double       JxW    = scratch_data.JxW[q];
+  const unsigned int n_dofs = scratch_data.n_dofs;
 
   // Copy data elements
   auto &strong_residual = copy_data.strong_residual;
   auto &local_rhs       = copy_data.local_rhs;
 
-  // Time stepping information
-  const auto method = this->simulation_control->get_assembly_method();
   // Vector for the BDF coefficients
-  const Vector<double> &bdf_coefs =
-    this->simulation_control->get_bdf_coefficients();
+  const Vector<double> &bdf_coefs = *time_data.bdf_coefs;
 
-  std::vector<Tensor<1, dim>> velocity(1 +
-                                       number_of_previous_solutions(method));
+  const Tensor<1, dim> &velocity = scratch_data.velocity_values[q];
 
-  // Loop over the quadrature points
-  for (unsigned int q = 0; q < n_q_points; ++q)
-    {
-      velocity[0] = scratch_data.velocity_values[q];
-      for (unsigned int p = 0; p < number_of_previous_solutions(method); ++p)
-        velocity[p + 1] = scratch_data.previous_velocity_values[p][q];
+  strong_residual[q] += (bdf_coefs[0] * velocity);
+  for (unsigned int p = 0; p < time_data.n_previous_solutions; ++p)
+    strong_residual[q] +=
+      (bdf_coefs[p + 1] * scratch_data.previous_velocity_values[p][q]);
 
-      for (unsigned int p = 0; p < number_of_previous_solutions(method) + 1;
-           ++p)
-        {
-          strong_residual[q] += (bdf_coefs[p] * velocity[p]);
-        }
 
+  for (unsigned int i = 0; i < n_dofs; ++i)
+    {
+      const auto phi_u_i     = scratch_data.phi_u[q][i];
+      double     local_rhs_i = 0;
 
-      for (unsigned int i = 0; i < n_dofs; ++i)
-        {
-          const auto phi_u_i     = scratch_data.phi_u[q][i];
-          double     local_rhs_i = 0;
-          for (unsigned int p = 0; p < number_of_previous_solutions(method) + 1;
-               ++p)
-            {
-              local_rhs_i -= bdf_coefs[p] * (velocity[p] * phi_u_i);
-            }
-          local_rhs(i) += local_rhs_i * JxW[q];
-        }
+      local_rhs_i -= bdf_coefs[0] * (velocity * phi_u_i);
+      for (unsigned int p = 0; p < time_data.n_previous_solutions; ++p)
+        local_rhs_i -= bdf_coefs[p + 1] *
+                       (scratch_data.previous_velocity_values[p][q] * phi_u_i);
+
+      local_rhs(i) += local_rhs_i * JxW;
     }
 }
 
 template class GLSNavierStokesAssemblerBDF<2>;
 template class GLSNavierStokesAssemblerBDF<3>;
 
+template <int dim, typename... AssemblerTypes>
+void
+NavierStokesAssemblerPipeline<dim, AssemblerTypes...>::assemble_matrix(
+  NavierStokesScratchData<dim>         &scratch_data,
+  StabilizedMethodsTensorCopyData<dim> &copy_data)
+{
+  const NavierStokesTimeSteppingData time_data(*this->simulation_control);
+
+  for (unsigned int q = 0; q < scratch_data.n_q_points; ++q)
+    std::apply(
+      [&](const AssemblerTypes &...assembler) {
+        (assembler.assemble_matrix_at_quadrature_point(q,
+                                                       time_data,
+                                                       scratch_data,
+                                                       copy_data),
+         ...);
+      },
+      assemblers);
+}
+
+template <int dim, typename... AssemblerTypes>
+void
+NavierStokesAssemblerPipeline<dim, AssemblerTypes...>::assemble_rhs(
+  NavierStokesScratchData<dim>         &scratch_data,
+  StabilizedMethodsTensorCopyData<dim> &copy_data)
+{
+  const NavierStokesTimeSteppingData time_data(*this->simulation_control);
+
+  for (unsigned int q = 0; q < scratch_data.n_q_points; ++q)
+    std::apply(
+      [&](const AssemblerTypes &...assembler) {
+        (assembler.assemble_rhs_at_quadrature_point(q,
+                                                    time_data,
+                                                    scratch_data,
+                                                    copy_data),
+         ...);
+      },
+      assemblers);
+}
+
+template class NavierStokesAssemblerPipeline<
+  2,
+  GLSNavierStokesAssemblerBDF<2>,
+  PSPGSUPGNavierStokesAssemblerCore<2>>;
+template class NavierStokesAssemblerPipeline<
+  3,
+  GLSNavierStokesAssemblerBDF<3>,
+  PSPGSUPGNavierStokesAssemblerCore<3>>;
+template class NavierStokesAssemblerPipeline<
+  2,
+  GLSNavierStokesAssemblerBDF<2>,
+  GLSNavierStokesAssemblerCore<2>>;
+template class NavierStokesAssemblerPipeline<
+  3,
+  GLSNavierStokesAssemblerBDF<3>,
+  GLSNavierStokesAssemblerCore<3>>;
+
 template <int dim>
 void
 BlockNavierStokesAssemblerNonNewtonianCore<dim>::assemble_matrix(
@@ -29,6 +29,8 @@
 #include <solvers/postprocessors.h>
 #include <solvers/postprocessors_smoothing.h>
 
+#include <deal.II/base/multithread_info.h>
+
 #include <deal.II/distributed/fully_distributed_tria.h>
 #include <deal.II/distributed/grid_refinement.h>
 
@@ -121,6 +123,12 @@ NavierStokesBase<dim, VectorType, DofsType>::NavierStokesBase(
   this->pcout.set_condition(
     Utilities::MPI::this_mpi_process(this->mpi_communicator) == 0);
 
+  // The applications limit the number of threads of each process to one when
+  // MPI is initialized. The assembly may use more threads.
+  if (p_nsparam.fem_parameters.number_of_assembly_threads > 1)
+    MultithreadInfo::set_thread_limit(
+      p_nsparam.fem_parameters.number_of_assembly_threads);
+
   // Check if the output directory exists
   std::string output_dir_name =
     simulation_parameters.simulation_control.output_folder;
@@ -567,23 +575,45 @@ NavierStokesBase<dim, VectorType, DofsType>::iterate()
                           simulation_parameters.simulation_control.method);
       multiphysics->percolate_time_vectors(false);
 
-      if (simulation_parameters.non_linear_solver.at(PhysicsID::fluid_dynamics)
-              .verbosity != Parameters::Verbosity::quiet ||
-          simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
-              .verbosity != Parameters::Verbosity::quiet)
-        announce_string(this->pcout, "Fluid Dynamics");
-      PhysicsSolver<VectorType>::solve_non_linear_system(false);
-
-      // If the physics need to be solved after the physics, the matrix free
-      // solver requires to update the value here. This is due to the different
-      // type of vectors.
-      if (this->multiphysics->get_active_physics().size() > 1)
-        this->update_solutions_for_multiphysics();
+      // The fluid dynamics and the auxiliary physics solved after it are
+      // solved in turn until their coupling converges. The coupling
+      // iterations are accelerated with the Anderson method. By default, a
+      // single coupling iteration is done.
+      const unsigned int max_coupling_iterations =
+        multiphysics->get_max_coupling_iterations();
+      if (max_coupling_iterations > 1)
+        multiphysics->initialize_coupling_iterations();
+
+      for (unsigned int coupling_iteration = 0;
+           coupling_iteration < max_coupling_iterations;
+           ++coupling_iteration)
+        {
+          if (simulation_parameters.non_linear_solver
+                  .at(PhysicsID::fluid_dynamics)
+                  .verbosity != Parameters::Verbosity::quiet ||
+              simulation_parameters.linear_solver.at(PhysicsID::fluid_dynamics)
+                  .verbosity != Parameters::Verbosity::quiet)
+            announce_string(this->pcout, "Fluid Dynamics");
+          PhysicsSolver<VectorType>::solve_non_linear_system(false);
+
+          // If the physics need to be solved after the physics, the matrix
+          // free solver requires to update the value here. This is due to the
+          // different type of vectors.
+          if (this->multiphysics->get_active_physics().size() > 1)
+            this->update_solutions_for_multiphysics();
+
+          // Solve the auxiliary physics that should be treated AFTER the fluid
+          // dynamics
+          multiphysics->solve(true,
+                              simulation_parameters.simulation_control.method);
+
+          if (max_coupling_iterations > 1 &&
+              multiphysics->update_coupling_iterations(coupling_iteration))
+            break;
+        }
 
-      // Solve and percolate the auxiliary physics that should be treated AFTER
-      // the fluid dynamics
-      multiphysics->solve(true,
-                          simulation_parameters.simulation_control.method);
+      // Percolate the auxiliary physics that should be treated AFTER the
+      // fluid dynamics.
       // Dear future Bruno, percolating auxiliary physics before fluid dynamics
       // is necessary because of the checkpointing mechanism. You spent an
       // evening debugging this, trust me.
@@ -13,7 +13,7 @@ NavierStokesScratchData<dim>::allocate()
   this->n_dofs     = fe_values.get_fe().n_dofs_per_cell();
 
   // Initialize arrays related to quadrature
-  this->JxW = std::vector<double>(n_q_points);
+  this->cell_shape_data.JxW = std::vector<double>(n_q_points);
 
   // Initialize component array
   this->components = std::vector<unsigned int>(n_dofs);
@@ -52,29 +52,30 @@ NavierStokesScratchData<dim>::allocate()
                                      std::vector<double>(n_q_points));
   // Initialize arrays related to shape functions
   // Velocity shape functions
-  this->phi_u = std::vector<std::vector<Tensor<1, dim>>>(
+  this->cell_shape_data.phi_u = std::vector<std::vector<Tensor<1, dim>>>(
     n_q_points, std::vector<Tensor<1, dim>>(n_dofs));
-  this->grad_phi_u = std::vector<std::vector<Tensor<2, dim>>>(
+  this->cell_shape_data.grad_phi_u = std::vector<std::vector<Tensor<2, dim>>>(
     n_q_points, std::vector<Tensor<2, dim>>(n_dofs));
-  this->div_phi_u =
+  this->cell_shape_data.div_phi_u =
     std::vector<std::vector<double>>(n_q_points, std::vector<double>(n_dofs));
-  this->hess_phi_u = std::vector<std::vector<Tensor<3, dim>>>(
+  this->cell_shape_data.hess_phi_u = std::vector<std::vector<Tensor<3, dim>>>(
     n_q_points, std::vector<Tensor<3, dim>>(n_dofs));
-  this->laplacian_phi_u = std::vector<std::vector<Tensor<1, dim>>>(
-    n_q_points, std::vector<Tensor<1, dim>>(n_dofs));
+  this->cell_shape_data.laplacian_phi_u =
+    std::vector<std::vector<Tensor<1, dim>>>(
+      n_q_points, std::vector<Tensor<1, dim>>(n_dofs));
 
   // Pressure shape functions
-  this->phi_p =
+  this->cell_shape_data.phi_p =
     std::vector<std::vector<double>>(n_q_points, std::vector<double>(n_dofs));
-  this->grad_phi_p = std::vector<std::vector<Tensor<1, dim>>>(
+  this->cell_shape_data.grad_phi_p = std::vector<std::vector<Tensor<1, dim>>>(
     n_q_points, std::vector<Tensor<1, dim>>(n_dofs));
 
-  // Physical properties
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::pressure, n_q_points));
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::shear_rate, n_q_points));
+  set_shape_function_views(this->cell_shape_data);
 
+  // DoF values of the cells read from the shape data cache
+  this->cell_dof_values.reinit(n_dofs);
+
+  // Physical properties
   density                               = std::vector<double>(n_q_points);
   dynamic_viscosity                     = std::vector<double>(n_q_points);
   kinematic_viscosity                   = std::vector<double>(n_q_points);
@@ -196,12 +197,6 @@ NavierStokesScratchData<dim>::enable_cahn_hilliard(
   filtered_phase_order_cahn_hilliard_values =
     std::vector<double>(this->n_q_points);
 
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::phase_order_cahn_hilliard,
-                                          n_q_points));
-  fields.insert(std::pair<field, std::vector<double>>(
-    field::phase_order_cahn_hilliard_filtered, n_q_points));
-
   // Allocate physical properties
   density_0                             = std::vector<double>(n_q_points);
   density_1                             = std::vector<double>(n_q_points);
@@ -244,13 +239,6 @@ NavierStokesScratchData<dim>::enable_cahn_hilliard(
   filtered_phase_order_cahn_hilliard_values =
     std::vector<double>(this->n_q_points);
 
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::phase_order_cahn_hilliard,
-                                          n_q_points));
-
-  fields.insert(std::pair<field, std::vector<double>>(
-    field::phase_order_cahn_hilliard_filtered, n_q_points));
-
   // Allocate physical properties
   density_0                             = std::vector<double>(n_q_points);
   density_1                             = std::vector<double>(n_q_points);
@@ -365,8 +353,6 @@ NavierStokesScratchData<dim>::enable_heat_transfer(
   previous_temperature_gradients = std::vector<std::vector<Tensor<1, dim>>>(
     maximum_number_of_previous_solutions(),
     std::vector<Tensor<1, dim>>(this->n_q_points));
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::temperature, n_q_points));
 }
 
 
@@ -377,14 +363,12 @@ NavierStokesScratchData<dim>::calculate_physical_properties()
   if (properties_manager.field_is_required(field::temperature) &&
       gather_temperature)
     {
-      set_field_vector(field::temperature,
-                       this->temperature_values,
-                       this->fields);
+      fields.set(field::temperature, this->temperature_values);
     }
 
   if (properties_manager.field_is_required(field::pressure))
     {
-      set_field_vector(field::pressure, this->pressure_values, this->fields);
+      fields.set(field::pressure, this->pressure_values);
     }
 
   if (properties_manager.field_is_required(field::shear_rate))
@@ -399,7 +383,7 @@ NavierStokesScratchData<dim>::calculate_physical_properties()
           shear_rate[q] = calculate_shear_rate_magnitude(shear_rate_tensor);
         }
 
-      set_field_vector(field::shear_rate, shear_rate, this->fields);
+      fields.set(field::shear_rate, shear_rate);
     }
 
   switch (properties_manager.get_number_of_fluids())
@@ -0,0 +1,158 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------*/
+
+#include <solvers/navier_stokes_shape_data_cache.h>
+
+#include <deal.II/fe/fe_values.h>
+
+namespace
+{
+  /**
+   * @brief Evaluate the shape functions of the velocity and the pressure at
+   * the quadrature points of a cell, in the same way as
+   * NavierStokesScratchData::reinit.
+   *
+   * @param[in] fe_values FEValues reinitialized on the cell.
+   * @param[out] data Shape data of the cell.
+   */
+  template <int dim>
+  void
+  evaluate_shape_data(
+    const FEValues<dim>                                 &fe_values,
+    typename NavierStokesShapeDataCache<dim>::ShapeData &data)
+  {
+    const FEValuesExtractors::Vector velocities(0);
+    const FEValuesExtractors::Scalar pressure(dim);
+
+    const unsigned int n_q_points = fe_values.n_quadrature_points;
+    const unsigned int n_dofs     = fe_values.dofs_per_cell;
+
+    data.JxW       = std::vector<double>(n_q_points);
+    data.div_phi_u = std::vector<std::vector<double>>(
+      n_q_points, std::vector<double>(n_dofs));
+    data.phi_u = std::vector<std::vector<Tensor<1, dim>>>(
+      n_q_points, std::vector<Tensor<1, dim>>(n_dofs));
+    data.hess_phi_u = std::vector<std::vector<Tensor<3, dim>>>(
+      n_q_points, std::vector<Tensor<3, dim>>(n_dofs));
+    data.laplacian_phi_u = std::vector<std::vector<Tensor<1, dim>>>(
+      n_q_points, std::vector<Tensor<1, dim>>(n_dofs));
+    data.grad_phi_u = std::vector<std::vector<Tensor<2, dim>>>(
+      n_q_points, std::vector<Tensor<2, dim>>(n_dofs));
+    data.phi_p = std::vector<std::vector<double>>(
+      n_q_points, std::vector<double>(n_dofs));
+    data.grad_phi_p = std::vector<std::vector<Tensor<1, dim>>>(
+      n_q_points, std::vector<Tensor<1, dim>>(n_dofs));
+
+    for (unsigned int q = 0; q < n_q_points; ++q)
+      {
+        data.JxW[q] = fe_values.JxW(q);
+        for (unsigned int k = 0; k < n_dofs; ++k)
+          {
+            // Velocity
+            data.phi_u[q][k]      = fe_values[velocities].value(k, q);
+            data.div_phi_u[q][k]  = fe_values[velocities].divergence(k, q);
+            data.grad_phi_u[q][k] = fe_values[velocities].gradient(k, q);
+            data.hess_phi_u[q][k] = fe_values[velocities].hessian(k, q);
+            for (int d = 0; d < dim; ++d)
+              data.laplacian_phi_u[q][k][d] = trace(data.hess_phi_u[q][k][d]);
+            // Pressure
+            data.phi_p[q][k]      = fe_values[pressure].value(k, q);
+            data.grad_phi_p[q][k] = fe_values[pressure].gradient(k, q);
+          }
+      }
+  }
+} // namespace
+
+template <int dim>
+NavierStokesShapeDataCache<dim>::NavierStokesShapeDataCache(
+  const unsigned int max_n_shapes)
+  : max_n_shapes(max_n_shapes)
+  , n_cells_in_cache(0)
+{}
+
+template <int dim>
+void
+NavierStokesShapeDataCache<dim>::initialize(
+  const DoFHandler<dim> &dof_handler,
+  const Mapping<dim>    &mapping,
+  const Quadrature<dim> &quadrature)
+{
+  shape_data.clear();
+  shape_jacobians.clear();
+  cell_to_shape.assign(dof_handler.get_triangulation().n_active_cells(),
+                       numbers::invalid_unsigned_int);
+  n_cells_in_cache = 0;
+
+  FEValues<dim> fe_values(mapping,
+                          dof_handler.get_fe(),
+                          quadrature,
+                          update_values | update_JxW_values |
+                            update_gradients | update_hessians |
+                            update_jacobians);
+
+  const unsigned int n_q_points = quadrature.size();
+
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      if (!cell->is_locally_owned())
+        continue;
+
+      fe_values.reinit(cell);
+
+      // The shape functions of a cell only depend on its jacobian if the
+      // jacobian is constant over the cell.
+      const Tensor<2, dim> jacobian  = fe_values.jacobian(0);
+      const double         tolerance = 1e-12 * jacobian.norm();
+
+      bool is_affine = true;
+      for (unsigned int q = 1; q < n_q_points; ++q)
+        if ((Tensor<2, dim>(fe_values.jacobian(q)) - jacobian).norm() >
+            tolerance)
+          {
+            is_affine = false;
+            break;
+          }
+
+      if (!is_affine)
+        continue;
+
+      unsigned int shape = numbers::invalid_unsigned_int;
+      for (unsigned int s = 0; s < shape_jacobians.size(); ++s)
+        if ((shape_jacobians[s] - jacobian).norm() <= tolerance)
+          {
+            shape = s;
+            break;
+          }
+
+      if (shape == numbers::invalid_unsigned_int)
+        {
+          if (shape_data.size() >= max_n_shapes)
+            continue;
+
+          ShapeData data;
+          evaluate_shape_data(fe_values, data);
+
+          shape = shape_data.size();
+          shape_data.emplace_back(std::move(data));
+          shape_jacobians.emplace_back(jacobian);
+        }
+
+      cell_to_shape[cell->active_cell_index()] = shape;
+      ++n_cells_in_cache;
+    }
+}
+
+template class NavierStokesShapeDataCache<2>;
+template class NavierStokesShapeDataCache<3>;
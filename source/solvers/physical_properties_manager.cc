@@ -20,11 +20,12 @@ void
 PhysicalPropertiesManager::establish_fields_required_by_model(
   PhysicalPropertyModel &model)
 {
-  // Loop through the map. The use of or (||) is there to ensure
+  // Loop through the fields. The use of or (||) is there to ensure
   // that if a field is already required, it won't be erased.
-  for (auto &f : required_fields)
+  for (unsigned int f = 0; f < n_fields; ++f)
     {
-      f.second = f.second || model.depends_on(f.first);
+      required_fields[f] =
+        required_fields[f] || model.depends_on(static_cast<field>(f));
     }
 }
 
@@ -32,11 +33,12 @@ void
 PhysicalPropertiesManager::establish_fields_required_by_model(
   InterfacePropertyModel &model)
 {
-  // Loop through the map. The use of or (||) is there to ensure
+  // Loop through the fields. The use of or (||) is there to ensure
   // that if a field is already required, it won't be erased.
-  for (auto &f : required_fields)
+  for (unsigned int f = 0; f < n_fields; ++f)
     {
-      f.second = f.second || model.depends_on(f.first);
+      required_fields[f] =
+        required_fields[f] || model.depends_on(static_cast<field>(f));
     }
 }
 
@@ -65,13 +67,7 @@ PhysicalPropertiesManager::initialize(
   constant_density         = true;
   constant_surface_tension = true;
 
-  required_fields[field::temperature]               = false;
-  required_fields[field::temperature_p1]            = false;
-  required_fields[field::temperature_p2]            = false;
-  required_fields[field::shear_rate]                = false;
-  required_fields[field::pressure]                  = false;
-  required_fields[field::phase_order_cahn_hilliard] = false;
-  required_fields[field::levelset]                  = false;
+  required_fields.fill(false);
 
   // For each fluid, declare the physical properties
   for (unsigned int f = 0; f < number_of_fluids; ++f)
@@ -18,7 +18,9 @@
 
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/read_write_vector.h>
 #include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
 #include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_solver.h>
@@ -48,6 +50,12 @@ Tracer<dim>::assemble_system_matrix()
 {
   TimerOutput::Scope t(this->computing_timer, "Assemble matrix");
 
+  if (this->use_matrix_free)
+    {
+      update_matrix_free();
+      return;
+    }
+
   this->system_matrix = 0;
   setup_assemblers();
 
@@ -65,14 +73,14 @@ Tracer<dim>::assemble_system_matrix()
     *this->mapping,
     dof_handler_fluid->get_fe());
 
-  WorkStream::run(this->dof_handler.begin_active(),
-                  this->dof_handler.end(),
-                  *this,
-                  &Tracer::assemble_local_system_matrix,
-                  &Tracer::copy_local_matrix_to_global_matrix,
-                  scratch_data,
-                  StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
-                                            this->cell_quadrature->size()));
+  run_cell_assembly(this->dof_handler,
+                    assembly_coloring.get(),
+                    *this,
+                    &Tracer::assemble_local_system_matrix,
+                    &Tracer::copy_local_matrix_to_global_matrix,
+                    scratch_data,
+                    StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
+                                              this->cell_quadrature->size()));
 
   system_matrix.compress(VectorOperation::add);
 }
@@ -204,14 +212,14 @@ Tracer<dim>::assemble_system_rhs()
     *this->mapping,
     dof_handler_fluid->get_fe());
 
-  WorkStream::run(this->dof_handler.begin_active(),
-                  this->dof_handler.end(),
-                  *this,
-                  &Tracer::assemble_local_system_rhs,
-                  &Tracer::copy_local_rhs_to_global_rhs,
-                  scratch_data,
-                  StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
-                                            this->cell_quadrature->size()));
+  run_cell_assembly(this->dof_handler,
+                    assembly_coloring.get(),
+                    *this,
+                    &Tracer::assemble_local_system_rhs,
+                    &Tracer::copy_local_rhs_to_global_rhs,
+                    scratch_data,
+                    StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
+                                              this->cell_quadrature->size()));
 
   this->system_rhs.compress(VectorOperation::add);
 }
@@ -598,11 +606,12 @@ Tracer<dim>::postprocess_tracer_flow_rate(const VectorType &current_solution_fd)
   // Initialize fluid properties
   auto &properties_manager =
     this->simulation_parameters.physical_properties_manager;
-  std::map<field, std::vector<double>> fields;
+  FieldVectors fields;
 
   const auto diffusivity_model = properties_manager.get_tracer_diffusivity();
 
   std::vector<double>     tracer_diffusivity(n_q_points_face);
+  std::vector<double>     levelset_values(n_q_points_face);
   std::vector<Point<dim>> face_quadrature_points;
 
   std::vector<double> tracer_flow_rate_vector(
@@ -638,21 +647,14 @@ Tracer<dim>::postprocess_tracer_flow_rate(const VectorType &current_solution_fd)
 
                   // We update the fields required by the diffusivity
                   // model
-                  fields.clear();
                   if (diffusivity_model->depends_on(field::levelset))
                     {
-                      std::vector<double> levelset_values(n_q_points_face);
-                      fields.insert(
-                        std::pair<field, std::vector<double>>(field::levelset,
-                                                              n_q_points_face));
                       face_quadrature_points =
                         fe_face_values_tracer.get_quadrature_points();
                       this->multiphysics
                         ->get_immersed_solid_signed_distance_function()
                         ->value_list(face_quadrature_points, levelset_values);
-                      set_field_vector(field::levelset,
-                                       levelset_values,
-                                       fields);
+                      fields.set(field::levelset, levelset_values);
                     }
 
                   diffusivity_model->vector_value(fields, tracer_diffusivity);
@@ -890,7 +892,11 @@ void
 Tracer<dim>::setup_dofs()
 {
   dof_handler.distribute_dofs(*fe);
-  DoFRenumbering::Cuthill_McKee(this->dof_handler);
+
+  // The levels of the geometric multigrid preconditioner use the default
+  // numbering of the DoFs
+  if (!this->use_matrix_free)
+    DoFRenumbering::Cuthill_McKee(this->dof_handler);
 
   auto mpi_communicator = triangulation->get_communicator();
 
@@ -965,21 +971,34 @@ Tracer<dim>::setup_dofs()
   }
   zero_constraints.close();
 
-  // Sparse matrices initialization
-  DynamicSparsityPattern dsp(locally_relevant_dofs);
-  DoFTools::make_sparsity_pattern(this->dof_handler,
-                                  dsp,
-                                  nonzero_constraints,
-                                  /*keep_constrained_dofs = */ true);
-
-  SparsityTools::distribute_sparsity_pattern(dsp,
-                                             locally_owned_dofs,
-                                             mpi_communicator,
-                                             locally_relevant_dofs);
-  system_matrix.reinit(locally_owned_dofs,
-                       locally_owned_dofs,
-                       dsp,
-                       mpi_communicator);
+  if (this->use_matrix_free)
+    setup_matrix_free();
+  else
+    {
+      // Sparse matrices initialization
+      DynamicSparsityPattern dsp(locally_relevant_dofs);
+      DoFTools::make_sparsity_pattern(this->dof_handler,
+                                      dsp,
+                                      nonzero_constraints,
+                                      /*keep_constrained_dofs = */ true);
+
+      SparsityTools::distribute_sparsity_pattern(dsp,
+                                                 locally_owned_dofs,
+                                                 mpi_communicator,
+                                                 locally_relevant_dofs);
+      system_matrix.reinit(locally_owned_dofs,
+                           locally_owned_dofs,
+                           dsp,
+                           mpi_communicator);
+    }
+
+  // The cells are colored for the new mesh and constraints
+  if (this->simulation_parameters.fem_parameters.enable_colored_assembly)
+    {
+      if (!assembly_coloring)
+        assembly_coloring = std::make_shared<AssemblyColoring<dim>>();
+      assembly_coloring->reinit(this->dof_handler, zero_constraints);
+    }
 
   this->pcout << "   Number of tracer degrees of freedom: "
               << dof_handler.n_dofs() << std::endl;
@@ -1048,6 +1067,12 @@ Tracer<dim>::solve_linear_system(const bool initial_step,
 {
   TimerOutput::Scope t(this->computing_timer, "Solve linear system");
 
+  if (this->use_matrix_free)
+    {
+      solve_linear_system_matrix_free(initial_step);
+      return;
+    }
+
   auto mpi_communicator = triangulation->get_communicator();
 
   const AffineConstraints<double> &constraints_used =
@@ -1116,6 +1141,149 @@ Tracer<dim>::solve_linear_system(const bool initial_step,
   newton_update = completely_distributed_solution;
 }
 
+template <int dim>
+void
+Tracer<dim>::setup_matrix_free()
+{
+  AssertThrow(!this->simulation_parameters.mesh.simplex,
+              ExcMessage("The matrix-free tracer solver does not support "
+                         "simplex meshes."));
+  AssertThrow(!this->simulation_parameters.ale.enabled(),
+              ExcMessage("The matrix-free tracer solver does not support "
+                         "ALE."));
+
+  // The diffusivity of the matrix-free operator is constant, which requires a
+  // single fluid and a diffusivity model that does not depend on any field
+  const auto &properties_manager =
+    this->simulation_parameters.physical_properties_manager;
+  AssertThrow(properties_manager.get_number_of_fluids() == 1 &&
+                !properties_manager.field_is_required(field::levelset),
+              ExcMessage("The matrix-free tracer solver only supports single "
+                         "fluid simulations with a constant diffusivity."));
+
+  const auto diffusivity_model = properties_manager.get_tracer_diffusivity();
+  for (unsigned int f = 0; f < n_fields; ++f)
+    AssertThrow(!diffusivity_model->depends_on(static_cast<field>(f)),
+                ExcMessage("The matrix-free tracer solver only supports a "
+                           "tracer diffusivity that does not depend on any "
+                           "field."));
+
+  const std::map<field, double> field_values;
+  const double diffusivity = diffusivity_model->value(field_values);
+
+  std::set<types::boundary_id> dirichlet_boundary_ids;
+  for (unsigned int i_bc = 0;
+       i_bc < this->simulation_parameters.boundary_conditions_tracer.size;
+       ++i_bc)
+    if (this->simulation_parameters.boundary_conditions_tracer.type[i_bc] ==
+        BoundaryConditions::BoundaryType::tracer_dirichlet)
+      dirichlet_boundary_ids.insert(
+        this->simulation_parameters.boundary_conditions_tracer.id[i_bc]);
+
+  system_operator = std::make_shared<AdvectionDiffusionOperator<dim, double>>();
+  system_operator->reinit(*this->mapping,
+                          this->dof_handler,
+                          this->zero_constraints,
+                          *this->cell_quadrature,
+                          1.0,
+                          diffusivity,
+                          false,
+                          this->simulation_control);
+
+  gmg_preconditioner =
+    std::make_shared<MFAdvectionDiffusionPreconditionGMG<dim>>(
+      this->simulation_parameters.linear_solver.at(PhysicsID::tracer),
+      this->dof_handler,
+      *this->mapping,
+      *this->cell_quadrature,
+      dirichlet_boundary_ids,
+      1.0,
+      diffusivity,
+      false,
+      this->simulation_control);
+}
+
+template <int dim>
+void
+Tracer<dim>::update_matrix_free()
+{
+  const DoFHandler<dim> *dof_handler_fluid =
+    multiphysics->get_dof_handler(PhysicsID::fluid_dynamics);
+
+  const Function<dim> *drift_velocity =
+    &(*this->simulation_parameters.tracer_drift_velocity.drift_velocity);
+
+  // Check if the velocity needs to be taken from the average velocity profile
+  // or the fluid solution
+  const bool use_average_velocity =
+    this->simulation_parameters.initial_condition->type ==
+      Parameters::InitialConditionType::average_velocity_profile &&
+    !this->simulation_parameters.multiphysics.fluid_dynamics &&
+    simulation_control->get_current_time() >
+      this->simulation_parameters.post_processing.initial_time;
+
+  if (multiphysics->fluid_dynamics_is_block())
+    system_operator->evaluate_velocity_and_calculate_tau(
+      *this->mapping,
+      *dof_handler_fluid,
+      use_average_velocity ?
+        *multiphysics->get_block_time_average_solution(
+          PhysicsID::fluid_dynamics) :
+        *multiphysics->get_block_solution(PhysicsID::fluid_dynamics),
+      drift_velocity);
+  else
+    system_operator->evaluate_velocity_and_calculate_tau(
+      *this->mapping,
+      *dof_handler_fluid,
+      use_average_velocity ?
+        *multiphysics->get_time_average_solution(PhysicsID::fluid_dynamics) :
+        *multiphysics->get_solution(PhysicsID::fluid_dynamics),
+      drift_velocity);
+
+  // The shock capturing uses the previous concentration if the simulation is
+  // transient, with the same viscosity and directional factor as the
+  // matrix-based assembler
+  const double order = this->fe->degree;
+  system_operator->evaluate_dcdd_dissipation(
+    *this->mapping,
+    is_steady(this->simulation_control->get_assembly_method()) ?
+      this->evaluation_point :
+      this->previous_solutions[0],
+    [order](const Tensor<1, dim> &velocity,
+            const Tensor<1, dim> &gradient,
+            const double          h) {
+      const double tolerance = 1e-12;
+      const double vdcdd     = (0.5 * h) * (velocity.norm() * velocity.norm()) *
+                           std::pow(gradient.norm() * h, order);
+
+      const Tensor<1, dim> s = velocity / (velocity.norm() + tolerance);
+      const Tensor<1, dim> r = gradient / (gradient.norm() + tolerance);
+
+      return vdcdd * (outer_product(r, r) - (r * s) * outer_product(s, s));
+    });
+
+  // The level operators only depend on the time step, the smoother and the
+  // coarse-grid solver are only rebuilt if it changed
+  gmg_preconditioner->initialize();
+}
+
+template <int dim>
+void
+Tracer<dim>::solve_linear_system_matrix_free(const bool initial_step)
+{
+  const AffineConstraints<double> &constraints_used =
+    initial_step ? nonzero_constraints : this->zero_constraints;
+
+  solve_advection_diffusion_matrix_free(
+    *system_operator,
+    *gmg_preconditioner,
+    this->simulation_parameters.linear_solver.at(PhysicsID::tracer),
+    this->system_rhs,
+    constraints_used,
+    this->newton_update,
+    this->pcout);
+}
+
 
 
 template class Tracer<2>;
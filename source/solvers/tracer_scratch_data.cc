@@ -49,10 +49,6 @@ TracerScratchData<dim>::allocate()
     n_q_points, std::vector<Tensor<2, dim>>(n_dofs));
   this->laplacian_phi =
     std::vector<std::vector<double>>(n_q_points, std::vector<double>(n_dofs));
-
-  if (properties_manager.field_is_required(field::levelset))
-    fields.insert(
-      std::pair<field, std::vector<double>>(field::levelset, n_q_points));
 }
 
 
@@ -61,7 +57,7 @@ void
 TracerScratchData<dim>::calculate_physical_properties()
 {
   if (properties_manager.field_is_required(field::levelset))
-    set_field_vector(field::levelset, this->sdf_values, this->fields);
+    fields.set(field::levelset, this->sdf_values);
 
   switch (properties_manager.get_number_of_fluids())
     {
@@ -17,7 +17,9 @@
 
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/read_write_vector.h>
 #include <deal.II/lac/solver_control.h>
+#include <deal.II/lac/solver_gmres.h>
 #include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/lac/trilinos_precondition.h>
 #include <deal.II/lac/trilinos_solver.h>
@@ -74,6 +76,12 @@ VolumeOfFluid<dim>::assemble_system_matrix()
 {
   TimerOutput::Scope t(this->computing_timer, "Assemble matrix");
 
+  if (this->use_matrix_free)
+    {
+      update_matrix_free();
+      return;
+    }
+
   this->system_matrix = 0;
   setup_assemblers();
 
@@ -88,14 +96,14 @@ VolumeOfFluid<dim>::assemble_system_matrix()
                         *this->mapping,
                         dof_handler_fd->get_fe());
 
-  WorkStream::run(this->dof_handler.begin_active(),
-                  this->dof_handler.end(),
-                  *this,
-                  &VolumeOfFluid::assemble_local_system_matrix,
-                  &VolumeOfFluid::copy_local_matrix_to_global_matrix,
-                  scratch_data,
-                  StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
-                                            this->cell_quadrature->size()));
+  run_cell_assembly(this->dof_handler,
+                    assembly_coloring.get(),
+                    *this,
+                    &VolumeOfFluid::assemble_local_system_matrix,
+                    &VolumeOfFluid::copy_local_matrix_to_global_matrix,
+                    scratch_data,
+                    StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
+                                              this->cell_quadrature->size()));
 
   this->system_matrix.compress(VectorOperation::add);
 }
@@ -218,14 +226,14 @@ VolumeOfFluid<dim>::assemble_system_rhs()
                         *this->mapping,
                         dof_handler_fd->get_fe());
 
-  WorkStream::run(this->dof_handler.begin_active(),
-                  this->dof_handler.end(),
-                  *this,
-                  &VolumeOfFluid::assemble_local_system_rhs,
-                  &VolumeOfFluid::copy_local_rhs_to_global_rhs,
-                  scratch_data,
-                  StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
-                                            this->cell_quadrature->size()));
+  run_cell_assembly(this->dof_handler,
+                    assembly_coloring.get(),
+                    *this,
+                    &VolumeOfFluid::assemble_local_system_rhs,
+                    &VolumeOfFluid::copy_local_rhs_to_global_rhs,
+                    scratch_data,
+                    StabilizedMethodsCopyData(this->fe->n_dofs_per_cell(),
+                                              this->cell_quadrature->size()));
 
   this->system_rhs.compress(VectorOperation::add);
 }
@@ -555,9 +563,7 @@ VolumeOfFluid<dim>::calculate_volume_and_mass(
   const auto density_models =
     this->simulation_parameters.physical_properties_manager
       .get_density_vector();
-  std::map<field, std::vector<double>> fields;
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::pressure, n_q_points));
+  FieldVectors fields;
 
   for (const auto &cell_vof : this->dof_handler.active_cell_iterators())
     {
@@ -579,7 +585,7 @@ VolumeOfFluid<dim>::calculate_volume_and_mass(
               fe_values_fd.reinit(cell_fd);
               fe_values_fd[pressure].get_function_values(current_solution_fd,
                                                          pressure_values);
-              set_field_vector(field::pressure, pressure_values, fields);
+              fields.set(field::pressure, pressure_values);
             }
           // Calculate physical properties for the cell
           density_models[0]->vector_value(fields, density_0);
@@ -660,9 +666,7 @@ VolumeOfFluid<dim>::calculate_momentum(
   const auto density_models =
     this->simulation_parameters.physical_properties_manager
       .get_density_vector();
-  std::map<field, std::vector<double>> fields;
-  fields.insert(
-    std::pair<field, std::vector<double>>(field::pressure, n_q_points));
+  FieldVectors fields;
 
   for (const auto &cell_vof : this->dof_handler.active_cell_iterators())
     {
@@ -687,7 +691,7 @@ VolumeOfFluid<dim>::calculate_momentum(
             {
               fe_values_fd[pressure].get_function_values(current_solution_fd,
                                                          pressure_values);
-              set_field_vector(field::pressure, pressure_values, fields);
+              fields.set(field::pressure, pressure_values);
             }
 
 
@@ -2335,10 +2339,21 @@ VolumeOfFluid<dim>::setup_dofs()
   // assemble_L2_projection_interface_sharpening).
   system_rhs_phase_fraction.reinit(this->locally_owned_dofs, mpi_communicator);
 
-  this->system_matrix.reinit(this->locally_owned_dofs,
-                             this->locally_owned_dofs,
-                             dsp,
-                             mpi_communicator);
+  if (this->use_matrix_free)
+    setup_matrix_free();
+  else
+    this->system_matrix.reinit(this->locally_owned_dofs,
+                               this->locally_owned_dofs,
+                               dsp,
+                               mpi_communicator);
+
+  // The cells are colored for the new mesh and constraints
+  if (this->simulation_parameters.fem_parameters.enable_colored_assembly)
+    {
+      if (!assembly_coloring)
+        assembly_coloring = std::make_shared<AssemblyColoring<dim>>();
+      assembly_coloring->reinit(this->dof_handler, this->zero_constraints);
+    }
 
   this->pcout << "   Number of VOF degrees of freedom: "
               << this->dof_handler.n_dofs() << std::endl;
@@ -2511,6 +2526,12 @@ VolumeOfFluid<dim>::solve_linear_system(const bool initial_step,
 {
   TimerOutput::Scope t(this->computing_timer, "Solve linear system");
 
+  if (this->use_matrix_free)
+    {
+      solve_linear_system_matrix_free(initial_step);
+      return;
+    }
+
   auto mpi_communicator = this->triangulation->get_communicator();
 
   const AffineConstraints<double> &constraints_used =
@@ -2579,6 +2600,164 @@ VolumeOfFluid<dim>::solve_linear_system(const bool initial_step,
   newton_update = completely_distributed_solution;
 }
 
+template <int dim>
+void
+VolumeOfFluid<dim>::setup_matrix_free()
+{
+  AssertThrow(!this->simulation_parameters.mesh.simplex,
+              ExcMessage("The matrix-free VOF solver does not support simplex "
+                         "meshes."));
+  AssertThrow(!this->simulation_parameters.ale.enabled(),
+              ExcMessage("The matrix-free VOF solver does not support ALE."));
+
+  system_operator = std::make_shared<AdvectionDiffusionOperator<dim, double>>();
+  system_operator->reinit(
+    *this->mapping,
+    this->dof_handler,
+    this->zero_constraints,
+    *this->cell_quadrature,
+    1.0,
+    this->simulation_parameters.multiphysics.vof_parameters.diffusivity,
+    false,
+    this->simulation_control);
+}
+
+template <int dim>
+void
+VolumeOfFluid<dim>::update_matrix_free()
+{
+  const DoFHandler<dim> *dof_handler_fd =
+    multiphysics->get_dof_handler(PhysicsID::fluid_dynamics);
+
+  const auto method = this->simulation_control->get_assembly_method();
+
+  // Check if the velocity needs to be taken from the average velocity profile
+  // or the fluid solution
+  const bool use_average_velocity =
+    this->simulation_parameters.initial_condition->type ==
+      Parameters::InitialConditionType::average_velocity_profile &&
+    !this->simulation_parameters.multiphysics.fluid_dynamics &&
+    simulation_control->get_current_time() >
+      this->simulation_parameters.post_processing.initial_time;
+
+  // As in the scratch data of the matrix-based assemblers, the velocity is
+  // extrapolated to the current time from the previous fluid solutions if the
+  // simulation is transient. The weights are those of the Lagrange polynomial
+  // of bdf_extrapolate, which is linear in the solution.
+  std::vector<double> extrapolation_weights;
+  if (is_bdf(method))
+    {
+      const unsigned int n_previous = number_of_previous_solutions(method);
+      const std::vector<double> time_vector =
+        this->simulation_control->get_simulation_times();
+
+      extrapolation_weights.assign(n_previous, 1.0);
+      if (n_previous > 1)
+        for (unsigned int p = 0; p < n_previous; ++p)
+          for (unsigned int k = 0; k < n_previous; ++k)
+            if (p != k)
+              extrapolation_weights[p] *=
+                (time_vector[0] - time_vector[k + 1]) /
+                (time_vector[p + 1] - time_vector[k + 1]);
+    }
+
+  if (multiphysics->fluid_dynamics_is_block())
+    {
+      const GlobalBlockVectorType &fluid_solution =
+        use_average_velocity ?
+          *multiphysics->get_block_time_average_solution(
+            PhysicsID::fluid_dynamics) :
+          *multiphysics->get_block_solution(PhysicsID::fluid_dynamics);
+
+      if (is_bdf(method))
+        {
+          system_operator->evaluate_velocity_and_calculate_tau(
+            *this->mapping,
+            *dof_handler_fd,
+            *multiphysics->get_block_previous_solutions(
+              PhysicsID::fluid_dynamics),
+            extrapolation_weights);
+        }
+      else
+        system_operator->evaluate_velocity_and_calculate_tau(*this->mapping,
+                                                             *dof_handler_fd,
+                                                             fluid_solution);
+
+      if (this->simulation_parameters.multiphysics.vof_parameters.compressible)
+        system_operator->evaluate_velocity_divergence(*this->mapping,
+                                                      *dof_handler_fd,
+                                                      fluid_solution);
+    }
+  else
+    {
+      const GlobalVectorType &fluid_solution =
+        use_average_velocity ?
+          *multiphysics->get_time_average_solution(PhysicsID::fluid_dynamics) :
+          *multiphysics->get_solution(PhysicsID::fluid_dynamics);
+
+      if (is_bdf(method))
+        {
+          system_operator->evaluate_velocity_and_calculate_tau(
+            *this->mapping,
+            *dof_handler_fd,
+            *multiphysics->get_previous_solutions(PhysicsID::fluid_dynamics),
+            extrapolation_weights);
+        }
+      else
+        system_operator->evaluate_velocity_and_calculate_tau(*this->mapping,
+                                                             *dof_handler_fd,
+                                                             fluid_solution);
+
+      if (this->simulation_parameters.multiphysics.vof_parameters.compressible)
+        system_operator->evaluate_velocity_divergence(*this->mapping,
+                                                      *dof_handler_fd,
+                                                      fluid_solution);
+    }
+
+  // The DCDD shock capturing is explicit and uses the previous phase gradient,
+  // with the same viscosity and directional tensor as the matrix-based
+  // assembler
+  if (this->simulation_parameters.stabilization.vof_dcdd_stabilization)
+    system_operator->evaluate_dcdd_dissipation(
+      *this->mapping,
+      this->previous_solutions[0],
+      [](const Tensor<1, dim> &velocity,
+         const Tensor<1, dim> &gradient,
+         const double          h) {
+        const double tolerance = 1e-12;
+
+        const Tensor<1, dim> r = gradient / (gradient.norm() + tolerance);
+        const Tensor<1, dim> s = velocity / (velocity.norm() + tolerance);
+
+        const double nu_dcdd =
+          (0.5 * h * h) * velocity.norm() * gradient.norm();
+
+        return nu_dcdd *
+               (outer_product(r, r) -
+                Utilities::fixed_power<2>(r * s) * outer_product(s, s));
+      });
+
+  system_operator->compute_inverse_diagonal(
+    this->jacobi_preconditioner.get_vector());
+}
+
+template <int dim>
+void
+VolumeOfFluid<dim>::solve_linear_system_matrix_free(const bool initial_step)
+{
+  const AffineConstraints<double> &constraints_used =
+    initial_step ? this->nonzero_constraints : this->zero_constraints;
+
+  solve_advection_diffusion_matrix_free(
+    *system_operator,
+    this->jacobi_preconditioner,
+    this->simulation_parameters.linear_solver.at(PhysicsID::VOF),
+    this->system_rhs,
+    constraints_used,
+    this->newton_update,
+    this->pcout);
+}
+
 // This function is explained in detail in step-41 of deal.II tutorials
 template <int dim>
 void
@@ -0,0 +1,160 @@
+/**
+ * @brief This code tests the Anderson acceleration of the fixed-point
+ * iteration x = Ax + b of a linear contraction. With a depth m, the
+ * accelerated iteration of a problem of size m converges in at most m+1
+ * iterations, while a depth of zero reproduces the Picard iteration. The
+ * state of the iteration is split in two vectors, as with several physics.
+ */
+
+// Lethe
+#include <core/anderson_acceleration.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+// Contraction matrix and right-hand side of the fixed-point problem
+const double contraction[3][3] = {{0.5, 0.2, 0.1},
+                                  {0.1, 0.4, 0.2},
+                                  {0.2, 0.1, 0.6}};
+const double rhs[3]            = {1., 2., 3.};
+
+// Split the first n components of the problem in two vectors
+std::vector<Vector<double>>
+zero_state(const unsigned int n)
+{
+  std::vector<Vector<double>> state(2);
+  state[0].reinit((n + 1) / 2);
+  state[1].reinit(n / 2);
+  return state;
+}
+
+double &
+component(std::vector<Vector<double>> &state, const unsigned int i)
+{
+  return (i < state[0].size()) ? state[0][i] : state[1][i - state[0].size()];
+}
+
+double
+component(const std::vector<Vector<double>> &state, const unsigned int i)
+{
+  return (i < state[0].size()) ? state[0][i] : state[1][i - state[0].size()];
+}
+
+// Evaluate g(x) = Ax + b restricted to the first n components
+std::vector<Vector<double>>
+evaluate(const std::vector<Vector<double>> &iterate, const unsigned int n)
+{
+  std::vector<Vector<double>> evaluation = zero_state(n);
+  for (unsigned int i = 0; i < n; ++i)
+    {
+      component(evaluation, i) = rhs[i];
+      for (unsigned int j = 0; j < n; ++j)
+        component(evaluation, i) += contraction[i][j] * component(iterate, j);
+    }
+  return evaluation;
+}
+
+// Iterate from x_0 = 0 and return the index k of the first iterate x_k whose
+// residual g(x_k) - x_k is below the tolerance. The iterates computed by the
+// acceleration are stored if requested.
+unsigned int
+solve(const unsigned int                        depth,
+      const unsigned int                        n,
+      std::vector<std::vector<Vector<double>>> *iterates = nullptr)
+{
+  const double       tolerance      = 1e-8;
+  const unsigned int max_iterations = 100;
+
+  AndersonAcceleration<Vector<double>> anderson(depth);
+  anderson.clear();
+
+  std::vector<Vector<double>> iterate = zero_state(n);
+  for (unsigned int k = 0; k < max_iterations; ++k)
+    {
+      std::vector<Vector<double>> evaluation = evaluate(iterate, n);
+      const double residual_norm = anderson.update(iterate, evaluation);
+      if (residual_norm < tolerance)
+        return k;
+      if (iterates)
+        iterates->push_back(evaluation);
+      iterate = evaluation;
+    }
+  return max_iterations;
+}
+
+void
+test()
+{
+  // A depth m converges in at most m+1 iterations on a problem of size m
+  for (unsigned int m = 1; m <= 3; ++m)
+    {
+      const unsigned int n_iterations = solve(m, m);
+      AssertThrow(n_iterations <= m + 1,
+                  ExcMessage("The accelerated iteration of depth " +
+                             std::to_string(m) + " converged in " +
+                             std::to_string(n_iterations) +
+                             " iterations instead of at most " +
+                             std::to_string(m + 1)));
+      deallog << "Depth " << m << " on a problem of size " << m
+              << ": converged in at most " << m + 1 << " iterations"
+              << std::endl;
+    }
+
+  // A depth of zero reproduces the Picard iteration
+  std::vector<std::vector<Vector<double>>> iterates;
+  const unsigned int n_iterations = solve(0, 3, &iterates);
+  AssertThrow(n_iterations < 100,
+              ExcMessage("The iteration of depth 0 did not converge"));
+
+  std::vector<Vector<double>> picard_iterate = zero_state(3);
+  bool                        identical      = true;
+  for (const auto &iterate : iterates)
+    {
+      picard_iterate = evaluate(picard_iterate, 3);
+      for (unsigned int i = 0; i < 3; ++i)
+        identical &= component(picard_iterate, i) == component(iterate, i);
+    }
+  AssertThrow(identical,
+              ExcMessage("The iteration of depth 0 differs from the Picard "
+                         "iteration"));
+  deallog << "Depth 0 on a problem of size 3: converged, identical to the "
+             "Picard iteration"
+          << std::endl;
+}
+
+int
+main(int argc, char *argv[])
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}
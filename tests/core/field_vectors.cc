@@ -0,0 +1,114 @@
+/**
+ * @brief Tests the evaluation of a physical property model with FieldVectors.
+ * The fields are views on buffers owned by the caller, so modifying a buffer
+ * modifies the values used by the model without setting the field again. The
+ * analytical jacobian of the Carreau model is compared to the numerical one.
+ */
+
+// Lethe
+#include <core/rheological_model.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+void
+print_vector(const std::string &name, const std::vector<double> &values)
+{
+  deallog << " " << name << " = {" << values[0];
+  for (unsigned int i = 1; i < values.size(); ++i)
+    deallog << ", " << values[i];
+  deallog << "}" << std::endl;
+}
+
+void
+test()
+{
+  deallog << "Beginning" << std::endl;
+
+  Carreau rheology_model(5, 0, 1, 2, 0.5);
+
+  std::vector<double> shear_rate({1, 2, 3});
+  const unsigned int  n_values = shear_rate.size();
+  std::vector<double> kinematic_viscosity(n_values);
+  std::vector<double> analytical_jacobian(n_values);
+  std::vector<double> numerical_jacobian(n_values);
+
+  FieldVectors fields;
+  deallog << "Shear rate defined: " << fields.is_defined(field::shear_rate)
+          << std::endl;
+  fields.set(field::shear_rate, shear_rate);
+  deallog << "Shear rate defined: " << fields.is_defined(field::shear_rate)
+          << ", temperature defined: "
+          << fields.is_defined(field::temperature) << std::endl;
+
+  for (unsigned int iteration = 0; iteration < 2; ++iteration)
+    {
+      // The buffer is modified in place, the view remains valid
+      if (iteration == 1)
+        for (unsigned int i = 0; i < n_values; ++i)
+          shear_rate[i] += 3;
+
+      rheology_model.vector_value(fields, kinematic_viscosity);
+      rheology_model.vector_jacobian(fields,
+                                     field::shear_rate,
+                                     analytical_jacobian);
+      rheology_model.vector_numerical_jacobian(fields,
+                                               field::shear_rate,
+                                               numerical_jacobian);
+
+      bool jacobians_match = true;
+      for (unsigned int i = 0; i < n_values; ++i)
+        if (std::abs(analytical_jacobian[i] - numerical_jacobian[i]) >
+            1e-5 * std::abs(analytical_jacobian[i]))
+          jacobians_match = false;
+
+      print_vector("gamma", shear_rate);
+      print_vector("nu", kinematic_viscosity);
+      print_vector("dnu/dgamma", analytical_jacobian);
+      deallog << " Numerical jacobian matches: " << jacobians_match
+              << std::endl;
+    }
+
+  // The jacobian with respect to a field the model does not depend on is zero
+  rheology_model.vector_jacobian(fields,
+                                 field::temperature,
+                                 analytical_jacobian);
+  print_vector("dnu/dT", analytical_jacobian);
+
+  deallog << "OK" << std::endl;
+}
+
+int
+main()
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+}
@@ -0,0 +1,130 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief This test checks the adaptative time stepping of the DEM transient
+ * simulation control. The time step must grow up to the maximal time step,
+ * be scaled down when the normal overlap growth ratio or the particle CFL
+ * surpass their maximal value, go below the time step given in the parameters
+ * when the overlaps grow quickly and never go below the minimal time step.
+ */
+
+// Lethe
+#include <core/parameters.h>
+#include <core/simulation_control.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+void
+test()
+{
+  Parameters::SimulationControl simulation_control_parameters;
+
+  simulation_control_parameters.method =
+    Parameters::SimulationControl::TimeSteppingMethod::bdf1;
+  simulation_control_parameters.dt                              = 1;
+  simulation_control_parameters.timeEnd                         = 40;
+  simulation_control_parameters.adapt                           = true;
+  simulation_control_parameters.adaptative_time_step_scaling    = 2;
+  simulation_control_parameters.maxCFL                          = 1;
+  simulation_control_parameters.max_normal_overlap_growth_ratio = 0.001;
+  simulation_control_parameters.max_dt                          = 8;
+  simulation_control_parameters.min_dt                          = 0.25;
+  simulation_control_parameters.number_mesh_adaptation          = 0;
+  simulation_control_parameters.output_name                     = "test";
+  simulation_control_parameters.subdivision                     = 1;
+  simulation_control_parameters.output_folder                   = "canard";
+  simulation_control_parameters.output_frequency                = 1;
+  simulation_control_parameters.output_time_interval = {0, 1000000000};
+
+  SimulationControlTransientDEM simulation_control(
+    simulation_control_parameters);
+
+  deallog << "Iteration : " << simulation_control.get_step_number()
+          << "    Time : " << simulation_control.get_current_time()
+          << "    Time step : " << simulation_control.get_time_step()
+          << std::endl;
+
+  while (simulation_control.integrate())
+    {
+      const unsigned int step_number = simulation_control.get_step_number();
+      deallog << "Iteration : " << step_number
+              << "    Time : " << simulation_control.get_current_time()
+              << "    Time step : " << simulation_control.get_time_step()
+              << std::endl;
+
+      // A fast growth of the overlaps reduces the time step below the time
+      // step of the parameters, down to its minimal value
+      if (step_number == 4)
+        {
+          simulation_control.set_normal_overlap_growth_ratio(0.004);
+          deallog << "Normal overlap growth ratio : " << 0.004 << std::endl;
+        }
+      if (step_number == 7)
+        {
+          simulation_control.set_normal_overlap_growth_ratio(0.);
+          deallog << "Normal overlap growth ratio : " << 0. << std::endl;
+        }
+
+      // Fast particles reduce the time step
+      if (step_number == 10)
+        {
+          simulation_control.set_CFL(2.);
+          deallog << "CFL : " << 2. << std::endl;
+        }
+      if (step_number == 11)
+        {
+          simulation_control.set_CFL(0.);
+          deallog << "CFL : " << 0. << std::endl;
+        }
+    }
+}
+
+int
+main()
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+}
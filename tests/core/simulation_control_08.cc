@@ -0,0 +1,123 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief This test checks that the adaptative time stepping of the DEM
+ * transient simulation control neither grows without bound nor collapses. The
+ * criteria are updated at every iteration with the current time step, as the
+ * DEM solver does. Without contacts, the time step is bound by a fraction of
+ * the Rayleigh time step even if the maximal time step is much larger. During
+ * an impact, the growth of the overlaps reduces the time step until it stays
+ * constant. In a resting contact, the overlaps do not grow and the time step
+ * returns to its bound.
+ */
+
+// Lethe
+#include <core/parameters.h>
+#include <core/simulation_control.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+void
+test()
+{
+  Parameters::SimulationControl simulation_control_parameters;
+
+  simulation_control_parameters.method =
+    Parameters::SimulationControl::TimeSteppingMethod::bdf1;
+  simulation_control_parameters.dt                              = 0.5;
+  simulation_control_parameters.timeEnd                         = 1000;
+  simulation_control_parameters.adapt                           = true;
+  simulation_control_parameters.adaptative_time_step_scaling    = 2;
+  simulation_control_parameters.maxCFL                          = 1;
+  simulation_control_parameters.max_normal_overlap_growth_ratio = 0.01;
+  simulation_control_parameters.max_dt                          = 1000;
+  simulation_control_parameters.min_dt                          = 0.001;
+  simulation_control_parameters.number_mesh_adaptation          = 0;
+  simulation_control_parameters.output_name                     = "test";
+  simulation_control_parameters.subdivision                     = 1;
+  simulation_control_parameters.output_folder                   = "canard";
+  simulation_control_parameters.output_frequency                = 1;
+  simulation_control_parameters.output_time_interval = {0, 1000000000};
+
+  SimulationControlTransientDEM simulation_control(
+    simulation_control_parameters);
+
+  // The time step is bound by 15% of the Rayleigh time step
+  simulation_control.set_rayleigh_time_step(10);
+
+  // Velocity of the particles and normal relative velocity of the contacts,
+  // relative to the diameter of the particles
+  const double relative_velocity        = 0.1;
+  const double relative_normal_velocity = 0.1;
+
+  for (unsigned int i = 0; i < 15; ++i)
+    {
+      simulation_control.integrate();
+      const unsigned int step_number = simulation_control.get_step_number();
+      const double       time_step   = simulation_control.get_time_step();
+
+      // Free flight (1-5), impact (6-10) and resting contact (11-15)
+      const bool   impact = step_number > 5 && step_number <= 10;
+      const double normal_overlap_growth_ratio =
+        impact ? relative_normal_velocity * time_step : 0.;
+
+      simulation_control.set_CFL(relative_velocity * time_step);
+      simulation_control.set_normal_overlap_growth_ratio(
+        normal_overlap_growth_ratio);
+
+      deallog << "Iteration : " << step_number
+              << "    Time step : " << time_step
+              << "    Normal overlap growth ratio : "
+              << normal_overlap_growth_ratio << std::endl;
+    }
+}
+
+int
+main()
+{
+  try
+    {
+      initlog();
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+}
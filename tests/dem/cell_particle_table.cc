@@ -0,0 +1,121 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief In this test, the table of the particles located in each cell used
+ * by the particle-particle broad search is built and the ids of the particles
+ * of every cell are printed.
+ */
+
+// Deal.II
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/particles/particle.h>
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/particle_iterator.h>
+
+// Lethe
+#include <core/dem_properties.h>
+
+#include <dem/cell_particle_table.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+using namespace dealii;
+
+template <int dim>
+void
+test()
+{
+  // Creating the mesh and refinement
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(triangulation, -1, 1, true);
+  triangulation.refine_global(1);
+  MappingQ<dim> mapping(1);
+
+  Particles::ParticleHandler<dim> particle_handler(
+    triangulation, mapping, DEM::get_number_properties());
+
+  // Inserting four particles, two of them in the same cell
+  std::vector<Point<dim>> positions = {Point<dim>(-0.5, -0.5, -0.5),
+                                       Point<dim>(0.5, 0.5, 0.5),
+                                       Point<dim>(-0.4, -0.5, -0.5),
+                                       Point<dim>(0.5, -0.5, -0.5)};
+
+  for (unsigned int id = 0; id < positions.size(); ++id)
+    {
+      Particles::Particle<dim> particle(positions[id], positions[id], id);
+      typename Triangulation<dim>::active_cell_iterator cell =
+        GridTools::find_active_cell_around_point(triangulation,
+                                                 particle.get_location());
+      particle_handler.insert_particle(particle, cell);
+    }
+
+  CellParticleTable<dim> cell_particle_table;
+  cell_particle_table.build(particle_handler);
+
+  // Output
+  for (const auto &cell : triangulation.active_cell_iterators())
+    {
+      deallog << "Cell " << cell->active_cell_index()
+              << " contains particles:";
+      for (const auto &particle_id :
+           cell_particle_table.particles_in_cell(cell))
+        deallog << " " << particle_id;
+      deallog << std::endl;
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      initlog();
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+      test<3>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
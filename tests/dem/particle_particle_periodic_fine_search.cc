@@ -0,0 +1,191 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2019 - 2024 by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 2.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief In this test, the particle-particle fine search is evaluated for a
+ * pair of particles located on opposite periodic boundaries. The pair must
+ * only be detected when the periodic offset is given, and the periodic offset
+ * of the contact must point to the nearest periodic image of particle two.
+ */
+
+// Deal.II
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/grid_tools.h>
+
+#include <deal.II/particles/particle.h>
+#include <deal.II/particles/particle_handler.h>
+#include <deal.II/particles/particle_iterator.h>
+
+// Lethe
+#include <core/dem_properties.h>
+
+#include <dem/contact_info.h>
+#include <dem/data_containers.h>
+#include <dem/particle_particle_fine_search.h>
+#include <dem/update_local_particle_containers.h>
+
+// Tests (with common definitions)
+#include <../tests/tests.h>
+
+using namespace dealii;
+
+template <int dim>
+void
+output_contacts(
+  const typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+    &adjacent_particles)
+{
+  for (const auto &[particle_one_id, contact_list] : adjacent_particles)
+    {
+      for (const auto &[particle_two_id, contact_info] : contact_list)
+        {
+          deallog << "The particle pair in contact are particles: "
+                  << contact_info.particle_one->get_id() << " and "
+                  << contact_info.particle_two->get_id() << std::endl;
+          deallog << "Periodic offset of the contact is: "
+                  << contact_info.periodic_offset[0] << " "
+                  << contact_info.periodic_offset[1] << " "
+                  << contact_info.periodic_offset[2] << std::endl;
+        }
+    }
+}
+
+template <int dim>
+void
+test()
+{
+  // Creating the mesh and refinement
+  parallel::distributed::Triangulation<dim> triangulation(MPI_COMM_WORLD);
+  GridGenerator::hyper_cube(triangulation, -1, 1, true);
+  triangulation.refine_global(2);
+  MappingQ<dim> mapping(1);
+
+  Particles::ParticleHandler<dim> particle_handler(
+    triangulation, mapping, DEM::get_number_properties());
+
+  // Inserting two particles close to the opposite faces in the x direction
+  const double particle_diameter      = 0.005;
+  const double neighborhood_threshold = std::pow(1.3 * particle_diameter, 2);
+  std::vector<Point<dim>> positions   = {Point<dim>(-0.998, 0, 0),
+                                         Point<dim>(0.998, 0, 0)};
+
+  for (unsigned int id = 0; id < positions.size(); ++id)
+    {
+      Particles::Particle<dim> particle(positions[id], positions[id], id);
+      typename Triangulation<dim>::active_cell_iterator cell =
+        GridTools::find_active_cell_around_point(triangulation,
+                                                 particle.get_location());
+      Particles::ParticleIterator<dim> pit =
+        particle_handler.insert_particle(particle, cell);
+      pit->get_properties()[DEM::PropertiesIndex::type] = 0;
+      pit->get_properties()[DEM::PropertiesIndex::dp]   = particle_diameter;
+      pit->get_properties()[DEM::PropertiesIndex::mass] = 1;
+    }
+
+  typename DEM::dem_data_structures<dim>::particle_index_iterator_map
+    particle_container;
+  update_particle_container<dim>(particle_container, &particle_handler);
+
+  // Offset between the periodic boundaries 0 (x = -1) and 1 (x = 1)
+  Tensor<1, dim> periodic_offset;
+  periodic_offset[0] = 2.;
+
+  // Without the periodic offset, the particles are not in contact
+  {
+    typename DEM::dem_data_structures<dim>::particle_particle_candidates
+      contact_pair_candidates;
+    contact_pair_candidates[0] = {1};
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+      adjacent_particles;
+    particle_particle_fine_search<dim>(particle_container,
+                                       adjacent_particles,
+                                       contact_pair_candidates,
+                                       neighborhood_threshold);
+    deallog << "Number of particles in contact without periodic offset: "
+            << adjacent_particles.size() << std::endl;
+  }
+
+  // Particle one on periodic boundary 0, the periodic image of particle two
+  // is found with a positive offset
+  {
+    typename DEM::dem_data_structures<dim>::particle_particle_candidates
+      contact_pair_candidates;
+    contact_pair_candidates[0] = {1};
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+      adjacent_particles;
+    particle_particle_fine_search<dim>(particle_container,
+                                       adjacent_particles,
+                                       contact_pair_candidates,
+                                       neighborhood_threshold,
+                                       periodic_offset);
+    output_contacts<dim>(adjacent_particles);
+  }
+
+  // Particle one on periodic boundary 1, the periodic image of particle two
+  // is found with a negative offset
+  {
+    typename DEM::dem_data_structures<dim>::particle_particle_candidates
+      contact_pair_candidates;
+    contact_pair_candidates[1] = {0};
+    typename DEM::dem_data_structures<dim>::adjacent_particle_pairs
+      adjacent_particles;
+    particle_particle_fine_search<dim>(particle_container,
+                                       adjacent_particles,
+                                       contact_pair_candidates,
+                                       neighborhood_threshold,
+                                       periodic_offset);
+    output_contacts<dim>(adjacent_particles);
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      initlog();
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+      test<3>();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  return 0;
+}
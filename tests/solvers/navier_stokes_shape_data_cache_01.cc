@@ -0,0 +1,185 @@
+/* ---------------------------------------------------------------------
+ *
+ * Copyright (C) 2024 - by the Lethe authors
+ *
+ * This file is part of the Lethe library
+ *
+ * The Lethe library is free software; you can use it, redistribute
+ * it, and/or modify it under the terms of the GNU Lesser General
+ * Public License as published by the Free Software Foundation; either
+ * version 3.1 of the License, or (at your option) any later version.
+ * The full text of the license can be found in the file LICENSE at
+ * the top level of the Lethe distribution.
+ *
+ * ---------------------------------------------------------------------
+ */
+
+/**
+ * @brief This code tests the cache of the shape functions of the affine cells
+ * used by the NavierStokesScratchData. The number of distinct cell shapes is
+ * checked on uniform, locally refined and non-affine meshes and the cached
+ * shape functions are compared to the ones of the FEValues.
+ */
+
+// Deal.II includes
+#include <deal.II/base/quadrature_lib.h>
+
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/fe_values.h>
+#include <deal.II/fe/mapping_q.h>
+
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+
+// Lethe
+#include <solvers/navier_stokes_shape_data_cache.h>
+
+// Tests
+#include <../tests/tests.h>
+
+template <int dim>
+void
+test_mesh(const Triangulation<dim> &triangulation, const std::string &name)
+{
+  const FESystem<dim> fe(FE_Q<dim>(2), dim, FE_Q<dim>(1), 1);
+  DoFHandler<dim>     dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  const MappingQ<dim> mapping(1);
+  const QGauss<dim>   quadrature(3);
+
+  NavierStokesShapeDataCache<dim> cache;
+  cache.initialize(dof_handler, mapping, quadrature);
+
+  deallog << name << std::endl;
+  deallog << " Number of cells:        " << triangulation.n_active_cells()
+          << std::endl;
+  deallog << " Number of cached cells: " << cache.n_cached_cells()
+          << std::endl;
+  deallog << " Number of shapes:       " << cache.n_shapes() << std::endl;
+
+  // Compare the cached shape functions with the ones of the FEValues
+  FEValues<dim> fe_values(mapping,
+                          fe,
+                          quadrature,
+                          update_values | update_JxW_values |
+                            update_gradients | update_hessians);
+
+  const FEValuesExtractors::Vector velocities(0);
+  const FEValuesExtractors::Scalar pressure(dim);
+
+  double max_difference = 0;
+  for (const auto &cell : dof_handler.active_cell_iterators())
+    {
+      const auto *shape_data = cache.get_shape_data(cell);
+      if (shape_data == nullptr)
+        continue;
+
+      fe_values.reinit(cell);
+      for (unsigned int q = 0; q < quadrature.size(); ++q)
+        {
+          max_difference =
+            std::max(max_difference,
+                     std::abs(shape_data->JxW[q] - fe_values.JxW(q)));
+          for (unsigned int k = 0; k < fe.n_dofs_per_cell(); ++k)
+            {
+              max_difference =
+                std::max(max_difference,
+                         (shape_data->phi_u[q][k] -
+                          fe_values[velocities].value(k, q))
+                           .norm());
+              max_difference =
+                std::max(max_difference,
+                         (shape_data->grad_phi_u[q][k] -
+                          fe_values[velocities].gradient(k, q))
+                           .norm());
+              max_difference =
+                std::max(max_difference,
+                         (shape_data->hess_phi_u[q][k] -
+                          fe_values[velocities].hessian(k, q))
+                           .norm());
+              max_difference =
+                std::max(max_difference,
+                         std::abs(shape_data->phi_p[q][k] -
+                                  fe_values[pressure].value(k, q)));
+              max_difference =
+                std::max(max_difference,
+                         (shape_data->grad_phi_p[q][k] -
+                          fe_values[pressure].gradient(k, q))
+                           .norm());
+            }
+        }
+    }
+
+  deallog << " Cached shape functions match the FEValues: "
+          << (max_difference < 1e-10 ? "true" : "false") << std::endl;
+}
+
+void
+test()
+{
+  {
+    Triangulation<2> triangulation;
+    GridGenerator::hyper_cube(triangulation, -1, 1);
+    triangulation.refine_global(2);
+    test_mesh(triangulation, "Uniform square mesh");
+
+    triangulation.begin_active()->set_refine_flag();
+    triangulation.execute_coarsening_and_refinement();
+    test_mesh(triangulation, "Locally refined square mesh");
+  }
+
+  {
+    Triangulation<2> triangulation;
+    GridGenerator::hyper_ball(triangulation);
+    test_mesh(triangulation, "Disk mesh");
+  }
+
+  {
+    Triangulation<3> triangulation;
+    GridGenerator::hyper_rectangle(triangulation,
+                                   Point<3>(0, 0, 0),
+                                   Point<3>(1, 2, 3));
+    triangulation.refine_global(1);
+    test_mesh(triangulation, "Uniform box mesh");
+  }
+}
+
+int
+main(int argc, char **argv)
+{
+  try
+    {
+      initlog();
+      Utilities::MPI::MPI_InitFinalize mpi_initialization(argc, argv, 1);
+      test();
+    }
+  catch (std::exception &exc)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Exception on processing: " << std::endl
+                << exc.what() << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+  catch (...)
+    {
+      std::cerr << std::endl
+                << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      std::cerr << "Unknown exception!" << std::endl
+                << "Aborting!" << std::endl
+                << "----------------------------------------------------"
+                << std::endl;
+      return 1;
+    }
+
+  return 0;
+}